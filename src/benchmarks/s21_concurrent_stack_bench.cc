@@ -0,0 +1,70 @@
+// Throughput of concurrent_stack against a mutex around s21::stack, from
+// one thread up to twice the hardware threads. Every thread pushes and pops
+// in pairs on a stack that all of them share. Run with `make bench`.
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+namespace {
+
+constexpr long kPairsPerThread = 500000;
+
+class LockedStack {
+ public:
+  void push(long value) {
+    std::lock_guard<std::mutex> guard(lock);
+    data.push(value);
+  }
+  bool try_pop(long& value) {
+    std::lock_guard<std::mutex> guard(lock);
+    if (data.empty()) return false;
+    value = data.pop_value();
+    return true;
+  }
+
+ private:
+  std::mutex lock;
+  s21::stack<long> data;
+};
+
+// millions of operations (pushes plus pops) per second
+template <typename Stack>
+double run(unsigned threads) {
+  Stack stack;
+  std::vector<std::thread> workers;
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned t = 0; t < threads; ++t) {
+    workers.emplace_back([&stack] {
+      long value = 0;
+      for (long i = 0; i < kPairsPerThread; ++i) {
+        stack.push(i);
+        stack.try_pop(value);
+      }
+    });
+  }
+  for (auto& worker : workers) worker.join();
+  std::chrono::duration<double> took =
+      std::chrono::steady_clock::now() - start;
+  return 2.0 * kPairsPerThread * threads / took.count() / 1e6;
+}
+
+}  // namespace
+
+int main() {
+  unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+  std::printf("concurrent_stack vs mutex + s21::stack, %u hardware threads\n",
+              hardware);
+  std::printf("%8s %18s %18s\n", "threads", "lock-free Mops/s", "mutex Mops/s");
+  for (unsigned threads = 1; threads <= 2 * hardware; threads *= 2) {
+    double lock_free = run<s21::concurrent_stack<long>>(threads);
+    double locked = run<LockedStack>(threads);
+    std::printf("%8u %18.2f %18.2f\n", threads, lock_free, locked);
+  }
+  return 0;
+}
@@ -0,0 +1,42 @@
+// Fill with push_back, then drain with pop_front, for s21::deque against
+// std::deque, s21::circular_buffer and s21::list. Run with `make bench`.
+#include <chrono>
+#include <cstdio>
+#include <deque>
+
+#include "../s21_containers.h"
+
+namespace {
+
+// milliseconds to push n elements at the back and pop them at the front
+template <typename Container>
+double fill_and_drain(int n) {
+  auto start = std::chrono::steady_clock::now();
+  Container c;
+  long sum = 0;
+  for (int i = 0; i < n; ++i) c.push_back(i);
+  while (!c.empty()) {
+    sum += c.front();
+    c.pop_front();
+  }
+  std::chrono::duration<double, std::milli> took =
+      std::chrono::steady_clock::now() - start;
+  if (sum != long(n) * (n - 1) / 2) std::printf("wrong sum\n");
+  return took.count();
+}
+
+}  // namespace
+
+int main() {
+  std::printf("fill at the back, drain at the front, ms\n");
+  std::printf("%10s %12s %12s %12s %12s\n", "elements", "s21 deque",
+              "std deque", "ring buffer", "s21 list");
+  for (int n = 1000; n <= 1000000; n *= 10) {
+    std::printf("%10d %12.3f %12.3f %12.3f %12.3f\n", n,
+                fill_and_drain<s21::deque<int>>(n),
+                fill_and_drain<std::deque<int>>(n),
+                fill_and_drain<s21::circular_buffer<int>>(n),
+                fill_and_drain<s21::list<int>>(n));
+  }
+  return 0;
+}
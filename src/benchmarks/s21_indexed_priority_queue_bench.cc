@@ -0,0 +1,63 @@
+// Re-prioritization loop: n queued items, then n updates to random items,
+// each moved to a new priority, for indexed_priority_queue against the
+// erase-and-reinsert that s21::multiset needs. Run with `make bench`.
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+namespace {
+
+constexpr int kSeed = 7;
+
+// millions of updates per second
+double indexed(int n) {
+  std::mt19937 gen(kSeed);
+  std::uniform_int_distribution<long> priority(0, 1 << 30);
+  s21::indexed_priority_queue<long> queue;
+  std::vector<std::size_t> handles;
+  for (int i = 0; i < n; ++i) handles.push_back(queue.push(priority(gen)));
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < n; ++i) {
+    queue.update(handles[gen() % n], priority(gen));
+  }
+  std::chrono::duration<double> took =
+      std::chrono::steady_clock::now() - start;
+  return n / took.count() / 1e6;
+}
+
+double tree(int n) {
+  std::mt19937 gen(kSeed);
+  std::uniform_int_distribution<long> priority(0, 1 << 30);
+  s21::multiset<std::pair<long, int>> queue;
+  std::vector<long> current;
+  for (int i = 0; i < n; ++i) {
+    current.push_back(priority(gen));
+    queue.insert({current.back(), i});
+  }
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < n; ++i) {
+    int item = gen() % n;
+    queue.erase(queue.find({current[item], item}));
+    current[item] = priority(gen);
+    queue.insert({current[item], item});
+  }
+  std::chrono::duration<double> took =
+      std::chrono::steady_clock::now() - start;
+  return n / took.count() / 1e6;
+}
+
+}  // namespace
+
+int main() {
+  std::printf("random re-prioritization, M updates per second\n");
+  std::printf("%10s %10s %10s\n", "items", "indexed", "multiset");
+  for (int n = 1000; n <= 1000000; n *= 10) {
+    std::printf("%10d %10.2f %10.2f\n", n, indexed(n), tree(n));
+  }
+  return 0;
+}
@@ -0,0 +1,119 @@
+// Items per second through mpmc_queue, one at a time and in batches,
+// against a mutex around s21::queue, with 2, 8 and 32 threads split evenly
+// into producers and consumers. Run with `make bench`.
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+namespace {
+
+constexpr long kItems = 2000000;
+constexpr std::size_t kCapacity = 1024;
+constexpr std::size_t kBatch = 16;
+
+class LockedQueue {
+ public:
+  bool try_push(long value) {
+    std::lock_guard<std::mutex> guard(lock);
+    if (data.size() == kCapacity) return false;
+    data.push(value);
+    return true;
+  }
+  bool try_pop(long& value) {
+    std::lock_guard<std::mutex> guard(lock);
+    if (data.empty()) return false;
+    value = data.front();
+    data.pop();
+    return true;
+  }
+
+ private:
+  std::mutex lock;
+  s21::queue<long> data;
+};
+
+template <typename Queue>
+void one_by_one(Queue& queue, long items) {
+  for (long i = 0; i < items; ++i) {
+    while (!queue.try_push(i)) std::this_thread::yield();
+  }
+}
+
+template <typename Queue>
+void drain_one_by_one(Queue& queue, long items) {
+  long value = 0;
+  for (long i = 0; i < items; ++i) {
+    while (!queue.try_pop(value)) std::this_thread::yield();
+  }
+}
+
+void in_batches(s21::mpmc_queue<long>& queue, long items) {
+  std::vector<long> batch(kBatch);
+  for (long next = 0; next < items;) {
+    long n = std::min<long>(kBatch, items - next);
+    auto first = batch.begin();
+    auto last = batch.begin() + n;
+    while ((first = queue.try_push_many(first, last)) != last) {
+      std::this_thread::yield();
+    }
+    next += n;
+  }
+}
+
+void drain_in_batches(s21::mpmc_queue<long>& queue, long items) {
+  std::vector<long> out(kBatch);
+  for (long got = 0; got < items;) {
+    long want = std::min<long>(kBatch, items - got);
+    long n = queue.try_pop_many(out.begin(), want) - out.begin();
+    if (n == 0) std::this_thread::yield();
+    got += n;
+  }
+}
+
+// millions of items per second with threads / 2 producers and consumers
+template <typename Queue, typename Push, typename Pop>
+double run(unsigned threads, Push push, Pop pop) {
+  Queue queue(kCapacity);
+  unsigned pairs = threads / 2;
+  long share = kItems / pairs;
+  std::vector<std::thread> workers;
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned i = 0; i < pairs; ++i) {
+    workers.emplace_back([&queue, push, share] { push(queue, share); });
+    workers.emplace_back([&queue, pop, share] { pop(queue, share); });
+  }
+  for (auto& worker : workers) worker.join();
+  std::chrono::duration<double> took =
+      std::chrono::steady_clock::now() - start;
+  return share * pairs / took.count() / 1e6;
+}
+
+struct Sized : LockedQueue {
+  explicit Sized(std::size_t) {}
+};
+
+}  // namespace
+
+int main() {
+  using Mpmc = s21::mpmc_queue<long>;
+  std::printf("mpmc_queue vs mutex + s21::queue, %u hardware threads\n",
+              std::thread::hardware_concurrency());
+  std::printf("%8s %16s %16s %16s\n", "threads", "mpmc M/s",
+              "mpmc x16 M/s", "mutex M/s");
+  for (unsigned threads : {2u, 8u, 32u}) {
+    double single = run<Mpmc>(threads, one_by_one<Mpmc>,
+                              drain_one_by_one<Mpmc>);
+    double batched = run<Mpmc>(threads, in_batches, drain_in_batches);
+    double locked = run<Sized>(threads, one_by_one<LockedQueue>,
+                               drain_one_by_one<LockedQueue>);
+    std::printf("%8u %16.2f %16.2f %16.2f\n", threads, single, batched,
+                locked);
+  }
+  return 0;
+}
@@ -0,0 +1,76 @@
+// Timer-wheel style workload: fill a queue with n deadlines, then pop the
+// earliest and push a later one n times (the "hold" model), for the d-ary
+// priority_queue at a few arities, std::priority_queue and s21::multiset.
+// Run with `make bench`.
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+namespace {
+
+constexpr int kSeed = 42;
+
+template <std::size_t Arity>
+struct Heap {
+  s21::priority_queue<long, std::greater<long>, Arity> queue;
+  void push(long value) { queue.push(value); }
+  long pop() { return queue.pop_value(); }
+};
+
+struct StdHeap {
+  std::priority_queue<long, std::vector<long>, std::greater<long>> queue;
+  void push(long value) { queue.push(value); }
+  long pop() {
+    long value = queue.top();
+    queue.pop();
+    return value;
+  }
+};
+
+struct Tree {
+  s21::multiset<long> queue;
+  void push(long value) { queue.insert(value); }
+  long pop() {
+    auto first = queue.begin();
+    long value = *first;
+    queue.erase(first);
+    return value;
+  }
+};
+
+// millions of push + pop pairs per second
+template <typename Queue>
+double hold(int n) {
+  std::mt19937 gen(kSeed);
+  std::uniform_int_distribution<long> delay(1, 1000000);
+  Queue timers;
+  for (int i = 0; i < n; ++i) timers.push(delay(gen));
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < n; ++i) {
+    long now = timers.pop();
+    timers.push(now + delay(gen));
+  }
+  std::chrono::duration<double> took =
+      std::chrono::steady_clock::now() - start;
+  return n / took.count() / 1e6;
+}
+
+}  // namespace
+
+int main() {
+  std::printf("hold model, M push+pop per second\n");
+  std::printf("%10s %10s %10s %10s %10s %10s\n", "timers", "2-ary", "4-ary",
+              "8-ary", "std", "multiset");
+  for (int n = 1000; n <= 1000000; n *= 10) {
+    std::printf("%10d %10.2f %10.2f %10.2f %10.2f %10.2f\n", n,
+                hold<Heap<2>>(n), hold<Heap<4>>(n), hold<Heap<8>>(n),
+                hold<StdHeap>(n), hold<Tree>(n));
+  }
+  return 0;
+}
@@ -0,0 +1,39 @@
+// Time to fill a queue and drain it again, for s21::queue against
+// std::queue, at growing sizes. Run with `make bench`.
+#include <chrono>
+#include <cstdio>
+#include <queue>
+
+#include "../s21_containers.h"
+
+namespace {
+
+// milliseconds to push n elements and pop them all
+template <typename Queue>
+double fill_and_drain(int n) {
+  auto start = std::chrono::steady_clock::now();
+  Queue queue;
+  long sum = 0;
+  for (int i = 0; i < n; ++i) queue.push(i);
+  while (!queue.empty()) {
+    sum += queue.front();
+    queue.pop();
+  }
+  std::chrono::duration<double, std::milli> took =
+      std::chrono::steady_clock::now() - start;
+  if (sum != long(n) * (n - 1) / 2) std::printf("wrong sum\n");
+  return took.count();
+}
+
+}  // namespace
+
+int main() {
+  std::printf("queue fill and drain\n");
+  std::printf("%10s %14s %14s\n", "elements", "s21 ms", "std ms");
+  for (int n = 1000; n <= 1000000; n *= 10) {
+    double ours = fill_and_drain<s21::queue<int>>(n);
+    double theirs = fill_and_drain<std::queue<int>>(n);
+    std::printf("%10d %14.3f %14.3f\n", n, ours, theirs);
+  }
+  return 0;
+}
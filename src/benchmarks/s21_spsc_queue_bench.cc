@@ -0,0 +1,103 @@
+// Items per second handed from one producer thread to one consumer thread
+// through spsc_queue, one at a time and in batches, against a mutex around
+// s21::queue. Run with `make bench`; the numbers only mean something with
+// the two threads on separate cores.
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+namespace {
+
+constexpr long kItems = 5000000;
+constexpr std::size_t kCapacity = 1024;
+constexpr std::size_t kBatch = 32;
+
+class LockedQueue {
+ public:
+  bool push(long value) {
+    std::lock_guard<std::mutex> guard(lock);
+    if (data.size() == kCapacity) return false;
+    data.push(value);
+    return true;
+  }
+  bool try_pop(long& value) {
+    std::lock_guard<std::mutex> guard(lock);
+    if (data.empty()) return false;
+    value = data.front();
+    data.pop();
+    return true;
+  }
+
+ private:
+  std::mutex lock;
+  s21::queue<long> data;
+};
+
+template <typename Start>
+double items_per_second(Start start_pair) {
+  auto start = std::chrono::steady_clock::now();
+  start_pair();
+  std::chrono::duration<double> took =
+      std::chrono::steady_clock::now() - start;
+  return kItems / took.count() / 1e6;
+}
+
+template <typename Queue>
+void one_by_one(Queue& queue) {
+  std::thread producer([&queue] {
+    for (long i = 0; i < kItems; ++i) {
+      while (!queue.push(i)) std::this_thread::yield();
+    }
+  });
+  long value = 0;
+  for (long i = 0; i < kItems; ++i) {
+    while (!queue.try_pop(value)) std::this_thread::yield();
+  }
+  producer.join();
+}
+
+void in_batches(s21::spsc_queue<long>& queue) {
+  std::thread producer([&queue] {
+    std::vector<long> batch(kBatch);
+    for (long next = 0; next < kItems;) {
+      long n = std::min<long>(kBatch, kItems - next);
+      for (long i = 0; i < n; ++i) batch[i] = next + i;
+      auto first = batch.begin();
+      auto last = batch.begin() + n;
+      while ((first = queue.push_many(first, last)) != last) {
+        std::this_thread::yield();
+      }
+      next += n;
+    }
+  });
+  std::vector<long> out(kBatch);
+  for (long got = 0; got < kItems;) {
+    long n = queue.pop_many(out.begin(), kBatch) - out.begin();
+    if (n == 0) std::this_thread::yield();
+    got += n;
+  }
+  producer.join();
+}
+
+}  // namespace
+
+int main() {
+  s21::spsc_queue<long> spsc(kCapacity);
+  LockedQueue locked;
+  std::printf("one producer, one consumer, %ld items, %u hardware threads\n",
+              kItems, std::thread::hardware_concurrency());
+  std::printf("%-28s %8.2f M items/s\n", "spsc_queue push/try_pop",
+              items_per_second([&spsc] { one_by_one(spsc); }));
+  std::printf("%-28s %8.2f M items/s\n", "spsc_queue batches of 32",
+              items_per_second([&spsc] { in_batches(spsc); }));
+  std::printf("%-28s %8.2f M items/s\n", "mutex + s21::queue",
+              items_per_second([&locked] { one_by_one(locked); }));
+  return 0;
+}
@@ -4,6 +4,8 @@
 #include "s21_containers/s21_list.h"
 #include "s21_containers/s21_vector.h"
 #include "s21_containers/s21_stack.h"
+#include "s21_containers/s21_circular_buffer.h"
+#include "s21_containers/s21_deque.h"
 #include "s21_containers/s21_queue.h"
 #include "s21_containers/s21_set.h"
 #include "s21_containers/s21_map.h"
@@ -0,0 +1,265 @@
+#ifndef SRC_S21_CONTAINERS_S21_ARENA_AVLTREE_H_
+#define SRC_S21_CONTAINERS_S21_ARENA_AVLTREE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <tuple>
+#include <utility>
+
+#include "s21_bulk_load.h"
+#include "s21_instrument.h"
+#include "s21_memory_stats.h"
+#include "s21_node_handle.h"
+
+namespace s21 {
+
+// AVL tree with the same interface as AVLTree whose nodes live in one
+// contiguous arena instead of separate heap blocks. Nodes are linked by
+// 32-bit indices, and the balance factor (-1, 0 or +1) is packed into the
+// top two bits of the parent index, so a node costs 12 bytes on top of its
+// element. Erased nodes go to a free list and are reused. Iterators hold
+// the tree and an index, so they survive the arena growing; only erasing
+// the element they point to invalidates them.
+template <typename Key, typename Value, typename Compare = std::less<Key>>
+class ArenaAVLTree {
+ private:
+  using index_type = std::uint32_t;
+  using data_type = std::pair<Key, Value>;
+  static constexpr index_type kIndexBits = 30;
+  static constexpr index_type kNil = (index_type(1) << kIndexBits) - 1;
+  static constexpr index_type kIndexMask = kNil;
+  // a free slot has every bit of parent_bf set
+  static constexpr index_type kFree = ~index_type(0);
+
+  struct Node {
+    index_type left;
+    index_type right;
+    index_type parent_bf;
+    alignas(data_type) unsigned char storage[sizeof(data_type)];
+    data_type& data() {
+      return *std::launder(reinterpret_cast<data_type*>(storage));
+    }
+  };
+
+  Node* nodes;
+  index_type used;      // slots handed out so far, live or free
+  index_type capacity_;
+  index_type free_head;  // free slots are chained through left
+  index_type root;
+  index_type leftmost;
+  index_type rightmost;
+  index_type count;
+  instrument::compare_t<Compare, instrument::family::arena_avl_tree> comp;
+  using hooks = instrument::Hooks<instrument::family::arena_avl_tree>;
+
+  // node fields
+  index_type parent(index_type i) const {
+    return nodes[i].parent_bf & kIndexMask;
+  }
+  void set_parent(index_type i, index_type p) {
+    nodes[i].parent_bf = (nodes[i].parent_bf & ~kIndexMask) | p;
+  }
+  int bf(index_type i) const {
+    return static_cast<int>(nodes[i].parent_bf >> kIndexBits) - 1;
+  }
+  void set_bf(index_type i, int b) {
+    nodes[i].parent_bf = (nodes[i].parent_bf & kIndexMask) |
+                         (static_cast<index_type>(b + 1) << kIndexBits);
+  }
+  const Key& node_key(index_type i) const { return nodes[i].data().first; }
+
+  // arena
+  void relocate(index_type new_capacity);
+  template <typename... Args>
+  index_type allocate(Args&&... args);
+  void deallocate(index_type i);
+  void destroy_all();
+
+  // helper methods
+  index_type find_min(index_type i) const;
+  index_type find_max(index_type i) const;
+  index_type predecessor(index_type i) const;
+  index_type successor(index_type i) const;
+  void replace_child(index_type p, index_type old_child, index_type new_child);
+  index_type rotate_left(index_type x, index_type z);
+  index_type rotate_right(index_type x, index_type z);
+  index_type rotate_right_left(index_type x, index_type z);
+  index_type rotate_left_right(index_type x, index_type z);
+  void retrace_insert(index_type z);
+  void retrace_erase(index_type x, bool left_shrunk);
+  void erase_node(index_type i);
+  index_type link(index_type p, bool left, index_type i);
+  template <typename... Args>
+  index_type attach(index_type p, bool left, Args&&... args);
+  template <typename... Args>
+  index_type attach_between(index_type prev, index_type next,
+                            Args&&... args);
+  index_type find_slot(const Key& key, bool multi, index_type* parent,
+                       bool* left) const;
+  template <typename K>
+  index_type lower_bound_node(const K& key) const;
+  template <typename K>
+  index_type upper_bound_node(const K& key) const;
+
+  // bulk construction
+  using traits = bulk::input_traits<Key, Value>;
+  template <typename T, typename U>
+  bool key_less(const T& a, const U& b) const;
+  template <typename Next>
+  index_type build(index_type n, index_type p, Next& next, int* height);
+  template <typename Next>
+  void rebuild(size_t n, Next& next);
+
+ public:
+  class Iterator;
+  class ConstIterator;
+  using key_type = Key;
+  using value_type = Value;
+  using size_type = size_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+  using node_type = ValueHandle<Key, Value>;
+
+ public:
+  class Iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::pair<Key, Value>;
+    using pointer = value_type*;
+    using reference = value_type&;
+    Iterator() : tree(nullptr), index(kNil) {}
+    Iterator(ArenaAVLTree* owner, index_type i) : tree(owner), index(i) {}
+    Iterator& operator++();
+    Iterator operator++(int);
+    Iterator& operator--();
+    Iterator operator--(int);
+    bool operator!=(const Iterator& other) const;
+    bool operator==(const Iterator& other) const;
+    reference operator*() const;
+
+   protected:
+    ArenaAVLTree* tree;
+    index_type index;
+    friend class ArenaAVLTree;
+  };
+
+  class ConstIterator : public Iterator {
+   public:
+    using Iterator::Iterator;
+    ConstIterator() : Iterator() {}
+    ConstIterator(const Iterator& it) : Iterator(it) {}
+    const typename Iterator::value_type& operator*() const {
+      return Iterator::operator*();
+    }
+  };
+
+ public:
+  // constructors
+  ArenaAVLTree() : ArenaAVLTree(Compare()) {}
+  explicit ArenaAVLTree(const Compare& compare)
+      : nodes(nullptr),
+        used(0),
+        capacity_(0),
+        free_head(kNil),
+        root(kNil),
+        leftmost(kNil),
+        rightmost(kNil),
+        count(0),
+        comp(compare) {}
+  ArenaAVLTree(std::initializer_list<value_type> const& items);
+  ArenaAVLTree(const ArenaAVLTree& tree);
+  ArenaAVLTree(ArenaAVLTree&& tree) noexcept;
+
+  // destructor
+  ~ArenaAVLTree();
+
+  // assignment
+  ArenaAVLTree& operator=(const ArenaAVLTree& tree);
+  ArenaAVLTree& operator=(ArenaAVLTree&& tree) noexcept;
+
+  // Iterators
+  Iterator begin();
+  Iterator end();
+  ConstIterator cbegin() const;
+  ConstIterator cend() const;
+
+  // capacity
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  size_type capacity() const;
+  void reserve(size_type n);
+  MemoryStats memory_stats() const;
+  size_type memory_usage() const { return memory_stats().total(); }
+
+  // modifiers
+  void clear();
+  std::pair<Iterator, bool> insert(const data_type& data, bool multi);
+  std::pair<Iterator, bool> insert(data_type&& data, bool multi);
+  std::pair<Iterator, bool> insert(Iterator hint, const data_type& data,
+                                   bool multi);
+  std::pair<Iterator, bool> insert(Iterator hint, data_type&& data,
+                                   bool multi);
+  template <typename... Args>
+  std::pair<Iterator, bool> emplace(bool multi, Args&&... args);
+  template <typename K, typename... Args>
+  std::pair<Iterator, bool> try_emplace(K&& key, Args&&... args);
+  void erase(Iterator pos);
+  Iterator erase(Iterator first, Iterator last);
+  node_type extract(Iterator pos);
+  std::pair<Iterator, bool> insert(node_type& node, bool multi);
+  void swap(ArenaAVLTree& other);
+  void merge(ArenaAVLTree& other, bool multi);
+  // as in AVLTree, but two trees never share an arena, so the elements
+  // that change trees are moved: split is linear in the part split off,
+  // join in the size of other
+  ArenaAVLTree split(Iterator pos);
+  bool join(ArenaAVLTree& other, bool multi);
+  template <typename InputIt>
+  void assign(InputIt first, InputIt last, bool multi);
+  template <typename ForwardIt>
+  void assign_sorted(ForwardIt first, ForwardIt last, bool multi);
+  template <typename InputIt>
+  void assign_parallel(InputIt first, InputIt last, bool multi,
+                       bulk::Keep keep, unsigned threads);
+
+  // lookup: K is key_type or, with a transparent Compare, anything that
+  // compares against it
+  template <typename K>
+  Iterator lower_bound(const K& key);
+  template <typename K>
+  Iterator upper_bound(const K& key);
+  template <typename K>
+  Iterator find(const K& key);
+  template <typename K>
+  bool contains(const K& key);
+  // as in AVLTree: kBatch searches descend in lockstep, prefetching
+  template <typename ForwardIt, typename Emit>
+  void find_many(ForwardIt first, ForwardIt last, Emit emit);
+
+  // observers
+  Compare key_comp() const { return comp; }
+
+ private:
+  static constexpr size_t kBatch = 16;
+  template <typename D>
+  std::pair<Iterator, bool> insert_data(D&& data, bool multi);
+  template <typename D>
+  std::pair<Iterator, bool> insert_hint_data(Iterator hint, D&& data,
+                                             bool multi);
+};
+
+}  // namespace s21
+
+#include "s21_arena_avltree.tpp"
+
+#endif  // SRC_S21_CONTAINERS_S21_ARENA_AVLTREE_H_
@@ -0,0 +1,1026 @@
+#ifndef SRC_S21_CONTAINERS_S21_ARENA_AVLTREE_TPP_
+#define SRC_S21_CONTAINERS_S21_ARENA_AVLTREE_TPP_
+
+#include <cstring>
+
+#include "s21_arena_avltree.h"
+
+namespace s21 {
+
+// Moves the arena to a block of new_capacity slots. Elements that are
+// trivially copyable move with a single memcpy.
+template <typename Key, typename Value, typename Compare>
+void ArenaAVLTree<Key, Value, Compare>::relocate(index_type new_capacity) {
+  Node* fresh = static_cast<Node*>(::operator new(sizeof(Node) * new_capacity));
+  hooks::allocated();
+  if (nodes) {
+    hooks::reallocated();
+    hooks::deallocated();
+  }
+  hooks::moved(count);
+  if constexpr (std::is_trivially_copyable_v<data_type>) {
+    if (used) std::memcpy(fresh, nodes, sizeof(Node) * used);
+  } else {
+    for (index_type i = 0; i < used; ++i) {
+      fresh[i].left = nodes[i].left;
+      fresh[i].right = nodes[i].right;
+      fresh[i].parent_bf = nodes[i].parent_bf;
+      if (nodes[i].parent_bf != kFree) {
+        new (fresh[i].storage) data_type(std::move(nodes[i].data()));
+        nodes[i].data().~data_type();
+      }
+    }
+  }
+  ::operator delete(nodes);
+  nodes = fresh;
+  capacity_ = new_capacity;
+}
+
+// Takes a slot from the free list, or from the end of the arena, and
+// builds the element in it from args as a detached node with a zero balance
+// factor.
+template <typename Key, typename Value, typename Compare>
+template <typename... Args>
+typename ArenaAVLTree<Key, Value, Compare>::index_type
+ArenaAVLTree<Key, Value, Compare>::allocate(Args&&... args) {
+  index_type i = free_head;
+  if (i != kNil) {
+    new (nodes[i].storage) data_type(std::forward<Args>(args)...);
+    free_head = nodes[i].left;
+  } else if (used < capacity_) {
+    i = used;
+    new (nodes[i].storage) data_type(std::forward<Args>(args)...);
+    ++used;
+  } else {
+    if (capacity_ == kNil) {
+      throw std::length_error("ArenaAVLTree: too many elements");
+    }
+    // args may refer into the arena that is about to move
+    data_type copy(std::forward<Args>(args)...);
+    index_type grown = capacity_ ? capacity_ * 2 : 16;
+    relocate(grown < kNil && grown > capacity_ ? grown : kNil);
+    i = used;
+    new (nodes[i].storage) data_type(std::move(copy));
+    ++used;
+  }
+  nodes[i].left = kNil;
+  nodes[i].right = kNil;
+  nodes[i].parent_bf = kNil | (index_type(1) << kIndexBits);
+  return i;
+}
+
+template <typename Key, typename Value, typename Compare>
+void ArenaAVLTree<Key, Value, Compare>::deallocate(index_type i) {
+  nodes[i].data().~data_type();
+  nodes[i].parent_bf = kFree;
+  nodes[i].left = free_head;
+  free_head = i;
+}
+
+// Destroys every element but keeps the arena.
+template <typename Key, typename Value, typename Compare>
+void ArenaAVLTree<Key, Value, Compare>::destroy_all() {
+  if constexpr (!std::is_trivially_destructible_v<data_type>) {
+    for (index_type i = 0; i < used; ++i) {
+      if (nodes[i].parent_bf != kFree) nodes[i].data().~data_type();
+    }
+  }
+  used = 0;
+  free_head = root = leftmost = rightmost = kNil;
+  count = 0;
+}
+
+template <typename Key, typename Value, typename Compare>
+typename ArenaAVLTree<Key, Value, Compare>::index_type
+ArenaAVLTree<Key, Value, Compare>::find_min(index_type i) const {
+  if (i == kNil) return kNil;
+  while (nodes[i].left != kNil) i = nodes[i].left;
+  return i;
+}
+
+template <typename Key, typename Value, typename Compare>
+typename ArenaAVLTree<Key, Value, Compare>::index_type
+ArenaAVLTree<Key, Value, Compare>::find_max(index_type i) const {
+  if (i == kNil) return kNil;
+  while (nodes[i].right != kNil) i = nodes[i].right;
+  return i;
+}
+
+template <typename Key, typename Value, typename Compare>
+typename ArenaAVLTree<Key, Value, Compare>::index_type
+ArenaAVLTree<Key, Value, Compare>::predecessor(index_type i) const {
+  if (nodes[i].left != kNil) return find_max(nodes[i].left);
+  index_type p = parent(i);
+  while (p != kNil && i == nodes[p].left) {
+    i = p;
+    p = parent(p);
+  }
+  return p;
+}
+
+template <typename Key, typename Value, typename Compare>
+typename ArenaAVLTree<Key, Value, Compare>::index_type
+ArenaAVLTree<Key, Value, Compare>::successor(index_type i) const {
+  if (nodes[i].right != kNil) return find_min(nodes[i].right);
+  index_type p = parent(i);
+  while (p != kNil && i == nodes[p].right) {
+    i = p;
+    p = parent(p);
+  }
+  return p;
+}
+
+template <typename Key, typename Value, typename Compare>
+void ArenaAVLTree<Key, Value, Compare>::replace_child(index_type p,
+                                                      index_type old_child,
+                                                      index_type new_child) {
+  if (p == kNil) {
+    root = new_child;
+  } else if (nodes[p].left == old_child) {
+    nodes[p].left = new_child;
+  } else {
+    nodes[p].right = new_child;
+  }
+  if (new_child != kNil) set_parent(new_child, p);
+}
+
+// The rotations work on balance factors alone. Each one takes the unbalanced
+// node x and its taller child z, and returns the new subtree root. The
+// caller links that root to the old parent of x.
+template <typename Key, typename Value, typename Compare>
+typename ArenaAVLTree<Key, Value, Compare>::index_type
+ArenaAVLTree<Key, Value, Compare>::rotate_left(index_type x, index_type z) {
+  hooks::rotated();
+  index_type inner = nodes[z].left;
+  nodes[x].right = inner;
+  if (inner != kNil) set_parent(inner, x);
+  nodes[z].left = x;
+  set_parent(x, z);
+  if (bf(z) == 0) {
+    set_bf(x, 1);
+    set_bf(z, -1);
+  } else {
+    set_bf(x, 0);
+    set_bf(z, 0);
+  }
+  return z;
+}
+
+template <typename Key, typename Value, typename Compare>
+typename ArenaAVLTree<Key, Value, Compare>::index_type
+ArenaAVLTree<Key, Value, Compare>::rotate_right(index_type x, index_type z) {
+  hooks::rotated();
+  index_type inner = nodes[z].right;
+  nodes[x].left = inner;
+  if (inner != kNil) set_parent(inner, x);
+  nodes[z].right = x;
+  set_parent(x, z);
+  if (bf(z) == 0) {
+    set_bf(x, -1);
+    set_bf(z, 1);
+  } else {
+    set_bf(x, 0);
+    set_bf(z, 0);
+  }
+  return z;
+}
+
+template <typename Key, typename Value, typename Compare>
+typename ArenaAVLTree<Key, Value, Compare>::index_type
+ArenaAVLTree<Key, Value, Compare>::rotate_right_left(index_type x,
+                                                     index_type z) {
+  hooks::rotated(2);
+  index_type y = nodes[z].left;
+  index_type outer = nodes[y].right;
+  nodes[z].left = outer;
+  if (outer != kNil) set_parent(outer, z);
+  nodes[y].right = z;
+  set_parent(z, y);
+  index_type inner = nodes[y].left;
+  nodes[x].right = inner;
+  if (inner != kNil) set_parent(inner, x);
+  nodes[y].left = x;
+  set_parent(x, y);
+  set_bf(x, bf(y) > 0 ? -1 : 0);
+  set_bf(z, bf(y) < 0 ? 1 : 0);
+  set_bf(y, 0);
+  return y;
+}
+
+template <typename Key, typename Value, typename Compare>
+typename ArenaAVLTree<Key, Value, Compare>::index_type
+ArenaAVLTree<Key, Value, Compare>::rotate_left_right(index_type x,
+                                                     index_type z) {
+  hooks::rotated(2);
+  index_type y = nodes[z].right;
+  index_type outer = nodes[y].left;
+  nodes[z].right = outer;
+  if (outer != kNil) set_parent(outer, z);
+  nodes[y].left = z;
+  set_parent(z, y);
+  index_type inner = nodes[y].right;
+  nodes[x].left = inner;
+  if (inner != kNil) set_parent(inner, x);
+  nodes[y].right = x;
+  set_parent(x, y);
+  set_bf(x, bf(y) < 0 ? 1 : 0);
+  set_bf(z, bf(y) > 0 ? -1 : 0);
+  set_bf(y, 0);
+  return y;
+}
+
+// z is a subtree that just grew by one level. Walks up until an ancestor
+// absorbs the growth or one rotation restores the old height.
+template <typename Key, typename Value, typename Compare>
+void ArenaAVLTree<Key, Value, Compare>::retrace_insert(index_type z) {
+  for (index_type x = parent(z); x != kNil; x = parent(z)) {
+    hooks::rebalanced();
+    index_type g = parent(x);
+    index_type n;
+    if (z == nodes[x].right) {
+      if (bf(x) <= 0) {
+        set_bf(x, bf(x) + 1);
+        if (bf(x) == 0) return;
+        z = x;
+        continue;
+      }
+      n = bf(z) < 0 ? rotate_right_left(x, z) : rotate_left(x, z);
+    } else {
+      if (bf(x) >= 0) {
+        set_bf(x, bf(x) - 1);
+        if (bf(x) == 0) return;
+        z = x;
+        continue;
+      }
+      n = bf(z) > 0 ? rotate_left_right(x, z) : rotate_right(x, z);
+    }
+    replace_child(g, x, n);
+    return;
+  }
+}
+
+// One side of x (the left one if left_shrunk) just lost a level. Walks up
+// while subtrees keep getting shorter.
+template <typename Key, typename Value, typename Compare>
+void ArenaAVLTree<Key, Value, Compare>::retrace_erase(index_type x,
+                                                      bool left_shrunk) {
+  while (x != kNil) {
+    hooks::rebalanced();
+    index_type g = parent(x);
+    bool x_is_left = g != kNil && nodes[g].left == x;
+    int sibling_bf = 1;
+    index_type n = x;
+    if (left_shrunk) {
+      if (bf(x) <= 0) {
+        set_bf(x, bf(x) + 1);
+        if (bf(x) == 1) return;
+      } else {
+        index_type z = nodes[x].right;
+        sibling_bf = bf(z);
+        n = sibling_bf < 0 ? rotate_right_left(x, z) : rotate_left(x, z);
+        replace_child(g, x, n);
+      }
+    } else {
+      if (bf(x) >= 0) {
+        set_bf(x, bf(x) - 1);
+        if (bf(x) == -1) return;
+      } else {
+        index_type z = nodes[x].left;
+        sibling_bf = bf(z);
+        n = sibling_bf > 0 ? rotate_left_right(x, z) : rotate_right(x, z);
+        replace_child(g, x, n);
+      }
+    }
+    // a single rotation around a balanced sibling keeps the height
+    if (sibling_bf == 0) return;
+    x = g;
+    left_shrunk = x_is_left;
+  }
+}
+
+template <typename Key, typename Value, typename Compare>
+void ArenaAVLTree<Key, Value, Compare>::erase_node(index_type i) {
+  if (i == leftmost) leftmost = successor(i);
+  if (i == rightmost) rightmost = predecessor(i);
+  index_type p = parent(i);
+  index_type l = nodes[i].left;
+  index_type r = nodes[i].right;
+  index_type fix = p;
+  bool left_shrunk = p != kNil && nodes[p].left == i;
+  if (l == kNil || r == kNil) {
+    replace_child(p, i, l != kNil ? l : r);
+  } else {
+    index_type s = find_min(r);
+    if (s == r) {
+      fix = s;
+      left_shrunk = false;
+    } else {
+      fix = parent(s);
+      left_shrunk = true;
+      replace_child(fix, s, nodes[s].right);
+      nodes[s].right = r;
+      set_parent(r, s);
+    }
+    nodes[s].left = l;
+    set_parent(l, s);
+    set_bf(s, bf(i));
+    replace_child(p, i, s);
+  }
+  deallocate(i);
+  --count;
+  retrace_erase(fix, left_shrunk);
+}
+
+template <typename Key, typename Value, typename Compare>
+typename ArenaAVLTree<Key, Value, Compare>::index_type
+ArenaAVLTree<Key, Value, Compare>::link(index_type p, bool left,
+                                        index_type i) {
+  set_parent(i, p);
+  if (p == kNil) {
+    root = leftmost = rightmost = i;
+  } else if (left) {
+    nodes[p].left = i;
+    if (p == leftmost) leftmost = i;
+  } else {
+    nodes[p].right = i;
+    if (p == rightmost) rightmost = i;
+  }
+  ++count;
+  retrace_insert(i);
+  return i;
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename... Args>
+typename ArenaAVLTree<Key, Value, Compare>::index_type
+ArenaAVLTree<Key, Value, Compare>::attach(index_type p, bool left,
+                                          Args&&... args) {
+  return link(p, left, allocate(std::forward<Args>(args)...));
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename... Args>
+typename ArenaAVLTree<Key, Value, Compare>::index_type
+ArenaAVLTree<Key, Value, Compare>::attach_between(index_type prev,
+                                                  index_type next,
+                                                  Args&&... args) {
+  if (prev != kNil && nodes[prev].right == kNil) {
+    return attach(prev, false, std::forward<Args>(args)...);
+  }
+  return attach(next, true, std::forward<Args>(args)...);
+}
+
+// Same descent as AVLTree::find_slot; returns kNil when the key may go
+// under *parent on the *left side.
+template <typename Key, typename Value, typename Compare>
+typename ArenaAVLTree<Key, Value, Compare>::index_type
+ArenaAVLTree<Key, Value, Compare>::find_slot(const Key& key, bool multi,
+                                             index_type* parent,
+                                             bool* left) const {
+  *parent = kNil;
+  *left = true;
+  index_type candidate = kNil;
+  for (index_type current = root; current != kNil;) {
+    *parent = current;
+    if (multi) {
+      *left = comp(key, node_key(current));
+    } else {
+      *left = !comp(node_key(current), key);
+      if (*left) candidate = current;
+    }
+    current = *left ? nodes[current].left : nodes[current].right;
+  }
+  if (candidate != kNil && !comp(key, node_key(candidate))) {
+    return candidate;
+  }
+  return kNil;
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+typename ArenaAVLTree<Key, Value, Compare>::index_type
+ArenaAVLTree<Key, Value, Compare>::lower_bound_node(const K& key) const {
+  index_type current = root;
+  index_type result = kNil;
+  while (current != kNil) {
+    if (!comp(node_key(current), key)) {
+      result = current;
+      current = nodes[current].left;
+    } else {
+      current = nodes[current].right;
+    }
+  }
+  return result;
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+typename ArenaAVLTree<Key, Value, Compare>::index_type
+ArenaAVLTree<Key, Value, Compare>::upper_bound_node(const K& key) const {
+  index_type current = root;
+  index_type result = kNil;
+  while (current != kNil) {
+    if (comp(key, node_key(current))) {
+      result = current;
+      current = nodes[current].left;
+    } else {
+      current = nodes[current].right;
+    }
+  }
+  return result;
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename T, typename U>
+bool ArenaAVLTree<Key, Value, Compare>::key_less(const T& a,
+                                                 const U& b) const {
+  return comp(traits::key_of(a), traits::key_of(b));
+}
+
+// Same shape as AVLTree::build, with the nodes laid out in creation order.
+template <typename Key, typename Value, typename Compare>
+template <typename Next>
+typename ArenaAVLTree<Key, Value, Compare>::index_type
+ArenaAVLTree<Key, Value, Compare>::build(index_type n, index_type p,
+                                         Next& next, int* height) {
+  if (n == 0) {
+    *height = 0;
+    return kNil;
+  }
+  int left_height = 0;
+  int right_height = 0;
+  index_type left_size = n / 2;
+  index_type l = build(left_size, kNil, next, &left_height);
+  index_type i = allocate(next());
+  set_parent(i, p);
+  nodes[i].left = l;
+  if (l != kNil) set_parent(l, i);
+  nodes[i].right = build(n - left_size - 1, i, next, &right_height);
+  set_bf(i, right_height - left_height);
+  *height = std::max(left_height, right_height) + 1;
+  return i;
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename Next>
+void ArenaAVLTree<Key, Value, Compare>::rebuild(size_t n, Next& next) {
+  ArenaAVLTree built(comp);
+  built.reserve(n);
+  int height = 0;
+  built.root = built.build(static_cast<index_type>(n), kNil, next, &height);
+  built.leftmost = built.find_min(built.root);
+  built.rightmost = built.find_max(built.root);
+  built.count = static_cast<index_type>(n);
+  swap(built);
+}
+
+// Iterator
+template <typename Key, typename Value, typename Compare>
+typename ArenaAVLTree<Key, Value, Compare>::Iterator&
+ArenaAVLTree<Key, Value, Compare>::Iterator::operator++() {
+  index = tree->successor(index);
+  return *this;
+}
+
+template <typename Key, typename Value, typename Compare>
+typename ArenaAVLTree<Key, Value, Compare>::Iterator
+ArenaAVLTree<Key, Value, Compare>::Iterator::operator++(int) {
+  Iterator it(*this);
+  ++(*this);
+  return it;
+}
+
+template <typename Key, typename Value, typename Compare>
+typename ArenaAVLTree<Key, Value, Compare>::Iterator&
+ArenaAVLTree<Key, Value, Compare>::Iterator::operator--() {
+  index = index == kNil ? tree->rightmost : tree->predecessor(index);
+  return *this;
+}
+
+template <typename Key, typename Value, typename Compare>
+typename ArenaAVLTree<Key, Value, Compare>::Iterator
+ArenaAVLTree<Key, Value, Compare>::Iterator::operator--(int) {
+  Iterator it(*this);
+  --(*this);
+  return it;
+}
+
+template <typename Key, typename Value, typename Compare>
+bool ArenaAVLTree<Key, Value, Compare>::Iterator::operator!=(
+    const Iterator& other) const {
+  return !(*this == other);
+}
+
+template <typename Key, typename Value, typename Compare>
+bool ArenaAVLTree<Key, Value, Compare>::Iterator::operator==(
+    const Iterator& other) const {
+  return tree == other.tree && index == other.index;
+}
+
+template <typename Key, typename Value, typename Compare>
+typename ArenaAVLTree<Key, Value, Compare>::Iterator::reference
+ArenaAVLTree<Key, Value, Compare>::Iterator::operator*() const {
+  if (!tree || index == kNil) {
+    throw std::out_of_range("Dereferencing end() iterator");
+  }
+  return tree->nodes[index].data();
+}
+
+// constructors
+template <typename Key, typename Value, typename Compare>
+ArenaAVLTree<Key, Value, Compare>::ArenaAVLTree(
+    std::initializer_list<value_type> const& items)
+    : ArenaAVLTree() {
+  assign(items.begin(), items.end(), false);
+}
+
+// Copies the arena slot for slot, free slots included, so every index (and
+// with it the shape of the tree) stays the same.
+template <typename Key, typename Value, typename Compare>
+ArenaAVLTree<Key, Value, Compare>::ArenaAVLTree(const ArenaAVLTree& tree)
+    : ArenaAVLTree(tree.comp) {
+  if (!tree.used) {
+    return;
+  }
+  nodes = static_cast<Node*>(::operator new(sizeof(Node) * tree.used));
+  hooks::allocated();
+  capacity_ = tree.used;
+  if constexpr (std::is_trivially_copyable_v<data_type>) {
+    std::memcpy(nodes, tree.nodes, sizeof(Node) * tree.used);
+    used = tree.used;
+  } else {
+    try {
+      for (; used < tree.used; ++used) {
+        const Node& src = tree.nodes[used];
+        if (src.parent_bf != kFree) {
+          new (nodes[used].storage)
+              data_type(const_cast<Node&>(src).data());
+        }
+        nodes[used].left = src.left;
+        nodes[used].right = src.right;
+        nodes[used].parent_bf = src.parent_bf;
+      }
+    } catch (...) {
+      destroy_all();
+      hooks::deallocated();
+      ::operator delete(nodes);
+      throw;
+    }
+  }
+  free_head = tree.free_head;
+  root = tree.root;
+  leftmost = tree.leftmost;
+  rightmost = tree.rightmost;
+  count = tree.count;
+}
+
+template <typename Key, typename Value, typename Compare>
+ArenaAVLTree<Key, Value, Compare>::ArenaAVLTree(ArenaAVLTree&& tree) noexcept
+    : ArenaAVLTree(tree.comp) {
+  swap(tree);
+}
+
+// destructor
+template <typename Key, typename Value, typename Compare>
+ArenaAVLTree<Key, Value, Compare>::~ArenaAVLTree() {
+  destroy_all();
+  if (nodes) hooks::deallocated();
+  ::operator delete(nodes);
+}
+
+// assignment
+template <typename Key, typename Value, typename Compare>
+ArenaAVLTree<Key, Value, Compare>&
+ArenaAVLTree<Key, Value, Compare>::operator=(const ArenaAVLTree& tree) {
+  if (this != &tree) {
+    ArenaAVLTree copy(tree);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <typename Key, typename Value, typename Compare>
+ArenaAVLTree<Key, Value, Compare>&
+ArenaAVLTree<Key, Value, Compare>::operator=(ArenaAVLTree&& tree) noexcept {
+  if (this != &tree) {
+    ArenaAVLTree moved(std::move(tree));
+    swap(moved);
+  }
+  return *this;
+}
+
+// Iterators
+template <typename Key, typename Value, typename Compare>
+typename ArenaAVLTree<Key, Value, Compare>::Iterator
+ArenaAVLTree<Key, Value, Compare>::begin() {
+  return Iterator(this, leftmost);
+}
+
+template <typename Key, typename Value, typename Compare>
+typename ArenaAVLTree<Key, Value, Compare>::Iterator
+ArenaAVLTree<Key, Value, Compare>::end() {
+  return Iterator(this, kNil);
+}
+
+template <typename Key, typename Value, typename Compare>
+typename ArenaAVLTree<Key, Value, Compare>::ConstIterator
+ArenaAVLTree<Key, Value, Compare>::cbegin() const {
+  return ConstIterator(const_cast<ArenaAVLTree*>(this), leftmost);
+}
+
+template <typename Key, typename Value, typename Compare>
+typename ArenaAVLTree<Key, Value, Compare>::ConstIterator
+ArenaAVLTree<Key, Value, Compare>::cend() const {
+  return ConstIterator(const_cast<ArenaAVLTree*>(this), kNil);
+}
+
+// Capacity
+template <typename Key, typename Value, typename Compare>
+bool ArenaAVLTree<Key, Value, Compare>::empty() const {
+  return count == 0;
+}
+
+template <typename Key, typename Value, typename Compare>
+typename ArenaAVLTree<Key, Value, Compare>::size_type
+ArenaAVLTree<Key, Value, Compare>::size() const {
+  return count;
+}
+
+template <typename Key, typename Value, typename Compare>
+typename ArenaAVLTree<Key, Value, Compare>::size_type
+ArenaAVLTree<Key, Value, Compare>::max_size() const {
+  return kNil;
+}
+
+// free and never used slots of the arena count as overhead
+template <typename Key, typename Value, typename Compare>
+MemoryStats ArenaAVLTree<Key, Value, Compare>::memory_stats() const {
+  return memory::split(sizeof(*this) + size_t(capacity_) * sizeof(Node), count,
+                       memory::element_bytes<Key, Value>(), nodes ? 1 : 0);
+}
+
+template <typename Key, typename Value, typename Compare>
+typename ArenaAVLTree<Key, Value, Compare>::size_type
+ArenaAVLTree<Key, Value, Compare>::capacity() const {
+  return capacity_;
+}
+
+template <typename Key, typename Value, typename Compare>
+void ArenaAVLTree<Key, Value, Compare>::reserve(size_type n) {
+  if (n > max_size()) {
+    throw std::length_error("ArenaAVLTree::reserve: too many elements");
+  }
+  if (n > capacity_) {
+    relocate(static_cast<index_type>(n));
+  }
+}
+
+// Modifiers
+template <typename Key, typename Value, typename Compare>
+void ArenaAVLTree<Key, Value, Compare>::clear() {
+  destroy_all();
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename D>
+std::pair<typename ArenaAVLTree<Key, Value, Compare>::Iterator, bool>
+ArenaAVLTree<Key, Value, Compare>::insert_data(D&& data, bool multi) {
+  index_type p;
+  bool left;
+  index_type equal = find_slot(data.first, multi, &p, &left);
+  if (equal != kNil) {
+    return std::make_pair(Iterator(this, equal), false);
+  }
+  index_type i = attach(p, left, std::forward<D>(data));
+  return std::make_pair(Iterator(this, i), true);
+}
+
+template <typename Key, typename Value, typename Compare>
+std::pair<typename ArenaAVLTree<Key, Value, Compare>::Iterator, bool>
+ArenaAVLTree<Key, Value, Compare>::insert(const data_type& data,
+                                          bool multi) {
+  return insert_data(data, multi);
+}
+
+template <typename Key, typename Value, typename Compare>
+std::pair<typename ArenaAVLTree<Key, Value, Compare>::Iterator, bool>
+ArenaAVLTree<Key, Value, Compare>::insert(data_type&& data, bool multi) {
+  return insert_data(std::move(data), multi);
+}
+
+// Builds the element in a fresh slot and hands the slot back if the key
+// turns out to be taken.
+template <typename Key, typename Value, typename Compare>
+template <typename... Args>
+std::pair<typename ArenaAVLTree<Key, Value, Compare>::Iterator, bool>
+ArenaAVLTree<Key, Value, Compare>::emplace(bool multi, Args&&... args) {
+  index_type i = allocate(std::forward<Args>(args)...);
+  index_type p;
+  bool left;
+  index_type equal = find_slot(node_key(i), multi, &p, &left);
+  if (equal != kNil) {
+    deallocate(i);
+    return std::make_pair(Iterator(this, equal), false);
+  }
+  return std::make_pair(Iterator(this, link(p, left, i)), true);
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename K, typename... Args>
+std::pair<typename ArenaAVLTree<Key, Value, Compare>::Iterator, bool>
+ArenaAVLTree<Key, Value, Compare>::try_emplace(K&& key, Args&&... args) {
+  index_type p;
+  bool left;
+  index_type equal = find_slot(key, false, &p, &left);
+  if (equal != kNil) {
+    return std::make_pair(Iterator(this, equal), false);
+  }
+  index_type i = attach(p, left, std::piecewise_construct,
+                        std::forward_as_tuple(std::forward<K>(key)),
+                        std::forward_as_tuple(std::forward<Args>(args)...));
+  return std::make_pair(Iterator(this, i), true);
+}
+
+// Moves the element in; the handle keeps it when a unique insert finds the
+// key taken.
+template <typename Key, typename Value, typename Compare>
+std::pair<typename ArenaAVLTree<Key, Value, Compare>::Iterator, bool>
+ArenaAVLTree<Key, Value, Compare>::insert(node_type& node, bool multi) {
+  if (node.empty()) {
+    return std::make_pair(end(), false);
+  }
+  std::pair<Iterator, bool> result = insert_data(std::move(*node.data), multi);
+  if (result.second) node.data.reset();
+  return result;
+}
+
+// Same policy as AVLTree: accept the slot right before or right after hint
+// when the key fits there, otherwise descend from the root.
+template <typename Key, typename Value, typename Compare>
+template <typename D>
+std::pair<typename ArenaAVLTree<Key, Value, Compare>::Iterator, bool>
+ArenaAVLTree<Key, Value, Compare>::insert_hint_data(Iterator hint, D&& data,
+                                                    bool multi) {
+  const Key& key = data.first;
+  index_type pos = hint.index;
+  if (pos != kNil && comp(node_key(pos), key)) {
+    index_type next = successor(pos);
+    if (next == kNil || (multi ? !comp(node_key(next), key)
+                               : comp(key, node_key(next)))) {
+      index_type i = attach_between(pos, next, std::forward<D>(data));
+      return std::make_pair(Iterator(this, i), true);
+    }
+    return insert_data(std::forward<D>(data), multi);
+  }
+  if (pos != kNil && !multi && !comp(key, node_key(pos))) {
+    return std::make_pair(Iterator(this, pos), false);
+  }
+  index_type prev = pos == kNil ? rightmost : predecessor(pos);
+  if (prev == kNil || (multi ? !comp(key, node_key(prev))
+                             : comp(node_key(prev), key))) {
+    index_type i = attach_between(prev, pos, std::forward<D>(data));
+    return std::make_pair(Iterator(this, i), true);
+  }
+  return insert_data(std::forward<D>(data), multi);
+}
+
+template <typename Key, typename Value, typename Compare>
+std::pair<typename ArenaAVLTree<Key, Value, Compare>::Iterator, bool>
+ArenaAVLTree<Key, Value, Compare>::insert(Iterator hint,
+                                          const data_type& data,
+                                          bool multi) {
+  return insert_hint_data(hint, data, multi);
+}
+
+template <typename Key, typename Value, typename Compare>
+std::pair<typename ArenaAVLTree<Key, Value, Compare>::Iterator, bool>
+ArenaAVLTree<Key, Value, Compare>::insert(Iterator hint, data_type&& data,
+                                          bool multi) {
+  return insert_hint_data(hint, std::move(data), multi);
+}
+
+template <typename Key, typename Value, typename Compare>
+void ArenaAVLTree<Key, Value, Compare>::erase(Iterator pos) {
+  if (pos.index != kNil) {
+    erase_node(pos.index);
+  }
+}
+
+template <typename Key, typename Value, typename Compare>
+typename ArenaAVLTree<Key, Value, Compare>::node_type
+ArenaAVLTree<Key, Value, Compare>::extract(Iterator pos) {
+  if (pos.index == kNil) {
+    return node_type();
+  }
+  node_type node(std::move(nodes[pos.index].data()));
+  erase_node(pos.index);
+  return node;
+}
+
+// Erasing a node never moves the others, so last stays valid throughout.
+template <typename Key, typename Value, typename Compare>
+typename ArenaAVLTree<Key, Value, Compare>::Iterator
+ArenaAVLTree<Key, Value, Compare>::erase(Iterator first, Iterator last) {
+  while (first != last) {
+    index_type i = first.index;
+    ++first;
+    erase_node(i);
+  }
+  return last;
+}
+
+template <typename Key, typename Value, typename Compare>
+void ArenaAVLTree<Key, Value, Compare>::swap(ArenaAVLTree& other) {
+  std::swap(nodes, other.nodes);
+  std::swap(used, other.used);
+  std::swap(capacity_, other.capacity_);
+  std::swap(free_head, other.free_head);
+  std::swap(root, other.root);
+  std::swap(leftmost, other.leftmost);
+  std::swap(rightmost, other.rightmost);
+  std::swap(count, other.count);
+  std::swap(comp, other.comp);
+}
+
+template <typename Key, typename Value, typename Compare>
+void ArenaAVLTree<Key, Value, Compare>::merge(ArenaAVLTree& other,
+                                              bool multi) {
+  if (this == &other) {
+    return;
+  }
+  for (auto it = other.begin(); it != other.end();) {
+    index_type i = it.index;
+    ++it;
+    index_type p;
+    bool left;
+    if (find_slot(other.node_key(i), multi, &p, &left) == kNil) {
+      attach(p, left, std::move(other.nodes[i].data()));
+      other.erase_node(i);
+    }
+  }
+}
+
+// The tail is built in a fresh arena and then dropped from the back of this
+// one, where every erase unlinks a node with no right child.
+template <typename Key, typename Value, typename Compare>
+ArenaAVLTree<Key, Value, Compare> ArenaAVLTree<Key, Value, Compare>::split(
+    Iterator pos) {
+  ArenaAVLTree tail(comp);
+  size_t moved = 0;
+  for (Iterator it = pos; it != end(); ++it) ++moved;
+  if (!moved) {
+    return tail;
+  }
+  auto next = [&pos]() { return std::move(*pos++); };
+  tail.rebuild(moved, next);
+  for (size_t i = 0; i < moved; ++i) {
+    erase_node(rightmost);
+  }
+  return tail;
+}
+
+// Appends (or prepends) the elements of other one by one at the end of the
+// tree that faces it, which needs no search.
+template <typename Key, typename Value, typename Compare>
+bool ArenaAVLTree<Key, Value, Compare>::join(ArenaAVLTree& other,
+                                             bool multi) {
+  if (this == &other) {
+    return false;
+  }
+  if (other.empty()) {
+    return true;
+  }
+  if (empty()) {
+    swap(other);
+    return true;
+  }
+  auto before = [this, multi](const Key& a, const Key& b) {
+    return multi ? !comp(b, a) : comp(a, b);
+  };
+  if (before(node_key(rightmost), other.node_key(other.leftmost))) {
+    for (index_type i = other.leftmost; i != kNil; i = other.successor(i)) {
+      attach(rightmost, false, std::move(other.nodes[i].data()));
+    }
+  } else if (before(other.node_key(other.rightmost), node_key(leftmost))) {
+    for (index_type i = other.rightmost; i != kNil; i = other.predecessor(i)) {
+      attach(leftmost, true, std::move(other.nodes[i].data()));
+    }
+  } else {
+    return false;
+  }
+  other.clear();
+  return true;
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename InputIt>
+void ArenaAVLTree<Key, Value, Compare>::assign(InputIt first, InputIt last,
+                                               bool multi) {
+  bulk::assign<Key, Value>(
+      first, last, multi,
+      [this](const auto& a, const auto& b) { return key_less(a, b); },
+      [this](size_t n, auto& next) { rebuild(n, next); });
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename ForwardIt>
+void ArenaAVLTree<Key, Value, Compare>::assign_sorted(ForwardIt first,
+                                                      ForwardIt last,
+                                                      bool multi) {
+  bulk::assign_sorted<Key, Value>(
+      first, last, multi,
+      [this](const auto& a, const auto& b) { return key_less(a, b); },
+      [this](size_t n, auto& next) { rebuild(n, next); });
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename InputIt>
+void ArenaAVLTree<Key, Value, Compare>::assign_parallel(InputIt first,
+                                                        InputIt last,
+                                                        bool multi,
+                                                        bulk::Keep keep,
+                                                        unsigned threads) {
+  bulk::assign_parallel<Key, Value>(
+      first, last, multi, keep, threads,
+      [this](const auto& a, const auto& b) { return key_less(a, b); },
+      [this](size_t n, auto& next) { rebuild(n, next); });
+}
+
+// Lookup
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+typename ArenaAVLTree<Key, Value, Compare>::Iterator
+ArenaAVLTree<Key, Value, Compare>::lower_bound(const K& key) {
+  return Iterator(this, lower_bound_node(key));
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+typename ArenaAVLTree<Key, Value, Compare>::Iterator
+ArenaAVLTree<Key, Value, Compare>::upper_bound(const K& key) {
+  return Iterator(this, upper_bound_node(key));
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+typename ArenaAVLTree<Key, Value, Compare>::Iterator
+ArenaAVLTree<Key, Value, Compare>::find(const K& key) {
+  index_type i = lower_bound_node(key);
+  if (i != kNil && !comp(key, node_key(i))) {
+    return Iterator(this, i);
+  }
+  return end();
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+bool ArenaAVLTree<Key, Value, Compare>::contains(const K& key) {
+  return find(key) != end();
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename ForwardIt, typename Emit>
+void ArenaAVLTree<Key, Value, Compare>::find_many(ForwardIt first,
+                                                  ForwardIt last, Emit emit) {
+  ForwardIt keys[kBatch];
+  index_type current[kBatch];
+  index_type result[kBatch];
+  while (first != last) {
+    size_t n = 0;
+    for (; n < kBatch && first != last; ++n, ++first) {
+      keys[n] = first;
+      current[n] = root;
+      result[n] = kNil;
+    }
+    for (bool active = true; active;) {
+      active = false;
+      for (size_t i = 0; i < n; ++i) {
+        index_type node = current[i];
+        if (node == kNil) continue;
+        if (!comp(node_key(node), *keys[i])) {
+          result[i] = node;
+          node = nodes[node].left;
+        } else {
+          node = nodes[node].right;
+        }
+        current[i] = node;
+        if (node != kNil) {
+          __builtin_prefetch(&nodes[node]);
+          active = true;
+        }
+      }
+    }
+    for (size_t i = 0; i < n; ++i) {
+      index_type node = result[i];
+      if (node != kNil && !comp(*keys[i], node_key(node))) {
+        emit(Iterator(this, node));
+      } else {
+        emit(end());
+      }
+    }
+  }
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_CONTAINERS_S21_ARENA_AVLTREE_TPP_
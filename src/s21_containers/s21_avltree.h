@@ -3,63 +3,105 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <functional>
+#include <iterator>
 #include <limits>
+#include <tuple>
 #include <utility>
 
+#include "s21_bulk_load.h"
+#include "s21_instrument.h"
+#include "s21_memory_stats.h"
+#include "s21_vector.h"
+
 namespace s21 {
 
-template <typename Key, typename Value>
+template <typename Key, typename Value, typename Compare = std::less<Key>>
 class AVLTree {
  private:
-  struct Node {
-    std::pair<Key, Value> data;
-    Node* left;
-    Node* right;
-    Node* parent;
+  // links, height and the number of nodes in the subtree; the header is a
+  // bare NodeBase with height and size 0
+  struct NodeBase {
+    NodeBase* left;
+    NodeBase* right;
+    NodeBase* parent;
     int height;
-    Node(const Key& k, const Value& v)
-        : data(k, v),
-          left(nullptr),
-          right(nullptr),
-          parent(nullptr),
-          height(1) {}
-    Node(const Key& k, const Value& v, Node* l = nullptr, Node* r = nullptr,
-         Node* p = nullptr, int h = 1)
-        : data(k, v), left(l), right(r), parent(p), height(h) {}
-    Node& operator=(const Node& other) {
-      if (this != &other) {
-        this->data = other.data;
-        this->left = other.left;
-        this->right = other.right;
-        this->parent = other.parent;
-        this->height = other.height;
-      }
-      return *this;
-    }
-    Node()
-        : data(), left(nullptr), right(nullptr), parent(nullptr), height(0) {}
+    size_t size;
+    NodeBase(NodeBase* l, NodeBase* r, NodeBase* p, int h, size_t s)
+        : left(l), right(r), parent(p), height(h), size(s) {}
+  };
+  // a detached leaf whose element is built in place from the arguments of
+  // a pair constructor
+  struct Node : NodeBase {
+    std::pair<Key, Value> data;
+    template <typename... Args>
+    explicit Node(Args&&... args)
+        : NodeBase(nullptr, nullptr, nullptr, 1, 1),
+          data(std::forward<Args>(args)...) {}
   };
 
-  Node* root;
+  // The header stands in for end(): header.left is the root, whose parent is
+  // the header, header.parent caches the leftmost node and header.right the
+  // rightmost one. In an empty tree both caches point at the header itself.
+  NodeBase header;
+  size_t count;
+  instrument::compare_t<Compare, instrument::family::avl_tree> comp;
+  using hooks = instrument::Hooks<instrument::family::avl_tree>;
 
   // helper methods
-  int height(Node* node);
-  int balance_factor(Node* node);
-  Node* rotate_right(Node* y);
-  Node* rotate_left(Node* x);
-  Node* balance(Node* node);
-  Node* insert(Node* node, const std::pair<Key, Value>& data, Node** newNode,
-               Node* parent = nullptr);
-  Node* find_min(Node* node);
-  Node* erase(Node* node, const Key& key);
-  void clear(Node* node);
-  Node* clone(Node* node, Node* parent);
-  void swap(Node*& a, Node*& b);
-  size_t size(Node* node) const;
+  NodeBase* root() const { return header.left; }
+  NodeBase* end_node() const { return const_cast<NodeBase*>(&header); }
+  void set_root(NodeBase* node);
+  static const Key& node_key(const NodeBase* node) {
+    return static_cast<const Node*>(node)->data.first;
+  }
+  int height(NodeBase* node);
+  static size_t subtree_size(const NodeBase* node) {
+    return node ? node->size : 0;
+  }
+  void refresh(NodeBase* node);
+  int balance_factor(NodeBase* node);
+  NodeBase* rotate_right(NodeBase* y);
+  NodeBase* rotate_left(NodeBase* x);
+  NodeBase* balance(NodeBase* node);
+  void retrace(NodeBase* node);
+  NodeBase* join_around(NodeBase* left, NodeBase* pivot, NodeBase* right);
+  void split_around(NodeBase* node, NodeBase** left, NodeBase** right);
+  void replace_child(NodeBase* parent, NodeBase* old_child,
+                     NodeBase* new_child);
+  void unlink(NodeBase* node);
+  void erase_node(NodeBase* node);
+  NodeBase* link(NodeBase* parent, bool left, NodeBase* node);
+  template <typename... Args>
+  NodeBase* attach(NodeBase* parent, bool left, Args&&... args);
+  template <typename... Args>
+  NodeBase* attach_between(NodeBase* prev, NodeBase* next, Args&&... args);
+  static NodeBase* find_min(NodeBase* node);
+  static NodeBase* find_max(NodeBase* node);
+  static NodeBase* predecessor(NodeBase* node);
+  static NodeBase* successor(NodeBase* node);
+  NodeBase* find_slot(const Key& key, bool multi, NodeBase** parent,
+                      bool* left);
+  template <typename K>
+  NodeBase* lower_bound_node(const K& key) const;
+  template <typename K>
+  NodeBase* upper_bound_node(const K& key) const;
+  void clear(NodeBase* node);
+  NodeBase* clone(NodeBase* node, NodeBase* parent);
+
+  // bulk construction
+  using traits = bulk::input_traits<Key, Value>;
+  template <typename T, typename U>
+  bool key_less(const T& a, const U& b) const;
+  template <typename Next>
+  NodeBase* build(size_t n, NodeBase* parent, Next& next);
+  template <typename Next>
+  void rebuild(size_t n, Next& next);
 
  public:
   class Iterator;
   class ConstIterator;
+  class NodeHandle;
   using key_type = Key;
   using value_type = Value;
   using size_type = size_t;
@@ -67,16 +109,22 @@ class AVLTree {
   using const_reference = const value_type&;
   using iterator = Iterator;
   using const_iterator = ConstIterator;
+  using node_type = NodeHandle;
 
  public:
   class Iterator {
    public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
     using value_type = std::pair<Key, Value>;
+    using pointer = value_type*;
     using reference = value_type&;
     Iterator() : current(nullptr) {}
-    explicit Iterator(Node* node) : current(node) {}
+    explicit Iterator(NodeBase* node) : current(node) {}
     Iterator& operator++();  // Оператор для перехода к следующему элементу
     Iterator operator++(int);
+    Iterator& operator--();
+    Iterator operator--(int);
     Iterator(const Iterator& other) { current = other.current; }
     Iterator& operator=(const Iterator& other) {
       if (this != &other) {
@@ -89,26 +137,59 @@ class AVLTree {
     bool operator==(const Iterator& other) const;
     reference operator*() const;  // Оператор разыменования
    protected:
-    Node* current;
+    NodeBase* current;
+    friend class AVLTree;
   };
 
   class ConstIterator : public Iterator {
    public:
     using Iterator::Iterator;
     ConstIterator() : Iterator() {}
-    const_reference operator*() const {
+    ConstIterator(const Iterator& it) : Iterator(it) {}
+    const typename Iterator::value_type& operator*() const {
       return Iterator::operator*();
     };  // Оператор разыменования
+  };
+
+  // Owns a node taken out of the tree by extract. The node keeps its
+  // allocation, so inserting it into another tree neither allocates nor
+  // copies. A set reads its element through value(), a map through key()
+  // and mapped(); the key may be changed while the node is detached.
+  class NodeHandle {
+   public:
+    NodeHandle() : node(nullptr) {}
+    NodeHandle(NodeHandle&& other) noexcept : node(other.node) {
+      other.node = nullptr;
+    }
+    NodeHandle& operator=(NodeHandle&& other) noexcept {
+      if (this != &other) {
+        delete node;
+        node = other.node;
+        other.node = nullptr;
+      }
+      return *this;
+    }
+    ~NodeHandle() { delete node; }
+    bool empty() const { return !node; }
+    explicit operator bool() const { return node; }
+    Key& key() const { return node->data.first; }
+    Value& mapped() const { return node->data.second; }
+    Key& value() const { return node->data.first; }
+    void swap(NodeHandle& other) { std::swap(node, other.node); }
 
    private:
-    Node* current;
+    explicit NodeHandle(Node* taken) : node(taken) {}
+    Node* node;
+    friend class AVLTree;
   };
 
  public:
   // constructors
-  AVLTree() : root(nullptr) {}
+  AVLTree() : AVLTree(Compare()) {}
+  explicit AVLTree(const Compare& compare)
+      : header(nullptr, &header, &header, 0, 0), count(0), comp(compare) {}
   AVLTree(std::initializer_list<value_type> const& items);
-  AVLTree(const AVLTree& tree) : root(clone(tree.root, nullptr)) {}
+  AVLTree(const AVLTree& tree);
   AVLTree(AVLTree&& tree) noexcept;
 
   // destractor
@@ -116,7 +197,7 @@ class AVLTree {
 
   // assignment
   AVLTree& operator=(const AVLTree& tree);
-  AVLTree& operator=(AVLTree& tree) noexcept;
+  AVLTree& operator=(AVLTree&& tree) noexcept;
 
   // Iterators
   Iterator begin();
@@ -128,22 +209,74 @@ class AVLTree {
   bool empty() const;
   size_type size() const;
   size_type max_size() const;
+  MemoryStats memory_stats() const;
+  size_type memory_usage() const { return memory_stats().total(); }
 
   // modifiers
   void clear();
   std::pair<Iterator, bool> insert(const std::pair<Key, Value>& data,
                                    bool multi);
+  std::pair<Iterator, bool> insert(std::pair<Key, Value>&& data, bool multi);
+  std::pair<Iterator, bool> insert(Iterator hint,
+                                   const std::pair<Key, Value>& data,
+                                   bool multi);
+  std::pair<Iterator, bool> insert(Iterator hint, std::pair<Key, Value>&& data,
+                                   bool multi);
+  // emplace builds the element before looking for its place; try_emplace
+  // looks first and builds it from key and args only if the key is new
+  template <typename... Args>
+  std::pair<Iterator, bool> emplace(bool multi, Args&&... args);
+  template <typename K, typename... Args>
+  std::pair<Iterator, bool> try_emplace(K&& key, Args&&... args);
   void erase(Iterator pos);
+  Iterator erase(Iterator first, Iterator last);
+  node_type extract(Iterator pos);
+  std::pair<Iterator, bool> insert(node_type& node, bool multi);
   void swap(AVLTree& other);
   void merge(AVLTree& other, bool multi);
+  // split moves [pos, end()) into the returned tree; join takes all of
+  // other if its keys sort entirely after or before ours (ties only with
+  // multi) and reports whether it did. Both relink O(log n) nodes, and
+  // the subtree sizes give the size of each half without a walk.
+  AVLTree split(Iterator pos);
+  bool join(AVLTree& other, bool multi);
+  template <typename InputIt>
+  void assign(InputIt first, InputIt last, bool multi);
+  template <typename ForwardIt>
+  void assign_sorted(ForwardIt first, ForwardIt last, bool multi);
+  // assign with the sort spread over up to threads threads; keep picks
+  // the element that stays of each key unless multi is set
+  template <typename InputIt>
+  void assign_parallel(InputIt first, InputIt last, bool multi,
+                       bulk::Keep keep, unsigned threads);
 
-  // lookup
-  Iterator find(const key_type& key);
-  bool contains(const key_type& key);
+  // lookup: K is key_type or, with a transparent Compare, anything that
+  // compares against it
+  template <typename K>
+  Iterator lower_bound(const K& key);
+  template <typename K>
+  Iterator upper_bound(const K& key);
+  template <typename K>
+  Iterator find(const K& key);
+  template <typename K>
+  bool contains(const K& key);
+  // find for every key of [first, last), handed to emit(Iterator) in
+  // order. kBatch searches descend in lockstep and each step prefetches
+  // the next node of every search, so their cache misses overlap instead
+  // of following one another.
+  template <typename ForwardIt, typename Emit>
+  void find_many(ForwardIt first, ForwardIt last, Emit emit);
 
-  // multiset
-  Node* mul_insert(Node* node, const std::pair<Key, Value>& data,
-                   Node** newNode, Node* parent = nullptr);
+  // observers
+  Compare key_comp() const { return comp; }
+
+ private:
+  static constexpr size_t kBatch = 16;
+  template <typename D>
+  std::pair<Iterator, bool> insert_data(D&& data, bool multi);
+  template <typename D>
+  std::pair<Iterator, bool> insert_hint_data(Iterator hint, D&& data,
+                                             bool multi);
 };
 
 }  // namespace s21
@@ -5,49 +5,74 @@
 
 namespace s21 {
 
-template <typename Key, typename Value>
-int AVLTree<Key, Value>::height(Node* node) {
+template <typename Key, typename Value, typename Compare>
+void AVLTree<Key, Value, Compare>::set_root(NodeBase* node) {
+  header.left = node;
+  if (node) {
+    node->parent = &header;
+    header.parent = find_min(node);
+    header.right = find_max(node);
+  } else {
+    header.parent = header.right = &header;
+  }
+}
+
+template <typename Key, typename Value, typename Compare>
+int AVLTree<Key, Value, Compare>::height(NodeBase* node) {
   return node ? node->height : 0;
 }
 
-template <typename Key, typename Value>
-int AVLTree<Key, Value>::balance_factor(Node* node) {
+// recomputes height and size from the children
+template <typename Key, typename Value, typename Compare>
+void AVLTree<Key, Value, Compare>::refresh(NodeBase* node) {
+  node->height = std::max(height(node->left), height(node->right)) + 1;
+  node->size = subtree_size(node->left) + subtree_size(node->right) + 1;
+}
+
+template <typename Key, typename Value, typename Compare>
+int AVLTree<Key, Value, Compare>::balance_factor(NodeBase* node) {
   return node ? height(node->right) - height(node->left) : 0;
 }
 
-template <typename Key, typename Value>
-typename AVLTree<Key, Value>::Node* AVLTree<Key, Value>::rotate_right(Node* y) {
-  Node* x = y->left;
-  Node* T = x->right;
+template <typename Key, typename Value, typename Compare>
+typename AVLTree<Key, Value, Compare>::NodeBase*
+AVLTree<Key, Value, Compare>::rotate_right(NodeBase* y) {
+  hooks::rotated();
+  NodeBase* x = y->left;
+  NodeBase* T = x->right;
   x->right = y;
   y->left = T;
   if (T) T->parent = y;
   if (y->left) y->left->parent = y;
   x->parent = y->parent;
   y->parent = x;
-  y->height = std::max(height(y->left), height(y->right)) + 1;
-  x->height = std::max(height(x->left), height(x->right)) + 1;
+  refresh(y);
+  refresh(x);
   return x;
 }
 
-template <typename Key, typename Value>
-typename AVLTree<Key, Value>::Node* AVLTree<Key, Value>::rotate_left(Node* x) {
-  Node* y = x->right;
-  Node* T = y->left;
+template <typename Key, typename Value, typename Compare>
+typename AVLTree<Key, Value, Compare>::NodeBase*
+AVLTree<Key, Value, Compare>::rotate_left(NodeBase* x) {
+  hooks::rotated();
+  NodeBase* y = x->right;
+  NodeBase* T = y->left;
   y->left = x;
   x->right = T;
   if (x->right) x->right->parent = x;
   y->parent = x->parent;
   x->parent = y;
   if (T) T->parent = x;
-  x->height = std::max(height(x->left), height(x->right)) + 1;
-  y->height = std::max(height(y->left), height(y->right)) + 1;
+  refresh(x);
+  refresh(y);
   return y;
 }
 
-template <typename Key, typename Value>
-typename AVLTree<Key, Value>::Node* AVLTree<Key, Value>::balance(Node* node) {
-  node->height = std::max(height(node->left), height(node->right)) + 1;
+template <typename Key, typename Value, typename Compare>
+typename AVLTree<Key, Value, Compare>::NodeBase*
+AVLTree<Key, Value, Compare>::balance(NodeBase* node) {
+  hooks::rebalanced();
+  refresh(node);
   int balance = balance_factor(node);
   // Left Heavy
   if (balance > 1) {
@@ -70,339 +95,914 @@ typename AVLTree<Key, Value>::Node* AVLTree<Key, Value>::balance(Node* node) {
   return node;
 }
 
-template <typename Key, typename Value>
-typename AVLTree<Key, Value>::Node* AVLTree<Key, Value>::find_min(Node* node) {
+// Rebalances the path from node up to the root after one of its subtrees
+// grew or shrank. Rebalancing stops as soon as a subtree keeps its old
+// height, because no height above it can have changed; from there on only
+// the sizes are counted up to the root.
+template <typename Key, typename Value, typename Compare>
+void AVLTree<Key, Value, Compare>::retrace(NodeBase* node) {
+  while (node != &header) {
+    NodeBase* parent = node->parent;
+    int old_height = node->height;
+    NodeBase* subtree = balance(node);
+    replace_child(parent, node, subtree);
+    node = parent;
+    if (subtree->height == old_height) {
+      break;
+    }
+  }
+  for (; node != &header; node = node->parent) {
+    node->size = subtree_size(node->left) + subtree_size(node->right) + 1;
+  }
+}
+
+// Joins two detached subtrees around pivot, which sorts after every node of
+// left and before every node of right. The pivot goes down the spine of the
+// taller subtree to the first node no more than one level taller than the
+// other subtree, so the work is proportional to their height difference.
+// The returned root has no parent.
+template <typename Key, typename Value, typename Compare>
+typename AVLTree<Key, Value, Compare>::NodeBase*
+AVLTree<Key, Value, Compare>::join_around(NodeBase* left, NodeBase* pivot,
+                                          NodeBase* right) {
+  if (left) left->parent = nullptr;
+  if (right) right->parent = nullptr;
+  NodeBase* parent = nullptr;
+  bool on_left = false;
+  if (height(left) > height(right) + 1) {
+    while (height(left) > height(right) + 1) {
+      parent = left;
+      left = left->right;
+    }
+  } else if (height(right) > height(left) + 1) {
+    on_left = true;
+    while (height(right) > height(left) + 1) {
+      parent = right;
+      right = right->left;
+    }
+  }
+  pivot->left = left;
+  pivot->right = right;
+  if (left) left->parent = pivot;
+  if (right) right->parent = pivot;
+  refresh(pivot);
+  pivot->parent = parent;
+  if (!parent) {
+    return pivot;
+  }
+  if (on_left) {
+    parent->left = pivot;
+  } else {
+    parent->right = pivot;
+  }
+  NodeBase* top = parent;
+  for (NodeBase* node = parent; node;) {
+    NodeBase* up = node->parent;
+    top = balance(node);
+    if (up) replace_child(up, node, top);
+    node = up;
+  }
+  return top;
+}
+
+// Takes node out of its tree and splits the rest into the subtree before it
+// and the subtree after it. Every ancestor on the way up becomes the pivot
+// that joins its other subtree to one of the two halves; the height
+// differences telescope, so the whole split is O(log n). The header is left
+// stale and both halves come back without a parent.
+template <typename Key, typename Value, typename Compare>
+void AVLTree<Key, Value, Compare>::split_around(NodeBase* node,
+                                                NodeBase** left,
+                                                NodeBase** right) {
+  NodeBase* below = node->left;
+  NodeBase* above = node->right;
+  if (below) below->parent = nullptr;
+  if (above) above->parent = nullptr;
+  NodeBase* child = node;
+  NodeBase* up = node->parent;
+  while (up && up != &header) {
+    NodeBase* next = up->parent;
+    if (up->left == child) {
+      above = join_around(above, up, up->right);
+    } else {
+      below = join_around(up->left, up, below);
+    }
+    child = up;
+    up = next;
+  }
+  *left = below;
+  *right = above;
+}
+
+// The root is the header's left child, so this also replaces the root.
+template <typename Key, typename Value, typename Compare>
+void AVLTree<Key, Value, Compare>::replace_child(NodeBase* parent,
+                                                 NodeBase* old_child,
+                                                 NodeBase* new_child) {
+  if (parent->left == old_child) {
+    parent->left = new_child;
+  } else {
+    parent->right = new_child;
+  }
+  if (new_child) new_child->parent = parent;
+}
+
+// Unlinks node without freeing it. A node with two children is replaced by
+// its in-order successor, which is relinked rather than copied, so iterators
+// to every other element stay valid.
+template <typename Key, typename Value, typename Compare>
+void AVLTree<Key, Value, Compare>::unlink(NodeBase* node) {
+  if (node == header.parent) header.parent = successor(node);
+  if (node == header.right) header.right = predecessor(node);
+  NodeBase* lowest = nullptr;
+  if (!node->left || !node->right) {
+    lowest = node->parent;
+    replace_child(node->parent, node, node->left ? node->left : node->right);
+  } else {
+    NodeBase* successor = find_min(node->right);
+    if (successor->parent == node) {
+      lowest = successor;
+    } else {
+      lowest = successor->parent;
+      replace_child(successor->parent, successor, successor->right);
+      successor->right = node->right;
+      successor->right->parent = successor;
+    }
+    successor->left = node->left;
+    successor->left->parent = successor;
+    successor->height = node->height;
+    replace_child(node->parent, node, successor);
+  }
+  --count;
+  retrace(lowest);
+}
+
+template <typename Key, typename Value, typename Compare>
+void AVLTree<Key, Value, Compare>::erase_node(NodeBase* node) {
+  unlink(node);
+  hooks::deallocated();
+  delete static_cast<Node*>(node);
+}
+
+// Links node as a new leaf under parent (the header when the tree is empty),
+// keeps the cached ends up to date and rebalances the path above it.
+template <typename Key, typename Value, typename Compare>
+typename AVLTree<Key, Value, Compare>::NodeBase*
+AVLTree<Key, Value, Compare>::link(NodeBase* parent, bool left,
+                                   NodeBase* node) {
+  node->left = node->right = nullptr;
+  node->parent = parent;
+  node->height = 1;
+  node->size = 1;
+  if (left) {
+    parent->left = node;
+  } else {
+    parent->right = node;
+  }
+  if (parent == &header) {
+    header.parent = header.right = node;
+  } else if (left && parent == header.parent) {
+    header.parent = node;
+  } else if (!left && parent == header.right) {
+    header.right = node;
+  }
+  ++count;
+  retrace(parent);
+  return node;
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename... Args>
+typename AVLTree<Key, Value, Compare>::NodeBase*
+AVLTree<Key, Value, Compare>::attach(NodeBase* parent, bool left,
+                                     Args&&... args) {
+  hooks::allocated();
+  return link(parent, left, new Node(std::forward<Args>(args)...));
+}
+
+// prev and next are in-order neighbours (prev is null before the first
+// element, next is the header after the last one), so one of them always
+// has a free slot on the side facing the other.
+template <typename Key, typename Value, typename Compare>
+template <typename... Args>
+typename AVLTree<Key, Value, Compare>::NodeBase*
+AVLTree<Key, Value, Compare>::attach_between(NodeBase* prev, NodeBase* next,
+                                             Args&&... args) {
+  if (prev && !prev->right) {
+    return attach(prev, false, std::forward<Args>(args)...);
+  }
+  return attach(next, true, std::forward<Args>(args)...);
+}
+
+template <typename Key, typename Value, typename Compare>
+typename AVLTree<Key, Value, Compare>::NodeBase*
+AVLTree<Key, Value, Compare>::find_min(NodeBase* node) {
   while (node && node->left) {
     node = node->left;
   }
   return node;
 }
 
-template <typename Key, typename Value>
-typename AVLTree<Key, Value>::Node* AVLTree<Key, Value>::erase(Node* node,
-                                                               const Key& key) {
-  if (!node) {
-    return nullptr;
+template <typename Key, typename Value, typename Compare>
+typename AVLTree<Key, Value, Compare>::NodeBase*
+AVLTree<Key, Value, Compare>::find_max(NodeBase* node) {
+  while (node && node->right) {
+    node = node->right;
   }
-  if (key < node->data.first) {
-    node->left = erase(node->left, key);
-  } else if (key > node->data.first) {
-    node->right = erase(node->right, key);
-  } else {
-    if (!node->left || !node->right) {
-      Node* temp = node->left ? node->left : node->right;
-      if (!temp) {
-        temp = node;
-        node = nullptr;
-      } else {
-        temp->parent = node->parent;
-        *node = *temp;
-      }
-      delete temp;
+  return node;
+}
+
+// Must not be called on the leftmost node, unless it is the only one.
+template <typename Key, typename Value, typename Compare>
+typename AVLTree<Key, Value, Compare>::NodeBase*
+AVLTree<Key, Value, Compare>::predecessor(NodeBase* node) {
+  if (node->left) {
+    return find_max(node->left);
+  }
+  while (node != node->parent->right) node = node->parent;
+  return node->parent;
+}
+
+// The successor of the rightmost node is the header, because the climb
+// stops at the root, which is the header's left child.
+template <typename Key, typename Value, typename Compare>
+typename AVLTree<Key, Value, Compare>::NodeBase*
+AVLTree<Key, Value, Compare>::successor(NodeBase* node) {
+  if (node->right) {
+    return find_min(node->right);
+  }
+  while (node != node->parent->left) node = node->parent;
+  return node->parent;
+}
+
+// first node whose key is not less than key
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+typename AVLTree<Key, Value, Compare>::NodeBase*
+AVLTree<Key, Value, Compare>::lower_bound_node(const K& key) const {
+  NodeBase* current = root();
+  NodeBase* result = end_node();
+  while (current) {
+    if (!comp(node_key(current), key)) {
+      result = current;
+      current = current->left;
     } else {
-      Node* temp = find_min(node->right);
-      node->data = temp->data;
-      node->right = erase(node->right, temp->data.first);
+      current = current->right;
     }
   }
-  if (!node) {
-    return nullptr;
+  return result;
+}
+
+// first node whose key is greater than key
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+typename AVLTree<Key, Value, Compare>::NodeBase*
+AVLTree<Key, Value, Compare>::upper_bound_node(const K& key) const {
+  NodeBase* current = root();
+  NodeBase* result = end_node();
+  while (current) {
+    if (comp(key, node_key(current))) {
+      result = current;
+      current = current->left;
+    } else {
+      current = current->right;
+    }
+  }
+  return result;
+}
+
+// Descends once with a single comparison per node. A unique insert follows
+// the lower_bound path and checks the last candidate for equality at the
+// bottom; a multi insert places the new element after its equal keys.
+// Returns the element that blocks a unique insert, or null with *parent and
+// *left naming the free slot.
+template <typename Key, typename Value, typename Compare>
+typename AVLTree<Key, Value, Compare>::NodeBase*
+AVLTree<Key, Value, Compare>::find_slot(const Key& key, bool multi,
+                                        NodeBase** parent, bool* left) {
+  *parent = &header;
+  *left = true;
+  NodeBase* candidate = nullptr;
+  for (NodeBase* current = root(); current;) {
+    *parent = current;
+    if (multi) {
+      *left = comp(key, node_key(current));
+    } else {
+      *left = !comp(node_key(current), key);
+      if (*left) candidate = current;
+    }
+    current = *left ? current->left : current->right;
+  }
+  if (candidate && !comp(key, node_key(candidate))) {
+    return candidate;
   }
-  return balance(node);
+  return nullptr;
 }
 
-template <typename Key, typename Value>
-void AVLTree<Key, Value>::clear(Node* node) {
+template <typename Key, typename Value, typename Compare>
+void AVLTree<Key, Value, Compare>::clear(NodeBase* node) {
   if (!node) {
     return;
   }
   clear(node->left);
   clear(node->right);
-  node->left = nullptr;
-  node->right = nullptr;
-  delete node;
+  hooks::deallocated();
+  delete static_cast<Node*>(node);
 }
 
-template <typename Key, typename Value>
-typename AVLTree<Key, Value>::Node* AVLTree<Key, Value>::clone(Node* node,
-                                                               Node* parent) {
+template <typename Key, typename Value, typename Compare>
+typename AVLTree<Key, Value, Compare>::NodeBase*
+AVLTree<Key, Value, Compare>::clone(NodeBase* node, NodeBase* parent) {
   if (!node) {
     return nullptr;
   }
-  Node* new_node =
-      new Node(node->data.first, node->data.second, nullptr, nullptr, parent);
-  new_node->left = clone(node->left, node);
-  new_node->right = clone(node->right, node);
+  NodeBase* new_node = new Node(static_cast<Node*>(node)->data);
+  hooks::allocated();
+  new_node->parent = parent;
+  new_node->height = node->height;
+  new_node->size = node->size;
+  new_node->left = clone(node->left, new_node);
+  new_node->right = clone(node->right, new_node);
   return new_node;
 }
 
-template <typename Key, typename Value>
-void AVLTree<Key, Value>::swap(Node*& a, Node*& b) {
-  Node* temp = a;
-  a = b;
-  b = temp;
+template <typename Key, typename Value, typename Compare>
+template <typename T, typename U>
+bool AVLTree<Key, Value, Compare>::key_less(const T& a, const U& b) const {
+  return comp(traits::key_of(a), traits::key_of(b));
 }
 
-template <typename Key, typename Value>
-typename AVLTree<Key, Value>::size_type AVLTree<Key, Value>::size(
-    Node* node) const {
-  if (!node) {
-    return 0;
+// Builds a perfectly balanced subtree from the next n elements: the left half
+// is built first, so the elements are consumed in order and every node is
+// created exactly once.
+template <typename Key, typename Value, typename Compare>
+template <typename Next>
+typename AVLTree<Key, Value, Compare>::NodeBase*
+AVLTree<Key, Value, Compare>::build(size_t n, NodeBase* parent, Next& next) {
+  if (n == 0) {
+    return nullptr;
   }
-  return size(node->left) + size(node->right) + 1;
+  size_t left_size = n / 2;
+  NodeBase* left = build(left_size, nullptr, next);
+  NodeBase* node = new Node(next());
+  hooks::allocated();
+  node->left = left;
+  node->parent = parent;
+  if (left) left->parent = node;
+  node->right = build(n - left_size - 1, node, next);
+  refresh(node);
+  return node;
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename Next>
+void AVLTree<Key, Value, Compare>::rebuild(size_t n, Next& next) {
+  NodeBase* built = build(n, nullptr, next);
+  clear(root());
+  set_root(built);
+  count = n;
 }
 
 // Оператор для перехода к следующему элементу
-template <typename Key, typename Value>
-typename AVLTree<Key, Value>::Iterator&
-AVLTree<Key, Value>::Iterator::operator++() {
-  if (current->right) {
+template <typename Key, typename Value, typename Compare>
+typename AVLTree<Key, Value, Compare>::Iterator&
+AVLTree<Key, Value, Compare>::Iterator::operator++() {
+  current = successor(current);
+  return *this;
+}
+
+template <typename Key, typename Value, typename Compare>
+typename AVLTree<Key, Value, Compare>::Iterator
+AVLTree<Key, Value, Compare>::Iterator::operator++(int) {
+  iterator it(*this);
+  ++(*this);
+  return it;
+}
+
+// end() is the header, which keeps the rightmost node in its right link
+template <typename Key, typename Value, typename Compare>
+typename AVLTree<Key, Value, Compare>::Iterator&
+AVLTree<Key, Value, Compare>::Iterator::operator--() {
+  if (current->height == 0) {
     current = current->right;
-    while (current->left) {
-      current = current->left;
-    }
   } else {
-    Node* parent = current->parent;
-    while (parent && current == parent->right) {
-      current = parent;
-      parent = parent->parent;
-    }
-    current = parent;
+    current = predecessor(current);
   }
   return *this;
 }
 
-template <typename Key, typename Value>
-typename AVLTree<Key, Value>::Iterator
-AVLTree<Key, Value>::Iterator::operator++(int) {
+template <typename Key, typename Value, typename Compare>
+typename AVLTree<Key, Value, Compare>::Iterator
+AVLTree<Key, Value, Compare>::Iterator::operator--(int) {
   iterator it(*this);
-  ++(*this);
+  --(*this);
   return it;
 }
 
 // Оператор сравнения для цикла
-template <typename Key, typename Value>
-bool AVLTree<Key, Value>::Iterator::operator!=(const Iterator& other) const {
+template <typename Key, typename Value, typename Compare>
+bool AVLTree<Key, Value, Compare>::Iterator::operator!=(
+    const Iterator& other) const {
   return current != other.current;
 }
 
-template <typename Key, typename Value>
-bool AVLTree<Key, Value>::Iterator::operator==(const Iterator& other) const {
+template <typename Key, typename Value, typename Compare>
+bool AVLTree<Key, Value, Compare>::Iterator::operator==(
+    const Iterator& other) const {
   return current == other.current;
 }
 
 // Оператор разыменования
-template <typename Key, typename Value>
-typename AVLTree<Key, Value>::Iterator::reference
-AVLTree<Key, Value>::Iterator::operator*() const {
-  if (current) {
-    return current->data;
+template <typename Key, typename Value, typename Compare>
+typename AVLTree<Key, Value, Compare>::Iterator::reference
+AVLTree<Key, Value, Compare>::Iterator::operator*() const {
+  if (current && current->height) {
+    return static_cast<Node*>(current)->data;
   } else {
     throw std::out_of_range("Dereferencing end() iterator");
   }
 }
 
 // contructors
-template <typename Key, typename Value>
-AVLTree<Key, Value>::AVLTree(std::initializer_list<value_type> const& items)
-    : root(nullptr) {
-  for (const auto& item : items) {
-    root = insert(root, item);
-  }
+template <typename Key, typename Value, typename Compare>
+AVLTree<Key, Value, Compare>::AVLTree(
+    std::initializer_list<value_type> const& items)
+    : AVLTree() {
+  assign(items.begin(), items.end(), false);
 }
 
-template <typename Key, typename Value>
-AVLTree<Key, Value>::AVLTree(AVLTree&& tree) noexcept : root(nullptr) {
-  swap(root, tree.root);
+template <typename Key, typename Value, typename Compare>
+AVLTree<Key, Value, Compare>::AVLTree(const AVLTree& tree)
+    : AVLTree(tree.comp) {
+  set_root(clone(tree.root(), nullptr));
+  count = tree.count;
+}
+
+template <typename Key, typename Value, typename Compare>
+AVLTree<Key, Value, Compare>::AVLTree(AVLTree&& tree) noexcept
+    : AVLTree(tree.comp) {
+  swap(tree);
 }
 
 // destructors
-template <typename Key, typename Value>
-AVLTree<Key, Value>::~AVLTree() {
-  clear(root);
+template <typename Key, typename Value, typename Compare>
+AVLTree<Key, Value, Compare>::~AVLTree() {
+  clear(root());
 }
 
 // Assignment
-template <typename Key, typename Value>
-AVLTree<Key, Value>& AVLTree<Key, Value>::operator=(const AVLTree& tree) {
+template <typename Key, typename Value, typename Compare>
+AVLTree<Key, Value, Compare>& AVLTree<Key, Value, Compare>::operator=(
+    const AVLTree& tree) {
   if (this != &tree) {
-    clear(root);
-    root = clone(tree.root);
+    AVLTree copy(tree);
+    swap(copy);
   }
   return *this;
 }
 
-template <typename Key, typename Value>
-AVLTree<Key, Value>& AVLTree<Key, Value>::operator=(AVLTree& tree) noexcept {
+template <typename Key, typename Value, typename Compare>
+AVLTree<Key, Value, Compare>& AVLTree<Key, Value, Compare>::operator=(
+    AVLTree&& tree) noexcept {
   if (this != &tree) {
-    clear(root);
-    swap(root, tree.root);
+    clear();
+    swap(tree);
   }
   return *this;
 }
 
 // Iterators
-template <typename Key, typename Value>
-typename AVLTree<Key, Value>::Iterator AVLTree<Key, Value>::begin() {
-  if (!root) {
-    return end();
-  }
-  Node* current = root;
-  while (current->left) {
-    current = current->left;
-  }
-  return Iterator(current);
+template <typename Key, typename Value, typename Compare>
+typename AVLTree<Key, Value, Compare>::Iterator
+AVLTree<Key, Value, Compare>::begin() {
+  return Iterator(header.parent);
 }
 
-template <typename Key, typename Value>
-typename AVLTree<Key, Value>::Iterator AVLTree<Key, Value>::end() {
-  return Iterator(nullptr);
+template <typename Key, typename Value, typename Compare>
+typename AVLTree<Key, Value, Compare>::Iterator
+AVLTree<Key, Value, Compare>::end() {
+  return Iterator(&header);
 }
 
-template <typename Key, typename Value>
-typename AVLTree<Key, Value>::ConstIterator AVLTree<Key, Value>::cbegin()
-    const {
-  if (!root) {
-    return cend();
-  }
-  Node* current = root;
-  while (current->left) {
-    current = current->left;
-  }
-  return ConstIterator(current);
+template <typename Key, typename Value, typename Compare>
+typename AVLTree<Key, Value, Compare>::ConstIterator
+AVLTree<Key, Value, Compare>::cbegin() const {
+  return ConstIterator(header.parent);
 }
 
-template <typename Key, typename Value>
-typename AVLTree<Key, Value>::ConstIterator AVLTree<Key, Value>::cend() const {
-  return ConstIterator(nullptr);
+template <typename Key, typename Value, typename Compare>
+typename AVLTree<Key, Value, Compare>::ConstIterator
+AVLTree<Key, Value, Compare>::cend() const {
+  return ConstIterator(end_node());
 }
 
 // Capacity
-template <typename Key, typename Value>
-bool AVLTree<Key, Value>::empty() const {
-  return !root;
+template <typename Key, typename Value, typename Compare>
+bool AVLTree<Key, Value, Compare>::empty() const {
+  return count == 0;
 }
 
-template <typename Key, typename Value>
-typename AVLTree<Key, Value>::size_type AVLTree<Key, Value>::size() const {
-  return size(root);
+template <typename Key, typename Value, typename Compare>
+typename AVLTree<Key, Value, Compare>::size_type
+AVLTree<Key, Value, Compare>::size() const {
+  return count;
 }
 
-template <typename Key, typename Value>
-typename AVLTree<Key, Value>::size_type AVLTree<Key, Value>::max_size() const {
+template <typename Key, typename Value, typename Compare>
+typename AVLTree<Key, Value, Compare>::size_type
+AVLTree<Key, Value, Compare>::max_size() const {
   // return std::numeric_limits<size_type>::max();
   return (std::numeric_limits<size_type>::max() / sizeof(value_type));
 }
 
+// one node per element; the header lives in the tree object itself
+template <typename Key, typename Value, typename Compare>
+MemoryStats AVLTree<Key, Value, Compare>::memory_stats() const {
+  return memory::split(sizeof(*this) + count * sizeof(Node), count,
+                       memory::element_bytes<Key, Value>(), count);
+}
+
 // Modifiers
-template <typename Key, typename Value>
-void AVLTree<Key, Value>::clear() {
-  clear(root);
-  root = nullptr;
-}
-
-template <typename Key, typename Value>
-std::pair<typename AVLTree<Key, Value>::Iterator, bool>
-AVLTree<Key, Value>::insert(const std::pair<Key, Value>& data, bool multi) {
-  Node* newNode{};
-  if (!multi) {
-    root = insert(root, data, &newNode);
-    if (iterator(newNode) != end()) {
-      return std::make_pair(Iterator(newNode), true);
-    } else {
-      return std::make_pair(find(data.first), false);
-    }
-  } else {
-    root = mul_insert(root, data, &newNode);
-    return std::make_pair(Iterator(newNode), true);
+template <typename Key, typename Value, typename Compare>
+void AVLTree<Key, Value, Compare>::clear() {
+  clear(root());
+  set_root(nullptr);
+  count = 0;
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename D>
+std::pair<typename AVLTree<Key, Value, Compare>::Iterator, bool>
+AVLTree<Key, Value, Compare>::insert_data(D&& data, bool multi) {
+  NodeBase* parent;
+  bool left;
+  if (NodeBase* equal = find_slot(data.first, multi, &parent, &left)) {
+    return std::make_pair(Iterator(equal), false);
+  }
+  NodeBase* node = attach(parent, left, std::forward<D>(data));
+  return std::make_pair(Iterator(node), true);
+}
+
+template <typename Key, typename Value, typename Compare>
+std::pair<typename AVLTree<Key, Value, Compare>::Iterator, bool>
+AVLTree<Key, Value, Compare>::insert(const std::pair<Key, Value>& data,
+                                     bool multi) {
+  return insert_data(data, multi);
+}
+
+template <typename Key, typename Value, typename Compare>
+std::pair<typename AVLTree<Key, Value, Compare>::Iterator, bool>
+AVLTree<Key, Value, Compare>::insert(std::pair<Key, Value>&& data,
+                                     bool multi) {
+  return insert_data(std::move(data), multi);
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename... Args>
+std::pair<typename AVLTree<Key, Value, Compare>::Iterator, bool>
+AVLTree<Key, Value, Compare>::emplace(bool multi, Args&&... args) {
+  Node* node = new Node(std::forward<Args>(args)...);
+  hooks::allocated();
+  NodeBase* parent;
+  bool left;
+  if (NodeBase* equal = find_slot(node->data.first, multi, &parent, &left)) {
+    hooks::deallocated();
+    delete node;
+    return std::make_pair(Iterator(equal), false);
   }
+  return std::make_pair(Iterator(link(parent, left, node)), true);
 }
 
-template <typename Key, typename Value>
-typename AVLTree<Key, Value>::Node* AVLTree<Key, Value>::insert(
-    Node* node, const std::pair<Key, Value>& data, Node** newNode,
-    Node* parent) {
-  if (!node) {
-    // Node *tmp = new Node(data.first, data.second, nullptr, nullptr, parent);
-    *newNode = new Node(data.first, data.second, nullptr, nullptr, parent);
-    // *newNode = tmp;
-    return *newNode;
-  }
-  if (data.first < node->data.first) {
-    node->left = insert(node->left, data, newNode, node);
-  } else if (data.first > node->data.first) {
-    node->right = insert(node->right, data, newNode, node);
-  } else {
-    //     // Duplicate keys are not allowed in AVL trees
-    return node;
+template <typename Key, typename Value, typename Compare>
+template <typename K, typename... Args>
+std::pair<typename AVLTree<Key, Value, Compare>::Iterator, bool>
+AVLTree<Key, Value, Compare>::try_emplace(K&& key, Args&&... args) {
+  NodeBase* parent;
+  bool left;
+  if (NodeBase* equal = find_slot(key, false, &parent, &left)) {
+    return std::make_pair(Iterator(equal), false);
   }
+  NodeBase* node =
+      attach(parent, left, std::piecewise_construct,
+             std::forward_as_tuple(std::forward<K>(key)),
+             std::forward_as_tuple(std::forward<Args>(args)...));
+  return std::make_pair(Iterator(node), true);
+}
+
+// Takes the node over unless a unique insert finds its key taken, in which
+// case the handle keeps it.
+template <typename Key, typename Value, typename Compare>
+std::pair<typename AVLTree<Key, Value, Compare>::Iterator, bool>
+AVLTree<Key, Value, Compare>::insert(node_type& node, bool multi) {
+  if (node.empty()) {
+    return std::make_pair(end(), false);
+  }
+  NodeBase* parent;
+  bool left;
+  if (NodeBase* equal = find_slot(node.key(), multi, &parent, &left)) {
+    return std::make_pair(Iterator(equal), false);
+  }
+  Node* taken = node.node;
+  node.node = nullptr;
+  return std::make_pair(Iterator(link(parent, left, taken)), true);
+}
+
+// Tries to place the element right before hint, or right after it when the
+// key belongs there, comparing only against the neighbours. Appending
+// sorted keys with the previous result (or end()) as the hint therefore
+// skips the descent from the root. Falls back to the plain insert when the
+// key does not fit next to the hint.
+template <typename Key, typename Value, typename Compare>
+template <typename D>
+std::pair<typename AVLTree<Key, Value, Compare>::Iterator, bool>
+AVLTree<Key, Value, Compare>::insert_hint_data(Iterator hint, D&& data,
+                                               bool multi) {
+  const Key& key = data.first;
+  NodeBase* pos = hint.current;
+  if (pos != &header && comp(node_key(pos), key)) {
+    NodeBase* next = successor(pos);
+    if (next == &header || (multi ? !comp(node_key(next), key)
+                                  : comp(key, node_key(next)))) {
+      NodeBase* node = attach_between(pos, next, std::forward<D>(data));
+      return std::make_pair(Iterator(node), true);
+    }
+    return insert_data(std::forward<D>(data), multi);
+  }
+  if (pos != &header && !multi && !comp(key, node_key(pos))) {
+    return std::make_pair(hint, false);
+  }
+  NodeBase* prev = nullptr;
+  if (pos != header.parent) {
+    prev = pos == &header ? header.right : predecessor(pos);
+  }
+  if (!prev || (multi ? !comp(key, node_key(prev))
+                      : comp(node_key(prev), key))) {
+    NodeBase* node = attach_between(prev, pos, std::forward<D>(data));
+    return std::make_pair(Iterator(node), true);
+  }
+  return insert_data(std::forward<D>(data), multi);
+}
 
-  return balance(node);
+template <typename Key, typename Value, typename Compare>
+std::pair<typename AVLTree<Key, Value, Compare>::Iterator, bool>
+AVLTree<Key, Value, Compare>::insert(Iterator hint,
+                                     const std::pair<Key, Value>& data,
+                                     bool multi) {
+  return insert_hint_data(hint, data, multi);
 }
 
-template <typename Key, typename Value>
-void AVLTree<Key, Value>::erase(Iterator pos) {
-  if (pos == end() || empty()) {
-    return;
+template <typename Key, typename Value, typename Compare>
+std::pair<typename AVLTree<Key, Value, Compare>::Iterator, bool>
+AVLTree<Key, Value, Compare>::insert(Iterator hint,
+                                     std::pair<Key, Value>&& data,
+                                     bool multi) {
+  return insert_hint_data(hint, std::move(data), multi);
+}
+
+template <typename Key, typename Value, typename Compare>
+void AVLTree<Key, Value, Compare>::erase(Iterator pos) {
+  if (pos.current && pos.current != &header) {
+    erase_node(pos.current);
   }
-  key_type key_to_erase = (*pos).first;
-  root = erase(root, key_to_erase);
 }
 
-template <typename Key, typename Value>
-void AVLTree<Key, Value>::swap(AVLTree& other) {
-  swap(root, other.root);
+// Exchanges the headers' links and points each root back at its new
+// header; an empty tree's header has to refer to itself instead.
+template <typename Key, typename Value, typename Compare>
+void AVLTree<Key, Value, Compare>::swap(AVLTree& other) {
+  std::swap(header.left, other.header.left);
+  std::swap(header.parent, other.header.parent);
+  std::swap(header.right, other.header.right);
+  for (AVLTree* tree : {this, &other}) {
+    NodeBase& head = tree->header;
+    if (head.left) {
+      head.left->parent = &head;
+    } else {
+      head.parent = head.right = &head;
+    }
+  }
+  std::swap(count, other.count);
+  std::swap(comp, other.comp);
 }
 
-template <typename Key, typename Value>
-void AVLTree<Key, Value>::merge(AVLTree& other, bool multi) {
+template <typename Key, typename Value, typename Compare>
+typename AVLTree<Key, Value, Compare>::node_type
+AVLTree<Key, Value, Compare>::extract(Iterator pos) {
+  if (!pos.current || pos.current == &header) {
+    return node_type();
+  }
+  unlink(pos.current);
+  return node_type(static_cast<Node*>(pos.current));
+}
+
+// Relinks the accepted nodes instead of copying them.
+template <typename Key, typename Value, typename Compare>
+void AVLTree<Key, Value, Compare>::merge(AVLTree& other, bool multi) {
+  if (this == &other) {
+    return;
+  }
   for (auto it = other.begin(); it != other.end();) {
-    if (!contains((*it).first) || multi) {
-      insert(*it, multi);
-      other.erase(it);
-      it = other.begin();
-    } else {
-      ++it;
+    NodeBase* node = it.current;
+    ++it;
+    NodeBase* parent;
+    bool left;
+    if (!find_slot(node_key(node), multi, &parent, &left)) {
+      other.unlink(node);
+      link(parent, left, node);
     }
   }
 }
 
+// Cuts out [first, last) in O(log n) and frees the m nodes in it, so the
+// whole erase is O(log n + m). The node at last becomes the pivot that
+// joins what is left.
+template <typename Key, typename Value, typename Compare>
+typename AVLTree<Key, Value, Compare>::Iterator
+AVLTree<Key, Value, Compare>::erase(Iterator first, Iterator last) {
+  if (first == last) {
+    return last;
+  }
+  NodeBase* left;
+  NodeBase* rest;
+  split_around(first.current, &left, &rest);
+  if (last.current == &header) {
+    clear(rest);
+    set_root(left);
+  } else {
+    NodeBase* middle;
+    NodeBase* right;
+    split_around(last.current, &middle, &right);
+    clear(middle);
+    set_root(join_around(left, last.current, right));
+  }
+  hooks::deallocated();
+  delete static_cast<Node*>(first.current);
+  count = subtree_size(root());
+  return last;
+}
+
+template <typename Key, typename Value, typename Compare>
+AVLTree<Key, Value, Compare> AVLTree<Key, Value, Compare>::split(
+    Iterator pos) {
+  AVLTree tail(comp);
+  NodeBase* node = pos.current;
+  if (!node || node == &header) {
+    return tail;
+  }
+  NodeBase* left;
+  NodeBase* right;
+  split_around(node, &left, &right);
+  set_root(left);
+  tail.set_root(join_around(nullptr, node, right));
+  count = subtree_size(left);
+  tail.count = subtree_size(tail.root());
+  return tail;
+}
+
+// The pivot is the end of other that faces this tree, so only one node
+// is unlinked before the two roots are joined around it.
+template <typename Key, typename Value, typename Compare>
+bool AVLTree<Key, Value, Compare>::join(AVLTree& other, bool multi) {
+  if (this == &other) {
+    return false;
+  }
+  if (other.empty()) {
+    return true;
+  }
+  if (empty()) {
+    swap(other);
+    return true;
+  }
+  auto before = [this, multi](const Key& a, const Key& b) {
+    return multi ? !comp(b, a) : comp(a, b);
+  };
+  NodeBase* pivot;
+  if (before(node_key(header.right), node_key(other.header.parent))) {
+    pivot = other.header.parent;
+    other.unlink(pivot);
+    set_root(join_around(root(), pivot, other.root()));
+  } else if (before(node_key(other.header.right), node_key(header.parent))) {
+    pivot = other.header.right;
+    other.unlink(pivot);
+    set_root(join_around(other.root(), pivot, root()));
+  } else {
+    return false;
+  }
+  count += other.count + 1;
+  other.set_root(nullptr);
+  other.count = 0;
+  return true;
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename InputIt>
+void AVLTree<Key, Value, Compare>::assign(InputIt first, InputIt last,
+                                          bool multi) {
+  bulk::assign<Key, Value>(
+      first, last, multi,
+      [this](const auto& a, const auto& b) { return key_less(a, b); },
+      [this](size_t n, auto& next) { rebuild(n, next); });
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename ForwardIt>
+void AVLTree<Key, Value, Compare>::assign_sorted(ForwardIt first,
+                                                 ForwardIt last, bool multi) {
+  bulk::assign_sorted<Key, Value>(
+      first, last, multi,
+      [this](const auto& a, const auto& b) { return key_less(a, b); },
+      [this](size_t n, auto& next) { rebuild(n, next); });
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename InputIt>
+void AVLTree<Key, Value, Compare>::assign_parallel(InputIt first, InputIt last,
+                                                   bool multi, bulk::Keep keep,
+                                                   unsigned threads) {
+  bulk::assign_parallel<Key, Value>(
+      first, last, multi, keep, threads,
+      [this](const auto& a, const auto& b) { return key_less(a, b); },
+      [this](size_t n, auto& next) { rebuild(n, next); });
+}
+
 // Lookup
-template <typename Key, typename Value>
-typename AVLTree<Key, Value>::Iterator AVLTree<Key, Value>::find(
-    const key_type& key) {
-  Node* current = root;
-  while (current) {
-    if (key == current->data.first) {
-      return Iterator(current);
-    } else if (key < current->data.first) {
-      current = current->left;
-    } else {
-      current = current->right;
-    }
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+typename AVLTree<Key, Value, Compare>::Iterator
+AVLTree<Key, Value, Compare>::lower_bound(const K& key) {
+  return Iterator(lower_bound_node(key));
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+typename AVLTree<Key, Value, Compare>::Iterator
+AVLTree<Key, Value, Compare>::upper_bound(const K& key) {
+  return Iterator(upper_bound_node(key));
+}
+
+// the lower bound is the first of several equal keys, so a multiset yields
+// its first duplicate
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+typename AVLTree<Key, Value, Compare>::Iterator
+AVLTree<Key, Value, Compare>::find(const K& key) {
+  NodeBase* node = lower_bound_node(key);
+  if (node != &header && !comp(key, node_key(node))) {
+    return Iterator(node);
   }
   return end();
 }
 
-template <typename Key, typename Value>
-bool AVLTree<Key, Value>::contains(const key_type& key) {
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+bool AVLTree<Key, Value, Compare>::contains(const K& key) {
   return find(key) != end();
 }
 
-template <typename Key, typename Value>
-typename AVLTree<Key, Value>::Node* AVLTree<Key, Value>::mul_insert(
-    Node* node, const std::pair<Key, Value>& data, Node** newNode,
-    Node* parent) {
-  if (!node) {
-    *newNode = new Node(data.first, data.second, nullptr, nullptr, parent);
-    return *newNode;
-  }
-  if (data.first <= node->data.first) {
-    node->left = mul_insert(node->left, data, newNode, node);
-  } else {
-    node->right = mul_insert(node->right, data, newNode, node);
+// Each lane runs lower_bound_node one level per pass; a lane that reached
+// the bottom is skipped until the whole batch is done.
+template <typename Key, typename Value, typename Compare>
+template <typename ForwardIt, typename Emit>
+void AVLTree<Key, Value, Compare>::find_many(ForwardIt first, ForwardIt last,
+                                             Emit emit) {
+  ForwardIt keys[kBatch];
+  NodeBase* current[kBatch];
+  NodeBase* result[kBatch];
+  while (first != last) {
+    size_t n = 0;
+    for (; n < kBatch && first != last; ++n, ++first) {
+      keys[n] = first;
+      current[n] = root();
+      result[n] = end_node();
+    }
+    for (bool active = true; active;) {
+      active = false;
+      for (size_t i = 0; i < n; ++i) {
+        NodeBase* node = current[i];
+        if (!node) continue;
+        if (!comp(node_key(node), *keys[i])) {
+          result[i] = node;
+          node = node->left;
+        } else {
+          node = node->right;
+        }
+        current[i] = node;
+        if (node) {
+          __builtin_prefetch(node);
+          __builtin_prefetch(&node_key(node));
+          active = true;
+        }
+      }
+    }
+    for (size_t i = 0; i < n; ++i) {
+      NodeBase* node = result[i];
+      if (node != &header && !comp(*keys[i], node_key(node))) {
+        emit(Iterator(node));
+      } else {
+        emit(end());
+      }
+    }
   }
-  return balance(node);
 }
 
 }  // namespace s21
@@ -0,0 +1,78 @@
+#ifndef SRC_S21_CONTAINERS_S21_BLOOM_FILTER_H_
+#define SRC_S21_CONTAINERS_S21_BLOOM_FILTER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Blocked Bloom filter: every key sets its bits inside a single 64-byte
+// block, so add and may_contain each touch one cache line. may_contain
+// never misses a key that was added; for other keys it errs with about the
+// rate that false_positive_rate() reports. Keys cannot be removed, only
+// cleared all at once.
+template <typename Key, typename Hash = std::hash<Key>>
+class BloomFilter {
+ private:
+  static constexpr size_t kBlockBits = 512;
+  static constexpr size_t kWords = kBlockBits / 64;
+  struct alignas(64) Block {
+    uint64_t words[kWords];
+  };
+
+  vector<Block> blocks;
+  size_t count;
+  unsigned probes;
+  Hash hash;
+
+  // helper methods
+  uint64_t mixed_hash(const Key& key) const;
+  size_t block_of(uint64_t h) const;
+
+ public:
+  using size_type = size_t;
+  static constexpr size_type kDefaultBitsPerKey = 10;
+
+  // constructors
+  // an empty filter has no blocks and answers every query with true
+  BloomFilter() : count(0), probes(0) {}
+  explicit BloomFilter(size_type expected_keys,
+                       size_type bits_per_key = kDefaultBitsPerKey);
+  BloomFilter(const BloomFilter& other) = default;
+  BloomFilter(BloomFilter&& other) noexcept;
+
+  // assignment
+  BloomFilter& operator=(const BloomFilter& other);
+  BloomFilter& operator=(BloomFilter&& other) noexcept;
+
+  // capacity
+  // keys added since construction or clear(), duplicates included
+  size_type size() const { return count; }
+  size_type bit_count() const { return blocks.size() * kBlockBits; }
+  // the blocks are the payload
+  MemoryStats memory_stats() const;
+  size_type memory_usage() const { return memory_stats().total(); }
+
+  // modifiers
+  void add(const Key& key);
+  // ORs in the bits of a filter of the same size; false if the sizes differ
+  bool unite(const BloomFilter& other);
+  void clear();
+  void swap(BloomFilter& other);
+
+  // lookup
+  bool may_contain(const Key& key) const;
+  // the chance that may_contain returns true for a key never added,
+  // estimated from how full each block is
+  double false_positive_rate() const;
+};
+
+}  // namespace s21
+
+#include "s21_bloom_filter.tpp"
+
+#endif  // SRC_S21_CONTAINERS_S21_BLOOM_FILTER_H_
@@ -0,0 +1,155 @@
+#ifndef SRC_S21_CONTAINERS_S21_BLOOM_FILTER_TPP_
+#define SRC_S21_CONTAINERS_S21_BLOOM_FILTER_TPP_
+
+#include "s21_bloom_filter.h"
+
+namespace s21 {
+
+// std::hash is the identity for integers, so its result is mixed first.
+template <typename Key, typename Hash>
+uint64_t BloomFilter<Key, Hash>::mixed_hash(const Key& key) const {
+  uint64_t h = hash(key);
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  return h;
+}
+
+// The high half of the hash picks the block by multiplying instead of
+// dividing; the low half is left for the bits inside it.
+template <typename Key, typename Hash>
+size_t BloomFilter<Key, Hash>::block_of(uint64_t h) const {
+  return static_cast<size_t>(((h >> 32) * blocks.size()) >> 32);
+}
+
+// probes is about bits_per_key * ln 2, the optimum for a plain Bloom filter;
+// each probe takes 9 bits of a second hash, so at most 7 fit. There is
+// always at least one block.
+template <typename Key, typename Hash>
+BloomFilter<Key, Hash>::BloomFilter(size_type expected_keys,
+                                    size_type bits_per_key)
+    : blocks(expected_keys * bits_per_key / kBlockBits + 1),
+      count(0),
+      probes(static_cast<unsigned>(bits_per_key * 69 / 100)),
+      hash() {
+  if (probes < 1) probes = 1;
+  if (probes > 7) probes = 7;
+}
+
+template <typename Key, typename Hash>
+BloomFilter<Key, Hash>::BloomFilter(BloomFilter&& other) noexcept
+    : blocks(std::move(other.blocks)),
+      count(other.count),
+      probes(other.probes),
+      hash(other.hash) {
+  other.count = 0;
+}
+
+template <typename Key, typename Hash>
+BloomFilter<Key, Hash>& BloomFilter<Key, Hash>::operator=(
+    const BloomFilter& other) {
+  if (this != &other) {
+    BloomFilter copy(other);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <typename Key, typename Hash>
+BloomFilter<Key, Hash>& BloomFilter<Key, Hash>::operator=(
+    BloomFilter&& other) noexcept {
+  if (this != &other) {
+    BloomFilter taken(std::move(other));
+    swap(taken);
+  }
+  return *this;
+}
+
+template <typename Key, typename Hash>
+void BloomFilter<Key, Hash>::add(const Key& key) {
+  ++count;
+  if (blocks.empty()) return;
+  uint64_t h = mixed_hash(key);
+  uint64_t* words = blocks.data()[block_of(h)].words;
+  uint64_t bits = h * 0x9e3779b97f4a7c15ULL;
+  for (unsigned i = 0; i < probes; ++i, bits >>= 9) {
+    words[(bits >> 6) & (kWords - 1)] |= uint64_t(1) << (bits & 63);
+  }
+}
+
+template <typename Key, typename Hash>
+bool BloomFilter<Key, Hash>::unite(const BloomFilter& other) {
+  if (other.blocks.empty()) return true;
+  if (blocks.size() != other.blocks.size() || probes != other.probes) {
+    return false;
+  }
+  Block* mine = blocks.data();
+  const Block* theirs = other.blocks.cbegin();
+  for (size_t b = 0; b < blocks.size(); ++b) {
+    for (size_t w = 0; w < kWords; ++w) {
+      mine[b].words[w] |= theirs[b].words[w];
+    }
+  }
+  count += other.count;
+  return true;
+}
+
+template <typename Key, typename Hash>
+MemoryStats BloomFilter<Key, Hash>::memory_stats() const {
+  MemoryStats held = memory::held_by(blocks);
+  return memory::split(sizeof(*this) + held.total(), blocks.size(),
+                       sizeof(Block), held.allocations);
+}
+
+template <typename Key, typename Hash>
+void BloomFilter<Key, Hash>::clear() {
+  Block* data = blocks.data();
+  for (size_t b = 0; b < blocks.size(); ++b) data[b] = Block{};
+  count = 0;
+}
+
+template <typename Key, typename Hash>
+void BloomFilter<Key, Hash>::swap(BloomFilter& other) {
+  blocks.swap(other.blocks);
+  std::swap(count, other.count);
+  std::swap(probes, other.probes);
+  std::swap(hash, other.hash);
+}
+
+// All probes are tested without an early exit, so the answer costs one
+// cache line and no branch mispredictions on the bits.
+template <typename Key, typename Hash>
+bool BloomFilter<Key, Hash>::may_contain(const Key& key) const {
+  if (blocks.empty()) return true;
+  uint64_t h = mixed_hash(key);
+  const uint64_t* words = blocks.cbegin()[block_of(h)].words;
+  uint64_t bits = h * 0x9e3779b97f4a7c15ULL;
+  uint64_t missing = 0;
+  for (unsigned i = 0; i < probes; ++i, bits >>= 9) {
+    uint64_t bit = uint64_t(1) << (bits & 63);
+    missing |= bit & ~words[(bits >> 6) & (kWords - 1)];
+  }
+  return !missing;
+}
+
+template <typename Key, typename Hash>
+double BloomFilter<Key, Hash>::false_positive_rate() const {
+  if (blocks.empty()) return 1.0;
+  const Block* data = blocks.cbegin();
+  double sum = 0.0;
+  for (size_t b = 0; b < blocks.size(); ++b) {
+    unsigned set = 0;
+    for (size_t w = 0; w < kWords; ++w) {
+      set += __builtin_popcountll(data[b].words[w]);
+    }
+    double fill = static_cast<double>(set) / kBlockBits;
+    double rate = 1.0;
+    for (unsigned i = 0; i < probes; ++i) rate *= fill;
+    sum += rate;
+  }
+  return sum / blocks.size();
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_CONTAINERS_S21_BLOOM_FILTER_TPP_
@@ -0,0 +1,195 @@
+#ifndef SRC_S21_CONTAINERS_S21_BLOOM_TREE_H_
+#define SRC_S21_CONTAINERS_S21_BLOOM_TREE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "s21_avltree.h"
+#include "s21_bloom_filter.h"
+
+namespace s21 {
+
+// Backend that puts a BloomFilter of the keys in front of another backend,
+// AVLTree by default, so that find and contains answer most lookups of
+// missing keys from one cache line instead of a walk down the tree. Every
+// other call goes straight to the inner tree.
+//
+// The filter hashes keys with Hash, the tree matches them with Compare, so
+// keys that Compare finds equivalent must hash alike, or find and contains
+// miss keys that are there. Left as void, Hash is std::hash<Key>, which
+// only agrees with std::less and std::greater; any other Compare does not
+// compile without a Hash of its own, such as a case-folding hash for a
+// case-insensitive order.
+//
+// The filter cannot forget keys. Erased keys stay in it as dead bits, and
+// it is rebuilt from the tree once the dead keys outnumber the live ones,
+// or once it holds more keys than it was sized for; both cost O(n), paid
+// for by the inserts and erases in between. reserve(n) sizes it for n keys
+// up front. merge adds the keys of other before they move, split copies
+// the filter to both halves and join unites two filters of the same size,
+// so each of them may cost a pass over other or over the filter bits.
+//
+// With another inner backend or a Hash, pass an alias such as
+//   template <typename K, typename V, typename C>
+//   using BloomFlatTree = s21::BloomTree<K, V, C, s21::FlatTree>;
+template <typename Key, typename Value, typename Compare = std::less<Key>,
+          template <typename, typename, typename> class Tree = AVLTree,
+          typename Hash = void>
+class BloomTree {
+ private:
+  static constexpr bool kHashableOrder =
+      std::is_same_v<Compare, std::less<Key>> ||
+      std::is_same_v<Compare, std::greater<Key>> ||
+      std::is_same_v<Compare, std::less<>> ||
+      std::is_same_v<Compare, std::greater<>>;
+  static_assert(!std::is_void_v<Hash> || kHashableOrder,
+                "BloomTree with this Compare needs a Hash that agrees with it");
+
+  using tree_type = Tree<Key, Value, Compare>;
+  using hasher = std::conditional_t<std::is_void_v<Hash>, std::hash<Key>, Hash>;
+  using filter_type = BloomFilter<Key, hasher>;
+  static constexpr size_t kMinKeys = 64;
+
+  template <typename T, typename = void>
+  struct has_reserve : std::false_type {};
+  template <typename T>
+  struct has_reserve<T, std::void_t<decltype(std::declval<T&>().reserve(0))>>
+      : std::true_type {};
+
+  tree_type tree;
+  filter_type filter;
+  size_t planned;  // keys the filter was sized for
+  size_t dead;     // erased keys still set in the filter
+
+ public:
+  using Iterator = typename tree_type::Iterator;
+  using ConstIterator = typename tree_type::ConstIterator;
+  using key_type = Key;
+  using value_type = Value;
+  using size_type = size_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+  using node_type = typename tree_type::node_type;
+
+  // constructors
+  BloomTree() : BloomTree(Compare()) {}
+  explicit BloomTree(const Compare& compare)
+      : tree(compare), planned(0), dead(0) {}
+  BloomTree(const BloomTree& other)
+      : tree(other.tree),
+        filter(other.filter),
+        planned(other.planned),
+        dead(other.dead) {}
+  BloomTree(BloomTree&& other) noexcept;
+
+  // destructor
+  ~BloomTree() = default;
+
+  // assignment
+  BloomTree& operator=(const BloomTree& other);
+  BloomTree& operator=(BloomTree&& other) noexcept;
+
+  // Iterators
+  Iterator begin() { return tree.begin(); }
+  Iterator end() { return tree.end(); }
+  ConstIterator cbegin() const { return tree.cbegin(); }
+  ConstIterator cend() const { return tree.cend(); }
+
+  // capacity
+  bool empty() const { return tree.empty(); }
+  size_type size() const { return tree.size(); }
+  size_type max_size() const { return tree.max_size(); }
+  // the filter counts as overhead
+  MemoryStats memory_stats() const;
+  size_type memory_usage() const { return memory_stats().total(); }
+  // sizes the filter for n keys, and the inner tree too if it can reserve
+  void reserve(size_type n);
+  // the chance that a lookup of a missing key gets past the filter
+  double false_positive_rate() const { return filter.false_positive_rate(); }
+
+  // modifiers
+  void clear();
+  std::pair<Iterator, bool> insert(const std::pair<Key, Value>& data,
+                                   bool multi) {
+    return added(tree.insert(data, multi));
+  }
+  std::pair<Iterator, bool> insert(std::pair<Key, Value>&& data, bool multi) {
+    return added(tree.insert(std::move(data), multi));
+  }
+  std::pair<Iterator, bool> insert(Iterator hint,
+                                   const std::pair<Key, Value>& data,
+                                   bool multi) {
+    return added(tree.insert(hint, data, multi));
+  }
+  std::pair<Iterator, bool> insert(Iterator hint, std::pair<Key, Value>&& data,
+                                   bool multi) {
+    return added(tree.insert(hint, std::move(data), multi));
+  }
+  template <typename... Args>
+  std::pair<Iterator, bool> emplace(bool multi, Args&&... args) {
+    return added(tree.emplace(multi, std::forward<Args>(args)...));
+  }
+  template <typename K, typename... Args>
+  std::pair<Iterator, bool> try_emplace(K&& key, Args&&... args) {
+    return added(
+        tree.try_emplace(std::forward<K>(key), std::forward<Args>(args)...));
+  }
+  void erase(Iterator pos);
+  Iterator erase(Iterator first, Iterator last);
+  node_type extract(Iterator pos);
+  std::pair<Iterator, bool> insert(node_type& node, bool multi) {
+    return added(tree.insert(node, multi));
+  }
+  void swap(BloomTree& other);
+  void merge(BloomTree& other, bool multi);
+  BloomTree split(Iterator pos);
+  bool join(BloomTree& other, bool multi);
+  template <typename InputIt>
+  void assign(InputIt first, InputIt last, bool multi);
+  template <typename ForwardIt>
+  void assign_sorted(ForwardIt first, ForwardIt last, bool multi);
+  template <typename InputIt>
+  void assign_parallel(InputIt first, InputIt last, bool multi,
+                       bulk::Keep keep, unsigned threads);
+
+  // lookup: only find and contains with a key_type argument consult the
+  // filter; a transparent key may hash differently
+  template <typename K>
+  Iterator lower_bound(const K& key) {
+    return tree.lower_bound(key);
+  }
+  template <typename K>
+  Iterator upper_bound(const K& key) {
+    return tree.upper_bound(key);
+  }
+  template <typename K>
+  Iterator find(const K& key);
+  template <typename K>
+  bool contains(const K& key);
+  // one find per key: keys the filter turns away would leave gaps in the
+  // batches of the inner tree
+  template <typename ForwardIt, typename Emit>
+  void find_many(ForwardIt first, ForwardIt last, Emit emit) {
+    for (; first != last; ++first) emit(find(*first));
+  }
+
+  // observers
+  Compare key_comp() const { return tree.key_comp(); }
+
+ private:
+  // helper methods
+  void rebuild(size_t keys);
+  std::pair<Iterator, bool> added(std::pair<Iterator, bool> res);
+  void removed(size_t n);
+};
+
+}  // namespace s21
+
+#include "s21_bloom_tree.tpp"
+
+#endif  // SRC_S21_CONTAINERS_S21_BLOOM_TREE_H_
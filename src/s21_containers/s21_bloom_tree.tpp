@@ -0,0 +1,262 @@
+#ifndef SRC_S21_CONTAINERS_S21_BLOOM_TREE_TPP_
+#define SRC_S21_CONTAINERS_S21_BLOOM_TREE_TPP_
+
+#include "s21_bloom_tree.h"
+
+namespace s21 {
+
+// Starts a filter sized for the given number of keys that holds exactly
+// the keys of the tree. The tree is only read, so iterators stay valid.
+template <typename Key, typename Value, typename Compare,
+          template <typename, typename, typename> class Tree, typename Hash>
+void BloomTree<Key, Value, Compare, Tree, Hash>::rebuild(size_t keys) {
+  planned = std::max(keys, kMinKeys);
+  filter_type built(planned);
+  for (Iterator it = tree.begin(); it != tree.end(); ++it) {
+    built.add((*it).first);
+  }
+  filter = std::move(built);
+  dead = 0;
+}
+
+// A filter that is full doubles instead of taking the key, so the rebuild
+// happens once per doubling of the tree.
+template <typename Key, typename Value, typename Compare,
+          template <typename, typename, typename> class Tree, typename Hash>
+std::pair<typename BloomTree<Key, Value, Compare, Tree, Hash>::Iterator, bool>
+BloomTree<Key, Value, Compare, Tree, Hash>::added(
+    std::pair<Iterator, bool> res) {
+  if (res.second) {
+    if (filter.size() < planned) {
+      filter.add((*res.first).first);
+    } else {
+      rebuild(2 * tree.size());
+    }
+  }
+  return res;
+}
+
+template <typename Key, typename Value, typename Compare,
+          template <typename, typename, typename> class Tree, typename Hash>
+void BloomTree<Key, Value, Compare, Tree, Hash>::removed(size_t n) {
+  dead += n;
+  if (dead > kMinKeys && dead > tree.size()) {
+    rebuild(2 * tree.size());
+  }
+}
+
+// constructors
+template <typename Key, typename Value, typename Compare,
+          template <typename, typename, typename> class Tree, typename Hash>
+BloomTree<Key, Value, Compare, Tree, Hash>::BloomTree(
+    BloomTree&& other) noexcept
+    : tree(std::move(other.tree)),
+      filter(std::move(other.filter)),
+      planned(other.planned),
+      dead(other.dead) {
+  other.planned = 0;
+  other.dead = 0;
+}
+
+// assignment
+template <typename Key, typename Value, typename Compare,
+          template <typename, typename, typename> class Tree, typename Hash>
+BloomTree<Key, Value, Compare, Tree, Hash>&
+BloomTree<Key, Value, Compare, Tree, Hash>::operator=(const BloomTree& other) {
+  if (this != &other) {
+    BloomTree copy(other);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <typename Key, typename Value, typename Compare,
+          template <typename, typename, typename> class Tree, typename Hash>
+BloomTree<Key, Value, Compare, Tree, Hash>&
+BloomTree<Key, Value, Compare, Tree, Hash>::operator=(
+    BloomTree&& other) noexcept {
+  if (this != &other) {
+    BloomTree taken(std::move(other));
+    swap(taken);
+  }
+  return *this;
+}
+
+// capacity
+template <typename Key, typename Value, typename Compare,
+          template <typename, typename, typename> class Tree, typename Hash>
+void BloomTree<Key, Value, Compare, Tree, Hash>::reserve(size_type n) {
+  if constexpr (has_reserve<tree_type>::value) {
+    tree.reserve(n);
+  }
+  if (n > planned) {
+    rebuild(n);
+  }
+}
+
+template <typename Key, typename Value, typename Compare,
+          template <typename, typename, typename> class Tree, typename Hash>
+MemoryStats BloomTree<Key, Value, Compare, Tree, Hash>::memory_stats() const {
+  MemoryStats held = memory::held_by(tree);
+  held += memory::held_by(filter);
+  return memory::split(sizeof(*this) + held.total(), tree.size(),
+                       memory::element_bytes<Key, Value>(), held.allocations);
+}
+
+// modifiers
+template <typename Key, typename Value, typename Compare,
+          template <typename, typename, typename> class Tree, typename Hash>
+void BloomTree<Key, Value, Compare, Tree, Hash>::clear() {
+  tree.clear();
+  filter.clear();
+  dead = 0;
+}
+
+template <typename Key, typename Value, typename Compare,
+          template <typename, typename, typename> class Tree, typename Hash>
+void BloomTree<Key, Value, Compare, Tree, Hash>::erase(Iterator pos) {
+  size_t before = tree.size();
+  tree.erase(pos);
+  removed(before - tree.size());
+}
+
+template <typename Key, typename Value, typename Compare,
+          template <typename, typename, typename> class Tree, typename Hash>
+typename BloomTree<Key, Value, Compare, Tree, Hash>::Iterator
+BloomTree<Key, Value, Compare, Tree, Hash>::erase(Iterator first,
+                                                  Iterator last) {
+  size_t before = tree.size();
+  Iterator next = tree.erase(first, last);
+  removed(before - tree.size());
+  return next;
+}
+
+template <typename Key, typename Value, typename Compare,
+          template <typename, typename, typename> class Tree, typename Hash>
+typename BloomTree<Key, Value, Compare, Tree, Hash>::node_type
+BloomTree<Key, Value, Compare, Tree, Hash>::extract(Iterator pos) {
+  size_t before = tree.size();
+  node_type node = tree.extract(pos);
+  removed(before - tree.size());
+  return node;
+}
+
+template <typename Key, typename Value, typename Compare,
+          template <typename, typename, typename> class Tree, typename Hash>
+void BloomTree<Key, Value, Compare, Tree, Hash>::swap(BloomTree& other) {
+  tree.swap(other.tree);
+  filter.swap(other.filter);
+  std::swap(planned, other.planned);
+  std::swap(dead, other.dead);
+}
+
+// The keys of other go into the filter before the inner merge, since it
+// does not tell which of them moved; those that stay behind only cost a
+// few stray bits.
+template <typename Key, typename Value, typename Compare,
+          template <typename, typename, typename> class Tree, typename Hash>
+void BloomTree<Key, Value, Compare, Tree, Hash>::merge(BloomTree& other,
+                                                       bool multi) {
+  if (this == &other) return;
+  size_t before = tree.size();
+  bool fits = filter.size() + other.size() <= planned;
+  if (fits) {
+    for (Iterator it = other.tree.begin(); it != other.tree.end(); ++it) {
+      filter.add((*it).first);
+    }
+  }
+  tree.merge(other.tree, multi);
+  size_t moved = tree.size() - before;
+  if (!fits && moved) {
+    rebuild(2 * tree.size());
+  }
+  other.removed(moved);
+}
+
+// Both halves keep a copy of the filter, each counting the keys of the
+// other half as dead.
+template <typename Key, typename Value, typename Compare,
+          template <typename, typename, typename> class Tree, typename Hash>
+BloomTree<Key, Value, Compare, Tree, Hash>
+BloomTree<Key, Value, Compare, Tree, Hash>::split(Iterator pos) {
+  BloomTree tail(key_comp());
+  tail.tree = tree.split(pos);
+  tail.filter = filter;
+  tail.planned = planned;
+  tail.dead = dead;
+  tail.removed(tree.size());
+  removed(tail.tree.size());
+  return tail;
+}
+
+template <typename Key, typename Value, typename Compare,
+          template <typename, typename, typename> class Tree, typename Hash>
+bool BloomTree<Key, Value, Compare, Tree, Hash>::join(BloomTree& other,
+                                                      bool multi) {
+  if (!tree.join(other.tree, multi)) {
+    return false;
+  }
+  if (filter.unite(other.filter) && filter.size() <= planned) {
+    dead += other.dead;
+  } else {
+    rebuild(2 * tree.size());
+  }
+  other.filter.clear();
+  other.dead = 0;
+  return true;
+}
+
+template <typename Key, typename Value, typename Compare,
+          template <typename, typename, typename> class Tree, typename Hash>
+template <typename InputIt>
+void BloomTree<Key, Value, Compare, Tree, Hash>::assign(InputIt first,
+                                                        InputIt last,
+                                                        bool multi) {
+  tree.assign(first, last, multi);
+  rebuild(2 * tree.size());
+}
+
+template <typename Key, typename Value, typename Compare,
+          template <typename, typename, typename> class Tree, typename Hash>
+template <typename ForwardIt>
+void BloomTree<Key, Value, Compare, Tree, Hash>::assign_sorted(
+    ForwardIt first, ForwardIt last, bool multi) {
+  tree.assign_sorted(first, last, multi);
+  rebuild(2 * tree.size());
+}
+
+template <typename Key, typename Value, typename Compare,
+          template <typename, typename, typename> class Tree, typename Hash>
+template <typename InputIt>
+void BloomTree<Key, Value, Compare, Tree, Hash>::assign_parallel(
+    InputIt first, InputIt last, bool multi, bulk::Keep keep,
+    unsigned threads) {
+  tree.assign_parallel(first, last, multi, keep, threads);
+  rebuild(2 * tree.size());
+}
+
+// lookup
+template <typename Key, typename Value, typename Compare,
+          template <typename, typename, typename> class Tree, typename Hash>
+template <typename K>
+typename BloomTree<Key, Value, Compare, Tree, Hash>::Iterator
+BloomTree<Key, Value, Compare, Tree, Hash>::find(const K& key) {
+  if constexpr (std::is_same_v<K, Key>) {
+    if (!filter.may_contain(key)) return tree.end();
+  }
+  return tree.find(key);
+}
+
+template <typename Key, typename Value, typename Compare,
+          template <typename, typename, typename> class Tree, typename Hash>
+template <typename K>
+bool BloomTree<Key, Value, Compare, Tree, Hash>::contains(const K& key) {
+  if constexpr (std::is_same_v<K, Key>) {
+    if (!filter.may_contain(key)) return false;
+  }
+  return tree.contains(key);
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_CONTAINERS_S21_BLOOM_TREE_TPP_
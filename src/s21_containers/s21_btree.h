@@ -0,0 +1,239 @@
+#ifndef SRC_S21_CONTAINERS_S21_BTREE_H_
+#define SRC_S21_CONTAINERS_S21_BTREE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "s21_bulk_load.h"
+#include "s21_instrument.h"
+#include "s21_memory_stats.h"
+#include "s21_node_handle.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// B+-tree with the same interface as AVLTree, usable as the backing store of
+// set, map and multiset. Elements live in leaves sized to a few cache lines
+// and linked into a list for in-order scans; inner nodes hold only separator
+// keys and child pointers. As with any B-tree, inserting or erasing an
+// element may move its neighbours, so iterators are invalidated by both.
+// end() is the slot past the last element of the rightmost leaf, which lets
+// it be decremented like any other position.
+template <typename Key, typename Value, typename Compare = std::less<Key>>
+class BPlusTree {
+ private:
+  static constexpr size_t kCacheLine = 64;
+  static constexpr size_t kNodeBytes = 4 * kCacheLine;
+  static constexpr size_t kLeafSlots =
+      std::max<size_t>(4, kNodeBytes / sizeof(std::pair<Key, Value>));
+  static constexpr size_t kInnerSlots =
+      std::max<size_t>(4, kNodeBytes / (sizeof(Key) + sizeof(void*)));
+  static constexpr size_t kMinLeaf = kLeafSlots / 2;
+  static constexpr size_t kMinInner = kInnerSlots / 2;
+
+  struct Inner;
+  struct NodeBase {
+    Inner* parent;
+    size_t count;
+    bool leaf;
+    explicit NodeBase(bool is_leaf)
+        : parent(nullptr), count(0), leaf(is_leaf) {}
+  };
+  // one spare slot lets a full node take the new element before it splits
+  struct Leaf : NodeBase {
+    Leaf* prev;
+    Leaf* next;
+    std::pair<Key, Value> slots[kLeafSlots + 1];
+    Leaf() : NodeBase(true), prev(nullptr), next(nullptr) {}
+  };
+  // children[i] holds the keys between keys[i - 1] and keys[i]
+  struct Inner : NodeBase {
+    Key keys[kInnerSlots + 1];
+    NodeBase* children[kInnerSlots + 2];
+    Inner() : NodeBase(false) {}
+  };
+
+  NodeBase* root;
+  Leaf* leftmost;
+  Leaf* rightmost;
+  size_t items;
+  size_t leaves;  // nodes allocated, counted for memory_stats
+  size_t inners;
+  instrument::compare_t<Compare, instrument::family::b_plus_tree> comp;
+  using hooks = instrument::Hooks<instrument::family::b_plus_tree>;
+
+  // helper methods
+  template <typename K>
+  Leaf* find_leaf(const K& key, bool upper) const;
+  bool find_slot(const Key& key, bool multi, Leaf** leaf, size_t* pos) const;
+  size_t child_index(Inner* parent, NodeBase* child) const;
+  template <typename D>
+  std::pair<Leaf*, size_t> insert_at(Leaf* leaf, size_t pos, D&& data);
+  void split_leaf(Leaf* leaf);
+  void split_inner(Inner* node);
+  void insert_into_parent(NodeBase* left, const Key& key, NodeBase* right);
+  void remove_from_inner(Inner* node, size_t index);
+  void rebalance_leaf(Leaf* leaf);
+  void rebalance_inner(Inner* node);
+  void clear(NodeBase* node);
+  NodeBase* clone(const NodeBase* node, Inner* parent, Leaf*& prev);
+
+  // bulk construction
+  using traits = bulk::input_traits<Key, Value>;
+  template <typename T, typename U>
+  bool key_less(const T& a, const U& b) const;
+  template <typename Next>
+  void rebuild(size_t n, Next& next);
+
+ public:
+  class Iterator;
+  class ConstIterator;
+  using key_type = Key;
+  using value_type = Value;
+  using size_type = size_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+  using node_type = ValueHandle<Key, Value>;
+
+ public:
+  class Iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::pair<Key, Value>;
+    using pointer = value_type*;
+    using reference = value_type&;
+    Iterator() : leaf(nullptr), index(0) {}
+    Iterator(Leaf* node, size_type pos) : leaf(node), index(pos) {}
+    Iterator& operator++();
+    Iterator operator++(int);
+    Iterator& operator--();
+    Iterator operator--(int);
+    bool operator!=(const Iterator& other) const;
+    bool operator==(const Iterator& other) const;
+    reference operator*() const;
+
+   protected:
+    Leaf* leaf;
+    size_type index;
+    friend class BPlusTree;
+  };
+
+  class ConstIterator : public Iterator {
+   public:
+    using Iterator::Iterator;
+    ConstIterator() : Iterator() {}
+    ConstIterator(const Iterator& it) : Iterator(it) {}
+    const typename Iterator::value_type& operator*() const {
+      return Iterator::operator*();
+    }
+  };
+
+ public:
+  // constructors
+  BPlusTree() : BPlusTree(Compare()) {}
+  explicit BPlusTree(const Compare& compare)
+      : root(nullptr),
+        leftmost(nullptr),
+        rightmost(nullptr),
+        items(0),
+        leaves(0),
+        inners(0),
+        comp(compare) {}
+  BPlusTree(const BPlusTree& tree);
+  BPlusTree(BPlusTree&& tree) noexcept;
+
+  // destructor
+  ~BPlusTree();
+
+  // assignment
+  BPlusTree& operator=(const BPlusTree& tree);
+  BPlusTree& operator=(BPlusTree&& tree) noexcept;
+
+  // Iterators
+  Iterator begin();
+  Iterator end();
+  ConstIterator cbegin() const;
+  ConstIterator cend() const;
+
+  // capacity
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  MemoryStats memory_stats() const;
+  size_type memory_usage() const { return memory_stats().total(); }
+
+  // modifiers
+  void clear();
+  std::pair<Iterator, bool> insert(const std::pair<Key, Value>& data,
+                                   bool multi);
+  std::pair<Iterator, bool> insert(std::pair<Key, Value>&& data, bool multi);
+  std::pair<Iterator, bool> insert(Iterator hint,
+                                   const std::pair<Key, Value>& data,
+                                   bool multi);
+  std::pair<Iterator, bool> insert(Iterator hint, std::pair<Key, Value>&& data,
+                                   bool multi);
+  template <typename... Args>
+  std::pair<Iterator, bool> emplace(bool multi, Args&&... args);
+  template <typename K, typename... Args>
+  std::pair<Iterator, bool> try_emplace(K&& key, Args&&... args);
+  void erase(Iterator pos);
+  Iterator erase(Iterator first, Iterator last);
+  node_type extract(Iterator pos);
+  std::pair<Iterator, bool> insert(node_type& node, bool multi);
+  void swap(BPlusTree& other);
+  void merge(BPlusTree& other, bool multi);
+  // as in AVLTree; split and range erase rebuild the leaves in one linear
+  // pass, join appends other to the facing end leaf
+  BPlusTree split(Iterator pos);
+  bool join(BPlusTree& other, bool multi);
+  template <typename InputIt>
+  void assign(InputIt first, InputIt last, bool multi);
+  template <typename ForwardIt>
+  void assign_sorted(ForwardIt first, ForwardIt last, bool multi);
+  template <typename InputIt>
+  void assign_parallel(InputIt first, InputIt last, bool multi,
+                       bulk::Keep keep, unsigned threads);
+
+  // lookup: K is key_type or, with a transparent Compare, anything that
+  // compares against it
+  template <typename K>
+  Iterator lower_bound(const K& key);
+  template <typename K>
+  Iterator upper_bound(const K& key);
+  template <typename K>
+  Iterator find(const K& key);
+  template <typename K>
+  bool contains(const K& key);
+  // as in AVLTree; every leaf is equally deep, so the kBatch searches of a
+  // batch step through the levels together, prefetching each next node
+  template <typename ForwardIt, typename Emit>
+  void find_many(ForwardIt first, ForwardIt last, Emit emit);
+
+  // observers
+  Compare key_comp() const { return comp; }
+
+ private:
+  static constexpr size_t kBatch = 16;
+  template <typename K>
+  Iterator leaf_lower_bound(Leaf* leaf, const K& key) const;
+  template <typename D>
+  std::pair<Iterator, bool> insert_data(D&& data, bool multi);
+  template <typename D>
+  std::pair<Iterator, bool> insert_hint_data(Iterator hint, D&& data,
+                                             bool multi);
+};
+
+}  // namespace s21
+
+#include "s21_btree.tpp"
+
+#endif  // SRC_S21_CONTAINERS_S21_BTREE_H_
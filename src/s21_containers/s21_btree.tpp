@@ -0,0 +1,984 @@
+#ifndef SRC_S21_CONTAINERS_S21_BTREE_TPP_
+#define SRC_S21_CONTAINERS_S21_BTREE_TPP_
+
+#include "s21_btree.h"
+
+namespace s21 {
+
+// Descends to the leaf that holds the first element not less than key, or
+// with upper set, the first element greater than key (the element itself may
+// be the first one of the next leaf).
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+typename BPlusTree<Key, Value, Compare>::Leaf*
+BPlusTree<Key, Value, Compare>::find_leaf(const K& key, bool upper) const {
+  NodeBase* node = root;
+  while (!node->leaf) {
+    Inner* inner = static_cast<Inner*>(node);
+    Key* end = inner->keys + inner->count;
+    Key* pos = upper ? std::upper_bound(inner->keys, end, key, comp)
+                     : std::lower_bound(inner->keys, end, key, comp);
+    node = inner->children[pos - inner->keys];
+  }
+  return static_cast<Leaf*>(node);
+}
+
+// The first element not less than key, given the leaf find_leaf picked.
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+typename BPlusTree<Key, Value, Compare>::Iterator
+BPlusTree<Key, Value, Compare>::leaf_lower_bound(Leaf* leaf,
+                                                 const K& key) const {
+  std::pair<Key, Value>* pos = std::lower_bound(
+      leaf->slots, leaf->slots + leaf->count, key,
+      [this](const std::pair<Key, Value>& slot, const K& k) {
+        return comp(slot.first, k);
+      });
+  size_t index = pos - leaf->slots;
+  if (index == leaf->count && leaf->next) {
+    return Iterator(leaf->next, 0);
+  }
+  return Iterator(leaf, index);
+}
+
+template <typename Key, typename Value, typename Compare>
+size_t BPlusTree<Key, Value, Compare>::child_index(Inner* parent,
+                                          NodeBase* child) const {
+  size_t i = 0;
+  while (parent->children[i] != child) ++i;
+  return i;
+}
+
+// Puts data into slot pos of leaf (a new root leaf when leaf is null),
+// splits the leaf if it overflows and returns where the element ended up.
+template <typename Key, typename Value, typename Compare>
+template <typename D>
+std::pair<typename BPlusTree<Key, Value, Compare>::Leaf*, size_t>
+BPlusTree<Key, Value, Compare>::insert_at(Leaf* leaf, size_t pos, D&& data) {
+  if (!leaf) {
+    leaf = new Leaf;
+    ++leaves;
+    hooks::allocated();
+    root = leftmost = rightmost = leaf;
+  }
+  for (size_t i = leaf->count; i > pos; --i) {
+    leaf->slots[i] = std::move(leaf->slots[i - 1]);
+  }
+  leaf->slots[pos] = std::forward<D>(data);
+  ++leaf->count;
+  ++items;
+  if (leaf->count > kLeafSlots) {
+    split_leaf(leaf);
+    if (pos >= leaf->count) {
+      return std::make_pair(leaf->next, pos - leaf->count);
+    }
+  }
+  return std::make_pair(leaf, pos);
+}
+
+template <typename Key, typename Value, typename Compare>
+void BPlusTree<Key, Value, Compare>::split_leaf(Leaf* leaf) {
+  Leaf* right = new Leaf;
+  ++leaves;
+  hooks::allocated();
+  size_t mid = leaf->count / 2;
+  for (size_t i = mid; i < leaf->count; ++i) {
+    right->slots[i - mid] = std::move(leaf->slots[i]);
+  }
+  right->count = leaf->count - mid;
+  leaf->count = mid;
+  right->prev = leaf;
+  right->next = leaf->next;
+  if (leaf->next) {
+    leaf->next->prev = right;
+  } else {
+    rightmost = right;
+  }
+  leaf->next = right;
+  insert_into_parent(leaf, right->slots[0].first, right);
+}
+
+// The middle key moves up, the keys after it go to the new right node.
+template <typename Key, typename Value, typename Compare>
+void BPlusTree<Key, Value, Compare>::split_inner(Inner* node) {
+  Inner* right = new Inner;
+  ++inners;
+  hooks::allocated();
+  size_t mid = node->count / 2;
+  right->count = node->count - mid - 1;
+  for (size_t i = 0; i < right->count; ++i) {
+    right->keys[i] = std::move(node->keys[mid + 1 + i]);
+  }
+  for (size_t i = 0; i <= right->count; ++i) {
+    right->children[i] = node->children[mid + 1 + i];
+    right->children[i]->parent = right;
+  }
+  node->count = mid;
+  insert_into_parent(node, node->keys[mid], right);
+}
+
+template <typename Key, typename Value, typename Compare>
+void BPlusTree<Key, Value, Compare>::insert_into_parent(NodeBase* left,
+                                                        const Key& key,
+                                                        NodeBase* right) {
+  Inner* parent = left->parent;
+  if (!parent) {
+    Inner* new_root = new Inner;
+    ++inners;
+    hooks::allocated();
+    new_root->keys[0] = key;
+    new_root->children[0] = left;
+    new_root->children[1] = right;
+    new_root->count = 1;
+    left->parent = new_root;
+    right->parent = new_root;
+    root = new_root;
+    return;
+  }
+  size_t i = child_index(parent, left);
+  for (size_t j = parent->count; j > i; --j) {
+    parent->keys[j] = std::move(parent->keys[j - 1]);
+    parent->children[j + 1] = parent->children[j];
+  }
+  parent->keys[i] = key;
+  parent->children[i + 1] = right;
+  right->parent = parent;
+  ++parent->count;
+  if (parent->count > kInnerSlots) {
+    split_inner(parent);
+  }
+}
+
+// Drops keys[index] together with the child to its right.
+template <typename Key, typename Value, typename Compare>
+void BPlusTree<Key, Value, Compare>::remove_from_inner(Inner* node,
+                                                       size_t index) {
+  for (size_t j = index + 1; j < node->count; ++j) {
+    node->keys[j - 1] = std::move(node->keys[j]);
+  }
+  for (size_t j = index + 2; j <= node->count; ++j) {
+    node->children[j - 1] = node->children[j];
+  }
+  --node->count;
+}
+
+// An underfull leaf borrows an element from a sibling that can spare one,
+// otherwise it is merged with a sibling and the parent loses a separator.
+template <typename Key, typename Value, typename Compare>
+void BPlusTree<Key, Value, Compare>::rebalance_leaf(Leaf* leaf) {
+  if (leaf == root) {
+    if (leaf->count == 0) {
+      delete leaf;
+      --leaves;
+      hooks::deallocated();
+      root = leftmost = rightmost = nullptr;
+    }
+    return;
+  }
+  if (leaf->count >= kMinLeaf) {
+    return;
+  }
+  Inner* parent = leaf->parent;
+  size_t i = child_index(parent, leaf);
+  Leaf* left = i > 0 ? static_cast<Leaf*>(parent->children[i - 1]) : nullptr;
+  Leaf* right =
+      i < parent->count ? static_cast<Leaf*>(parent->children[i + 1]) : nullptr;
+  if (left && left->count > kMinLeaf) {
+    for (size_t j = leaf->count; j > 0; --j) {
+      leaf->slots[j] = std::move(leaf->slots[j - 1]);
+    }
+    leaf->slots[0] = std::move(left->slots[--left->count]);
+    ++leaf->count;
+    parent->keys[i - 1] = leaf->slots[0].first;
+  } else if (right && right->count > kMinLeaf) {
+    leaf->slots[leaf->count++] = std::move(right->slots[0]);
+    for (size_t j = 1; j < right->count; ++j) {
+      right->slots[j - 1] = std::move(right->slots[j]);
+    }
+    --right->count;
+    parent->keys[i] = right->slots[0].first;
+  } else {
+    if (left) --i;
+    Leaf* a = left ? left : leaf;
+    Leaf* b = left ? leaf : right;
+    for (size_t j = 0; j < b->count; ++j) {
+      a->slots[a->count + j] = std::move(b->slots[j]);
+    }
+    a->count += b->count;
+    a->next = b->next;
+    if (b->next) {
+      b->next->prev = a;
+    } else {
+      rightmost = a;
+    }
+    delete b;
+    --leaves;
+    hooks::deallocated();
+    remove_from_inner(parent, i);
+    rebalance_inner(parent);
+  }
+}
+
+// Same as rebalance_leaf, except that the separator in the parent rotates
+// through when borrowing and moves down when merging.
+template <typename Key, typename Value, typename Compare>
+void BPlusTree<Key, Value, Compare>::rebalance_inner(Inner* node) {
+  if (node == root) {
+    if (node->count == 0) {
+      root = node->children[0];
+      root->parent = nullptr;
+      delete node;
+      --inners;
+      hooks::deallocated();
+    }
+    return;
+  }
+  if (node->count >= kMinInner) {
+    return;
+  }
+  Inner* parent = node->parent;
+  size_t i = child_index(parent, node);
+  Inner* left = i > 0 ? static_cast<Inner*>(parent->children[i - 1]) : nullptr;
+  Inner* right = i < parent->count
+                     ? static_cast<Inner*>(parent->children[i + 1])
+                     : nullptr;
+  if (left && left->count > kMinInner) {
+    for (size_t j = node->count; j > 0; --j) {
+      node->keys[j] = std::move(node->keys[j - 1]);
+    }
+    for (size_t j = node->count + 1; j > 0; --j) {
+      node->children[j] = node->children[j - 1];
+    }
+    node->keys[0] = std::move(parent->keys[i - 1]);
+    node->children[0] = left->children[left->count];
+    node->children[0]->parent = node;
+    parent->keys[i - 1] = std::move(left->keys[left->count - 1]);
+    --left->count;
+    ++node->count;
+  } else if (right && right->count > kMinInner) {
+    node->keys[node->count] = std::move(parent->keys[i]);
+    node->children[node->count + 1] = right->children[0];
+    node->children[node->count + 1]->parent = node;
+    ++node->count;
+    parent->keys[i] = std::move(right->keys[0]);
+    for (size_t j = 1; j < right->count; ++j) {
+      right->keys[j - 1] = std::move(right->keys[j]);
+    }
+    for (size_t j = 1; j <= right->count; ++j) {
+      right->children[j - 1] = right->children[j];
+    }
+    --right->count;
+  } else {
+    if (left) --i;
+    Inner* a = left ? left : node;
+    Inner* b = left ? node : right;
+    a->keys[a->count] = std::move(parent->keys[i]);
+    for (size_t j = 0; j < b->count; ++j) {
+      a->keys[a->count + 1 + j] = std::move(b->keys[j]);
+    }
+    for (size_t j = 0; j <= b->count; ++j) {
+      a->children[a->count + 1 + j] = b->children[j];
+      b->children[j]->parent = a;
+    }
+    a->count += b->count + 1;
+    delete b;
+    --inners;
+    hooks::deallocated();
+    remove_from_inner(parent, i);
+    rebalance_inner(parent);
+  }
+}
+
+template <typename Key, typename Value, typename Compare>
+void BPlusTree<Key, Value, Compare>::clear(NodeBase* node) {
+  if (!node) {
+    return;
+  }
+  hooks::deallocated();
+  if (node->leaf) {
+    delete static_cast<Leaf*>(node);
+    return;
+  }
+  Inner* inner = static_cast<Inner*>(node);
+  for (size_t i = 0; i <= inner->count; ++i) {
+    clear(inner->children[i]);
+  }
+  delete inner;
+}
+
+template <typename Key, typename Value, typename Compare>
+typename BPlusTree<Key, Value, Compare>::NodeBase*
+BPlusTree<Key, Value, Compare>::clone(const NodeBase* node, Inner* parent,
+                                      Leaf*& prev) {
+  if (node->leaf) {
+    const Leaf* src = static_cast<const Leaf*>(node);
+    Leaf* leaf = new Leaf;
+    ++leaves;
+    hooks::allocated();
+    std::copy(src->slots, src->slots + src->count, leaf->slots);
+    leaf->count = src->count;
+    leaf->parent = parent;
+    leaf->prev = prev;
+    if (prev) {
+      prev->next = leaf;
+    } else {
+      leftmost = leaf;
+    }
+    rightmost = leaf;
+    prev = leaf;
+    return leaf;
+  }
+  const Inner* src = static_cast<const Inner*>(node);
+  Inner* inner = new Inner;
+  ++inners;
+  hooks::allocated();
+  std::copy(src->keys, src->keys + src->count, inner->keys);
+  inner->count = src->count;
+  inner->parent = parent;
+  for (size_t i = 0; i <= src->count; ++i) {
+    inner->children[i] = clone(src->children[i], inner, prev);
+  }
+  return inner;
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename T, typename U>
+bool BPlusTree<Key, Value, Compare>::key_less(const T& a, const U& b) const {
+  return comp(traits::key_of(a), traits::key_of(b));
+}
+
+// Packs the elements into full leaves (spread evenly, so none is underfull)
+// and then builds each inner level from the one below it.
+template <typename Key, typename Value, typename Compare>
+template <typename Next>
+void BPlusTree<Key, Value, Compare>::rebuild(size_t n, Next& next) {
+  BPlusTree built(comp);
+  if (n) {
+    vector<NodeBase*> level;
+    vector<Key> mins;
+    size_t leaf_count = (n + kLeafSlots - 1) / kLeafSlots;
+    Leaf* prev = nullptr;
+    for (size_t l = 0; l < leaf_count; ++l) {
+      Leaf* leaf = new Leaf;
+      ++built.leaves;
+      hooks::allocated();
+      leaf->count = n / leaf_count + (l < n % leaf_count ? 1 : 0);
+      for (size_t j = 0; j < leaf->count; ++j) {
+        leaf->slots[j] = next();
+      }
+      leaf->prev = prev;
+      if (prev) {
+        prev->next = leaf;
+      } else {
+        built.leftmost = leaf;
+      }
+      prev = leaf;
+      level.push_back(leaf);
+      mins.push_back(leaf->slots[0].first);
+    }
+    built.rightmost = prev;
+    while (level.size() > 1) {
+      size_t children = level.size();
+      size_t parents = (children + kInnerSlots) / (kInnerSlots + 1);
+      vector<NodeBase*> upper;
+      vector<Key> upper_mins;
+      NodeBase** child = level.data();
+      Key* min = mins.data();
+      for (size_t p = 0; p < parents; ++p) {
+        Inner* inner = new Inner;
+        ++built.inners;
+        hooks::allocated();
+        size_t take = children / parents + (p < children % parents ? 1 : 0);
+        upper.push_back(inner);
+        upper_mins.push_back(*min);
+        for (size_t j = 0; j < take; ++j, ++child, ++min) {
+          inner->children[j] = *child;
+          (*child)->parent = inner;
+          if (j > 0) inner->keys[j - 1] = *min;
+        }
+        inner->count = take - 1;
+      }
+      level.swap(upper);
+      mins.swap(upper_mins);
+    }
+    built.root = level.data()[0];
+    built.items = n;
+  }
+  swap(built);
+}
+
+// Iterator
+template <typename Key, typename Value, typename Compare>
+typename BPlusTree<Key, Value, Compare>::Iterator&
+BPlusTree<Key, Value, Compare>::Iterator::operator++() {
+  if (++index >= leaf->count && leaf->next) {
+    leaf = leaf->next;
+    index = 0;
+  }
+  return *this;
+}
+
+template <typename Key, typename Value, typename Compare>
+typename BPlusTree<Key, Value, Compare>::Iterator
+BPlusTree<Key, Value, Compare>::Iterator::operator++(int) {
+  Iterator it(*this);
+  ++(*this);
+  return it;
+}
+
+template <typename Key, typename Value, typename Compare>
+typename BPlusTree<Key, Value, Compare>::Iterator&
+BPlusTree<Key, Value, Compare>::Iterator::operator--() {
+  if (index == 0) {
+    leaf = leaf->prev;
+    index = leaf->count;
+  }
+  --index;
+  return *this;
+}
+
+template <typename Key, typename Value, typename Compare>
+typename BPlusTree<Key, Value, Compare>::Iterator
+BPlusTree<Key, Value, Compare>::Iterator::operator--(int) {
+  Iterator it(*this);
+  --(*this);
+  return it;
+}
+
+template <typename Key, typename Value, typename Compare>
+bool BPlusTree<Key, Value, Compare>::Iterator::operator!=(
+    const Iterator& other) const {
+  return !(*this == other);
+}
+
+template <typename Key, typename Value, typename Compare>
+bool BPlusTree<Key, Value, Compare>::Iterator::operator==(
+    const Iterator& other) const {
+  return leaf == other.leaf && index == other.index;
+}
+
+template <typename Key, typename Value, typename Compare>
+typename BPlusTree<Key, Value, Compare>::Iterator::reference
+BPlusTree<Key, Value, Compare>::Iterator::operator*() const {
+  if (!leaf || index >= leaf->count) {
+    throw std::out_of_range("Dereferencing end() iterator");
+  }
+  return leaf->slots[index];
+}
+
+// constructors
+template <typename Key, typename Value, typename Compare>
+BPlusTree<Key, Value, Compare>::BPlusTree(const BPlusTree& tree)
+    : root(nullptr),
+      leftmost(nullptr),
+      rightmost(nullptr),
+      items(tree.items),
+      leaves(0),
+      inners(0),
+      comp(tree.comp) {
+  Leaf* prev = nullptr;
+  if (tree.root) {
+    root = clone(tree.root, nullptr, prev);
+  }
+}
+
+template <typename Key, typename Value, typename Compare>
+BPlusTree<Key, Value, Compare>::BPlusTree(BPlusTree&& tree) noexcept
+    : BPlusTree(tree.comp) {
+  swap(tree);
+}
+
+// destructor
+template <typename Key, typename Value, typename Compare>
+BPlusTree<Key, Value, Compare>::~BPlusTree() {
+  clear(root);
+}
+
+// assignment
+template <typename Key, typename Value, typename Compare>
+BPlusTree<Key, Value, Compare>& BPlusTree<Key, Value, Compare>::operator=(
+    const BPlusTree& tree) {
+  if (this != &tree) {
+    BPlusTree copy(tree);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <typename Key, typename Value, typename Compare>
+BPlusTree<Key, Value, Compare>& BPlusTree<Key, Value, Compare>::operator=(
+    BPlusTree&& tree) noexcept {
+  if (this != &tree) {
+    clear();
+    swap(tree);
+  }
+  return *this;
+}
+
+// Iterators
+template <typename Key, typename Value, typename Compare>
+typename BPlusTree<Key, Value, Compare>::Iterator
+BPlusTree<Key, Value, Compare>::begin() {
+  return Iterator(leftmost, 0);
+}
+
+template <typename Key, typename Value, typename Compare>
+typename BPlusTree<Key, Value, Compare>::Iterator
+BPlusTree<Key, Value, Compare>::end() {
+  return Iterator(rightmost, rightmost ? rightmost->count : 0);
+}
+
+template <typename Key, typename Value, typename Compare>
+typename BPlusTree<Key, Value, Compare>::ConstIterator
+BPlusTree<Key, Value, Compare>::cbegin() const {
+  return ConstIterator(leftmost, 0);
+}
+
+template <typename Key, typename Value, typename Compare>
+typename BPlusTree<Key, Value, Compare>::ConstIterator
+BPlusTree<Key, Value, Compare>::cend() const {
+  return ConstIterator(rightmost, rightmost ? rightmost->count : 0);
+}
+
+// Capacity
+template <typename Key, typename Value, typename Compare>
+bool BPlusTree<Key, Value, Compare>::empty() const {
+  return items == 0;
+}
+
+template <typename Key, typename Value, typename Compare>
+typename BPlusTree<Key, Value, Compare>::size_type
+BPlusTree<Key, Value, Compare>::size() const {
+  return items;
+}
+
+template <typename Key, typename Value, typename Compare>
+typename BPlusTree<Key, Value, Compare>::size_type
+BPlusTree<Key, Value, Compare>::max_size() const {
+  return std::numeric_limits<size_type>::max() /
+         sizeof(std::pair<Key, Value>);
+}
+
+// empty leaf slots, separator keys and child pointers are all overhead
+template <typename Key, typename Value, typename Compare>
+MemoryStats BPlusTree<Key, Value, Compare>::memory_stats() const {
+  size_t bytes =
+      sizeof(*this) + leaves * sizeof(Leaf) + inners * sizeof(Inner);
+  return memory::split(bytes, items, memory::element_bytes<Key, Value>(),
+                       leaves + inners);
+}
+
+// Modifiers
+template <typename Key, typename Value, typename Compare>
+void BPlusTree<Key, Value, Compare>::clear() {
+  clear(root);
+  root = leftmost = rightmost = nullptr;
+  items = leaves = inners = 0;
+}
+
+// Returns true with *leaf and *pos at the element that blocks a unique
+// insert, otherwise false with *leaf and *pos where insert_at should put
+// the key (a null leaf in an empty tree).
+template <typename Key, typename Value, typename Compare>
+bool BPlusTree<Key, Value, Compare>::find_slot(const Key& key, bool multi,
+                                               Leaf** leaf,
+                                               size_t* pos) const {
+  *leaf = nullptr;
+  *pos = 0;
+  if (!root) {
+    return false;
+  }
+  auto slot_less = [this](const std::pair<Key, Value>& slot, const Key& k) {
+    return comp(slot.first, k);
+  };
+  auto key_less_slot = [this](const Key& k,
+                              const std::pair<Key, Value>& slot) {
+    return comp(k, slot.first);
+  };
+  Leaf* found = find_leaf(key, multi);
+  std::pair<Key, Value>* end = found->slots + found->count;
+  *leaf = found;
+  if (multi) {
+    *pos = std::upper_bound(found->slots, end, key, key_less_slot) -
+           found->slots;
+    return false;
+  }
+  *pos = std::lower_bound(found->slots, end, key, slot_less) - found->slots;
+  if (*pos < found->count) {
+    return !comp(key, found->slots[*pos].first);
+  }
+  if (found->next && !comp(key, found->next->slots[0].first)) {
+    *leaf = found->next;
+    *pos = 0;
+    return true;
+  }
+  return false;
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename D>
+std::pair<typename BPlusTree<Key, Value, Compare>::Iterator, bool>
+BPlusTree<Key, Value, Compare>::insert_data(D&& data, bool multi) {
+  Leaf* leaf;
+  size_t pos;
+  if (find_slot(data.first, multi, &leaf, &pos)) {
+    return std::make_pair(Iterator(leaf, pos), false);
+  }
+  std::pair<Leaf*, size_t> at = insert_at(leaf, pos, std::forward<D>(data));
+  return std::make_pair(Iterator(at.first, at.second), true);
+}
+
+template <typename Key, typename Value, typename Compare>
+std::pair<typename BPlusTree<Key, Value, Compare>::Iterator, bool>
+BPlusTree<Key, Value, Compare>::insert(const std::pair<Key, Value>& data,
+                                       bool multi) {
+  return insert_data(data, multi);
+}
+
+template <typename Key, typename Value, typename Compare>
+std::pair<typename BPlusTree<Key, Value, Compare>::Iterator, bool>
+BPlusTree<Key, Value, Compare>::insert(std::pair<Key, Value>&& data,
+                                       bool multi) {
+  return insert_data(std::move(data), multi);
+}
+
+// Leaf slots are assigned rather than constructed, so the element is built
+// on the side and moved in.
+template <typename Key, typename Value, typename Compare>
+template <typename... Args>
+std::pair<typename BPlusTree<Key, Value, Compare>::Iterator, bool>
+BPlusTree<Key, Value, Compare>::emplace(bool multi, Args&&... args) {
+  return insert_data(std::pair<Key, Value>(std::forward<Args>(args)...),
+                     multi);
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename K, typename... Args>
+std::pair<typename BPlusTree<Key, Value, Compare>::Iterator, bool>
+BPlusTree<Key, Value, Compare>::try_emplace(K&& key, Args&&... args) {
+  Leaf* leaf;
+  size_t pos;
+  if (find_slot(key, false, &leaf, &pos)) {
+    return std::make_pair(Iterator(leaf, pos), false);
+  }
+  std::pair<Key, Value> data(
+      std::piecewise_construct, std::forward_as_tuple(std::forward<K>(key)),
+      std::forward_as_tuple(std::forward<Args>(args)...));
+  std::pair<Leaf*, size_t> at = insert_at(leaf, pos, std::move(data));
+  return std::make_pair(Iterator(at.first, at.second), true);
+}
+
+// Moves the element in; the handle keeps it when a unique insert finds the
+// key taken.
+template <typename Key, typename Value, typename Compare>
+std::pair<typename BPlusTree<Key, Value, Compare>::Iterator, bool>
+BPlusTree<Key, Value, Compare>::insert(node_type& node, bool multi) {
+  if (node.empty()) {
+    return std::make_pair(end(), false);
+  }
+  std::pair<Iterator, bool> result = insert_data(std::move(*node.data), multi);
+  if (result.second) node.data.reset();
+  return result;
+}
+
+// Accepts the hint only when the key fits right before it (or right after
+// it) inside the same leaf, or extends the first or last leaf, so the
+// separators above stay valid. Otherwise the plain insert descends from the
+// root.
+template <typename Key, typename Value, typename Compare>
+template <typename D>
+std::pair<typename BPlusTree<Key, Value, Compare>::Iterator, bool>
+BPlusTree<Key, Value, Compare>::insert_hint_data(Iterator hint, D&& data,
+                                                 bool multi) {
+  if (!root) {
+    return insert_data(std::forward<D>(data), multi);
+  }
+  const Key& key = data.first;
+  Leaf* leaf = hint.leaf ? hint.leaf : rightmost;
+  size_t pos = hint.leaf ? hint.index : rightmost->count;
+  if (pos < leaf->count && comp(leaf->slots[pos].first, key)) ++pos;
+  bool inside = pos > 0 ? pos < leaf->count || leaf == rightmost
+                        : leaf == leftmost;
+  if (inside) {
+    bool after_prev =
+        pos == 0 || (multi ? !comp(key, leaf->slots[pos - 1].first)
+                           : comp(leaf->slots[pos - 1].first, key));
+    bool before_next =
+        pos == leaf->count || (multi ? !comp(leaf->slots[pos].first, key)
+                                     : comp(key, leaf->slots[pos].first));
+    if (after_prev && before_next) {
+      std::pair<Leaf*, size_t> at = insert_at(leaf, pos, std::forward<D>(data));
+      return std::make_pair(Iterator(at.first, at.second), true);
+    }
+  }
+  return insert_data(std::forward<D>(data), multi);
+}
+
+template <typename Key, typename Value, typename Compare>
+std::pair<typename BPlusTree<Key, Value, Compare>::Iterator, bool>
+BPlusTree<Key, Value, Compare>::insert(Iterator hint,
+                                       const std::pair<Key, Value>& data,
+                                       bool multi) {
+  return insert_hint_data(hint, data, multi);
+}
+
+template <typename Key, typename Value, typename Compare>
+std::pair<typename BPlusTree<Key, Value, Compare>::Iterator, bool>
+BPlusTree<Key, Value, Compare>::insert(Iterator hint,
+                                       std::pair<Key, Value>&& data,
+                                       bool multi) {
+  return insert_hint_data(hint, std::move(data), multi);
+}
+
+template <typename Key, typename Value, typename Compare>
+void BPlusTree<Key, Value, Compare>::erase(Iterator pos) {
+  Leaf* leaf = pos.leaf;
+  if (!leaf || pos.index >= leaf->count) {
+    return;
+  }
+  for (size_t i = pos.index + 1; i < leaf->count; ++i) {
+    leaf->slots[i - 1] = std::move(leaf->slots[i]);
+  }
+  --leaf->count;
+  --items;
+  leaf->slots[leaf->count] = std::pair<Key, Value>();
+  rebalance_leaf(leaf);
+}
+
+// Erasing one element at a time could shift both ends of the range between
+// leaves, so the survivors are moved into freshly packed leaves instead.
+template <typename Key, typename Value, typename Compare>
+typename BPlusTree<Key, Value, Compare>::Iterator
+BPlusTree<Key, Value, Compare>::erase(Iterator first, Iterator last) {
+  if (first == last) {
+    return last;
+  }
+  size_t before = 0;
+  size_t removed = 0;
+  for (Iterator it = begin(); it != first; ++it) ++before;
+  for (Iterator it = first; it != last; ++it) ++removed;
+  Iterator it = begin();
+  auto next = [&it, first, last]() {
+    if (it == first) it = last;
+    return std::move(*it++);
+  };
+  rebuild(items - removed, next);
+  return std::next(begin(), before);
+}
+
+template <typename Key, typename Value, typename Compare>
+typename BPlusTree<Key, Value, Compare>::node_type
+BPlusTree<Key, Value, Compare>::extract(Iterator pos) {
+  if (!pos.leaf || pos.index >= pos.leaf->count) {
+    return node_type();
+  }
+  node_type node(std::move(pos.leaf->slots[pos.index]));
+  erase(pos);
+  return node;
+}
+
+template <typename Key, typename Value, typename Compare>
+void BPlusTree<Key, Value, Compare>::swap(BPlusTree& other) {
+  std::swap(root, other.root);
+  std::swap(leftmost, other.leftmost);
+  std::swap(rightmost, other.rightmost);
+  std::swap(items, other.items);
+  std::swap(leaves, other.leaves);
+  std::swap(inners, other.inners);
+  std::swap(comp, other.comp);
+}
+
+// Moves every element that this tree accepts and rebuilds other from the
+// rest, since erasing one element at a time would invalidate the iteration.
+template <typename Key, typename Value, typename Compare>
+void BPlusTree<Key, Value, Compare>::merge(BPlusTree& other, bool multi) {
+  if (this == &other) {
+    return;
+  }
+  vector<std::pair<Key, Value>> kept;
+  for (auto it = other.begin(); it != other.end(); ++it) {
+    if (multi || !contains((*it).first)) {
+      insert(std::move(*it), multi);
+    } else {
+      kept.push_back(std::move(*it));
+    }
+  }
+  std::pair<Key, Value>* item = kept.data();
+  auto next = [&item]() { return std::move(*item++); };
+  other.rebuild(kept.size(), next);
+}
+
+template <typename Key, typename Value, typename Compare>
+BPlusTree<Key, Value, Compare> BPlusTree<Key, Value, Compare>::split(
+    Iterator pos) {
+  BPlusTree tail(comp);
+  size_t moved = 0;
+  for (Iterator it = pos; it != end(); ++it) ++moved;
+  if (!moved) {
+    return tail;
+  }
+  auto take = [&pos]() { return std::move(*pos++); };
+  tail.rebuild(moved, take);
+  Iterator it = begin();
+  auto keep = [&it]() { return std::move(*it++); };
+  rebuild(items - moved, keep);
+  return tail;
+}
+
+// Appending to the last leaf (or prepending to the first) leaves every
+// separator valid, so the elements of other go in without a search.
+template <typename Key, typename Value, typename Compare>
+bool BPlusTree<Key, Value, Compare>::join(BPlusTree& other, bool multi) {
+  if (this == &other) {
+    return false;
+  }
+  if (other.empty()) {
+    return true;
+  }
+  if (empty()) {
+    swap(other);
+    return true;
+  }
+  auto before = [this, multi](const Key& a, const Key& b) {
+    return multi ? !comp(b, a) : comp(a, b);
+  };
+  if (before(rightmost->slots[rightmost->count - 1].first,
+             other.leftmost->slots[0].first)) {
+    for (auto it = other.begin(); it != other.end(); ++it) {
+      insert_at(rightmost, rightmost->count, std::move(*it));
+    }
+  } else if (before(other.rightmost->slots[other.rightmost->count - 1].first,
+                    leftmost->slots[0].first)) {
+    for (auto it = other.end(); it != other.begin();) {
+      insert_at(leftmost, 0, std::move(*--it));
+    }
+  } else {
+    return false;
+  }
+  other.clear();
+  return true;
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename InputIt>
+void BPlusTree<Key, Value, Compare>::assign(InputIt first, InputIt last,
+                                            bool multi) {
+  bulk::assign<Key, Value>(
+      first, last, multi,
+      [this](const auto& a, const auto& b) { return key_less(a, b); },
+      [this](size_t n, auto& next) { rebuild(n, next); });
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename ForwardIt>
+void BPlusTree<Key, Value, Compare>::assign_sorted(ForwardIt first,
+                                                   ForwardIt last, bool multi) {
+  bulk::assign_sorted<Key, Value>(
+      first, last, multi,
+      [this](const auto& a, const auto& b) { return key_less(a, b); },
+      [this](size_t n, auto& next) { rebuild(n, next); });
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename InputIt>
+void BPlusTree<Key, Value, Compare>::assign_parallel(InputIt first,
+                                                     InputIt last, bool multi,
+                                                     bulk::Keep keep,
+                                                     unsigned threads) {
+  bulk::assign_parallel<Key, Value>(
+      first, last, multi, keep, threads,
+      [this](const auto& a, const auto& b) { return key_less(a, b); },
+      [this](size_t n, auto& next) { rebuild(n, next); });
+}
+
+// Lookup
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+typename BPlusTree<Key, Value, Compare>::Iterator
+BPlusTree<Key, Value, Compare>::lower_bound(const K& key) {
+  if (!root) {
+    return end();
+  }
+  return leaf_lower_bound(find_leaf(key, false), key);
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+typename BPlusTree<Key, Value, Compare>::Iterator
+BPlusTree<Key, Value, Compare>::upper_bound(const K& key) {
+  if (!root) {
+    return end();
+  }
+  Leaf* leaf = find_leaf(key, true);
+  std::pair<Key, Value>* pos = std::upper_bound(
+      leaf->slots, leaf->slots + leaf->count, key,
+      [this](const K& k, const std::pair<Key, Value>& slot) {
+        return comp(k, slot.first);
+      });
+  size_t index = pos - leaf->slots;
+  if (index == leaf->count && leaf->next) {
+    return Iterator(leaf->next, 0);
+  }
+  return Iterator(leaf, index);
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+typename BPlusTree<Key, Value, Compare>::Iterator
+BPlusTree<Key, Value, Compare>::find(const K& key) {
+  Iterator it = lower_bound(key);
+  if (it != end() && !comp(key, (*it).first)) {
+    return it;
+  }
+  return end();
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+bool BPlusTree<Key, Value, Compare>::contains(const K& key) {
+  return find(key) != end();
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename ForwardIt, typename Emit>
+void BPlusTree<Key, Value, Compare>::find_many(ForwardIt first,
+                                               ForwardIt last, Emit emit) {
+  if (!root) {
+    for (; first != last; ++first) emit(end());
+    return;
+  }
+  ForwardIt keys[kBatch];
+  NodeBase* current[kBatch];
+  while (first != last) {
+    size_t n = 0;
+    for (; n < kBatch && first != last; ++n, ++first) {
+      keys[n] = first;
+      current[n] = root;
+    }
+    while (!current[0]->leaf) {
+      for (size_t i = 0; i < n; ++i) {
+        Inner* inner = static_cast<Inner*>(current[i]);
+        Key* end = inner->keys + inner->count;
+        Key* pos = std::lower_bound(inner->keys, end, *keys[i], comp);
+        NodeBase* child = inner->children[pos - inner->keys];
+        const char* bytes = reinterpret_cast<const char*>(child);
+        for (size_t line = 0; line < kNodeBytes; line += kCacheLine) {
+          __builtin_prefetch(bytes + line);
+        }
+        current[i] = child;
+      }
+    }
+    for (size_t i = 0; i < n; ++i) {
+      Iterator it = leaf_lower_bound(static_cast<Leaf*>(current[i]), *keys[i]);
+      if (it != end() && !comp(*keys[i], (*it).first)) {
+        emit(it);
+      } else {
+        emit(end());
+      }
+    }
+  }
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_CONTAINERS_S21_BTREE_TPP_
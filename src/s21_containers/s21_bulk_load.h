@@ -0,0 +1,108 @@
+#ifndef SRC_S21_CONTAINERS_S21_BULK_LOAD_H_
+#define SRC_S21_CONTAINERS_S21_BULK_LOAD_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+namespace bulk {
+
+// parallel_sort gives no thread a slice smaller than this
+inline constexpr std::size_t kMinSlice = std::size_t(1) << 14;
+
+// Which of several elements with equivalent keys a load keeps, by their
+// position in the input.
+enum class Keep { kFirst, kLast };
+
+// The trees are bulk loaded from keys when they back a set (Value is
+// std::nullptr_t) and from key/value pairs otherwise.
+template <typename Key, typename Value>
+struct input_traits {
+  static constexpr bool kSet = std::is_same_v<Value, std::nullptr_t>;
+  using item_type =
+      std::conditional_t<kSet, Key, std::pair<Key, Value>>;
+
+  template <typename T>
+  static const auto& key_of(const T& item);
+  template <typename T>
+  static std::pair<Key, Value> to_data(T&& item);
+};
+
+// Sorts [first, last) by detecting the runs already present in the input:
+// strictly descending runs are reversed in place and neighbouring runs are
+// merged pairwise. Already sorted input costs a single pass. The sort is
+// stable, so the first of several equivalent elements stays in front.
+template <typename RandomIt, typename Less>
+void sort_runs(RandomIt first, RandomIt last, Less less);
+
+// Removes every element whose key is equivalent to the one before it and
+// returns the new end of the range. The range must be sorted.
+template <typename ForwardIt, typename Less>
+ForwardIt unique_sorted(ForwardIt first, ForwardIt last, Less less);
+
+// Same as unique_sorted, but keeps the last element of every key instead.
+template <typename ForwardIt, typename Less>
+ForwardIt unique_sorted_last(ForwardIt first, ForwardIt last, Less less);
+
+// Runs task(0) ... task(tasks - 1), each on its own thread except task(0),
+// which runs on the calling one, and returns once all have finished. If
+// some of them throw, the first of their exceptions is rethrown.
+template <typename Task>
+void run_parallel(std::size_t tasks, Task task);
+
+// sort_runs on up to threads threads: every thread sorts its own slice of
+// [first, last), then neighbouring slices are merged pairwise, with the
+// merges of a round running side by side. Stable, as sort_runs is.
+template <typename RandomIt, typename Less>
+void parallel_sort(RandomIt first, RandomIt last, Less less,
+                   unsigned threads);
+
+// Counts the elements of a sorted range that a tree would keep (every one
+// when multi is set, the first of each key otherwise). Returns false as soon
+// as the range turns out not to be sorted.
+template <typename ForwardIt, typename Less>
+bool count_sorted(ForwardIt first, ForwardIt last, bool multi, Less less,
+                  std::size_t* count);
+
+// Loads a tree from [first, last). build(n, next) must replace the contents
+// of the tree with the n elements returned by successive next() calls, which
+// come in ascending key order.
+template <typename Key, typename Value, typename InputIt, typename Less,
+          typename Build>
+void assign(InputIt first, InputIt last, bool multi, Less less, Build build);
+
+// Same as assign, but expects sorted input and links it without copying it
+// into a buffer first. Unsorted input is still accepted and sorted.
+template <typename Key, typename Value, typename ForwardIt, typename Less,
+          typename Build>
+void assign_sorted(ForwardIt first, ForwardIt last, bool multi, Less less,
+                   Build build);
+
+// Copies [first, last) into a buffer, sorts it with sort_runs and drops
+// duplicate keys unless multi is set, then hands the buffer to build.
+template <typename Key, typename Value, typename InputIt, typename Less,
+          typename Build>
+void assign_unsorted(InputIt first, InputIt last, bool multi, Less less,
+                     Build build);
+
+// assign_unsorted with the sort spread over threads threads, or one per
+// hardware thread when threads is 0; small inputs use fewer. Unless multi
+// is set, keep picks which element of a key survives.
+template <typename Key, typename Value, typename InputIt, typename Less,
+          typename Build>
+void assign_parallel(InputIt first, InputIt last, bool multi, Keep keep,
+                     unsigned threads, Less less, Build build);
+
+}  // namespace bulk
+}  // namespace s21
+
+#include "s21_bulk_load.tpp"
+
+#endif  // SRC_S21_CONTAINERS_S21_BULK_LOAD_H_
@@ -0,0 +1,246 @@
+#ifndef SRC_S21_CONTAINERS_S21_BULK_LOAD_TPP_
+#define SRC_S21_CONTAINERS_S21_BULK_LOAD_TPP_
+
+#include "s21_bulk_load.h"
+
+namespace s21 {
+namespace bulk {
+
+template <typename Key, typename Value>
+template <typename T>
+const auto& input_traits<Key, Value>::key_of(const T& item) {
+  if constexpr (kSet) {
+    return item;
+  } else {
+    return item.first;
+  }
+}
+
+template <typename Key, typename Value>
+template <typename T>
+std::pair<Key, Value> input_traits<Key, Value>::to_data(T&& item) {
+  if constexpr (kSet) {
+    return std::pair<Key, Value>(std::forward<T>(item), nullptr);
+  } else {
+    return std::pair<Key, Value>(std::forward<T>(item).first,
+                                 std::forward<T>(item).second);
+  }
+}
+
+template <typename RandomIt, typename Less>
+void sort_runs(RandomIt first, RandomIt last, Less less) {
+  std::size_t n = last - first;
+  if (n < 2) {
+    return;
+  }
+  // run i occupies [bounds[i], bounds[i + 1])
+  vector<std::size_t> bounds;
+  bounds.push_back(0);
+  for (std::size_t i = 0; i < n;) {
+    std::size_t j = i + 1;
+    if (j < n && less(first[j], first[j - 1])) {
+      while (j < n && less(first[j], first[j - 1])) ++j;
+      std::reverse(first + i, first + j);
+    } else {
+      while (j < n && !less(first[j], first[j - 1])) ++j;
+    }
+    bounds.push_back(j);
+    i = j;
+  }
+  while (bounds.size() > 2) {
+    vector<std::size_t> merged;
+    merged.push_back(0);
+    std::size_t* b = bounds.data();
+    for (std::size_t k = 2; k < bounds.size(); k += 2) {
+      std::inplace_merge(first + b[k - 2], first + b[k - 1], first + b[k],
+                         less);
+      merged.push_back(b[k]);
+    }
+    if (bounds.size() % 2 == 0) {
+      merged.push_back(bounds.back());
+    }
+    bounds.swap(merged);
+  }
+}
+
+template <typename ForwardIt, typename Less>
+ForwardIt unique_sorted(ForwardIt first, ForwardIt last, Less less) {
+  return std::unique(first, last, [&less](const auto& a, const auto& b) {
+    return !less(a, b);
+  });
+}
+
+template <typename ForwardIt, typename Less>
+ForwardIt unique_sorted_last(ForwardIt first, ForwardIt last, Less less) {
+  if (first == last) {
+    return last;
+  }
+  ForwardIt out = first;
+  for (ForwardIt it = std::next(first); it != last; ++it) {
+    if (less(*out, *it)) ++out;
+    if (out != it) *out = std::move(*it);
+  }
+  return ++out;
+}
+
+// An exception cannot leave a thread, so each task parks its own in a slot
+// that is checked once every thread has been joined.
+template <typename Task>
+void run_parallel(std::size_t tasks, Task task) {
+  vector<std::exception_ptr> errors(tasks);
+  std::exception_ptr* error = errors.data();
+  auto guarded = [&task, error](std::size_t i) {
+    try {
+      task(i);
+    } catch (...) {
+      error[i] = std::current_exception();
+    }
+  };
+  vector<std::thread> workers(tasks ? tasks - 1 : 0);
+  std::size_t started = 0;
+  try {
+    for (; started < workers.size(); ++started) {
+      workers.data()[started] = std::thread(guarded, started + 1);
+    }
+  } catch (...) {
+    error[0] = std::current_exception();
+  }
+  if (!error[0]) guarded(0);
+  for (std::size_t i = 0; i < started; ++i) {
+    workers.data()[i].join();
+  }
+  for (std::size_t i = 0; i < tasks; ++i) {
+    if (error[i]) std::rethrow_exception(error[i]);
+  }
+}
+
+template <typename RandomIt, typename Less>
+void parallel_sort(RandomIt first, RandomIt last, Less less,
+                   unsigned threads) {
+  std::size_t n = last - first;
+  std::size_t parts = threads ? threads : std::thread::hardware_concurrency();
+  parts = std::min(parts, n / kMinSlice);
+  if (parts < 2) {
+    sort_runs(first, last, less);
+    return;
+  }
+  // slice i occupies [bounds[i], bounds[i + 1])
+  vector<std::size_t> bounds(parts + 1);
+  std::size_t* b = bounds.data();
+  for (std::size_t i = 0; i <= parts; ++i) b[i] = n * i / parts;
+  run_parallel(parts, [first, b, &less](std::size_t i) {
+    sort_runs(first + b[i], first + b[i + 1], less);
+  });
+  for (std::size_t width = 1; width < parts; width *= 2) {
+    std::size_t merges = (parts - width + 2 * width - 1) / (2 * width);
+    run_parallel(merges, [first, b, parts, width, &less](std::size_t m) {
+      std::size_t i = m * 2 * width;
+      std::size_t end = std::min(i + 2 * width, parts);
+      std::inplace_merge(first + b[i], first + b[i + width], first + b[end],
+                         less);
+    });
+  }
+}
+
+template <typename ForwardIt, typename Less>
+bool count_sorted(ForwardIt first, ForwardIt last, bool multi, Less less,
+                  std::size_t* count) {
+  *count = 0;
+  if (first == last) {
+    return true;
+  }
+  *count = 1;
+  for (ForwardIt prev = first, it = std::next(first); it != last;
+       prev = it, ++it) {
+    if (less(*it, *prev)) {
+      return false;
+    }
+    if (multi || less(*prev, *it)) ++*count;
+  }
+  return true;
+}
+
+template <typename Key, typename Value, typename InputIt, typename Less,
+          typename Build>
+void assign(InputIt first, InputIt last, bool multi, Less less, Build build) {
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+    assign_sorted<Key, Value>(first, last, multi, less, build);
+  } else {
+    assign_unsorted<Key, Value>(first, last, multi, less, build);
+  }
+}
+
+template <typename Key, typename Value, typename ForwardIt, typename Less,
+          typename Build>
+void assign_sorted(ForwardIt first, ForwardIt last, bool multi, Less less,
+                   Build build) {
+  std::size_t count = 0;
+  if (!count_sorted(first, last, multi, less, &count)) {
+    assign_unsorted<Key, Value>(first, last, multi, less, build);
+    return;
+  }
+  auto next = [&first, last, multi, &less]() {
+    ForwardIt prev = first;
+    ++first;
+    if (!multi) {
+      while (first != last && !less(*prev, *first)) ++first;
+    }
+    return input_traits<Key, Value>::to_data(*prev);
+  };
+  build(count, next);
+}
+
+template <typename Key, typename Value, typename InputIt, typename Less,
+          typename Build>
+void assign_unsorted(InputIt first, InputIt last, bool multi, Less less,
+                     Build build) {
+  using item_type = typename input_traits<Key, Value>::item_type;
+  vector<item_type> items;
+  for (; first != last; ++first) {
+    items.push_back(*first);
+  }
+  item_type* begin = items.data();
+  item_type* end = begin + items.size();
+  sort_runs(begin, end, less);
+  if (!multi) {
+    end = unique_sorted(begin, end, less);
+  }
+  item_type* it = begin;
+  auto next = [&it]() {
+    return input_traits<Key, Value>::to_data(std::move(*it++));
+  };
+  build(end - begin, next);
+}
+
+template <typename Key, typename Value, typename InputIt, typename Less,
+          typename Build>
+void assign_parallel(InputIt first, InputIt last, bool multi, Keep keep,
+                     unsigned threads, Less less, Build build) {
+  using item_type = typename input_traits<Key, Value>::item_type;
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  vector<item_type> items;
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+    items.reserve(std::distance(first, last));
+  }
+  for (; first != last; ++first) {
+    items.push_back(*first);
+  }
+  item_type* begin = items.data();
+  item_type* end = begin + items.size();
+  parallel_sort(begin, end, less, threads);
+  if (!multi) {
+    end = keep == Keep::kFirst ? unique_sorted(begin, end, less)
+                               : unique_sorted_last(begin, end, less);
+  }
+  item_type* it = begin;
+  auto next = [&it]() {
+    return input_traits<Key, Value>::to_data(std::move(*it++));
+  };
+  build(end - begin, next);
+}
+
+}  // namespace bulk
+}  // namespace s21
+
+#endif  // SRC_S21_CONTAINERS_S21_BULK_LOAD_TPP_
@@ -0,0 +1,93 @@
+#ifndef SRC_S21_CONTAINERS_S21_CIRCULAR_BUFFER_H_
+#define SRC_S21_CONTAINERS_S21_CIRCULAR_BUFFER_H_
+
+#include <cstddef>
+#include <initializer_list>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_instrument.h"
+#include "s21_memory_stats.h"
+
+namespace s21 {
+
+// Growable ring buffer: the elements sit in one block whose capacity is a
+// power of two, starting at head_ and wrapping around its end, so both
+// ends are reached by masking an index. push_back, pop_front and pop_back
+// are O(1) and never move another element; only growing moves them, into
+// a block twice as big where they start again at slot 0. Slots outside the
+// live range hold no object.
+template <typename T>
+class circular_buffer {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+  // constructors
+  circular_buffer() = default;
+  circular_buffer(std::initializer_list<value_type> const &items);
+  circular_buffer(const circular_buffer &other);
+  circular_buffer(circular_buffer &&other);
+
+  // destructor
+  ~circular_buffer();
+
+  // assignment
+  circular_buffer &operator=(circular_buffer &&other);
+
+  // element access, pos counted from the front
+  reference at(size_type pos);
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+
+  // capacity
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type capacity() const { return capacity_; }
+  // makes room for at least n elements, rounded up to a power of two
+  void reserve(size_type n);
+  MemoryStats memory_stats() const;
+  size_type memory_usage() const { return memory_stats().total(); }
+
+  // modifiers
+  // destroys the elements but keeps the block
+  void clear();
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+  void pop_front();
+  void pop_back();
+  void swap(circular_buffer &other);
+
+  // part 3
+  template <typename... Args>
+  void insert_many_back(Args &&...args);
+
+ private:
+  using hooks = instrument::Hooks<instrument::family::circular_buffer>;
+  static constexpr size_type kMinCapacity = 8;
+
+  T *slots_ = nullptr;
+  size_type head_ = 0;
+  size_type size_ = 0;
+  size_type capacity_ = 0;
+
+  T *slot(size_type pos) const {
+    return slots_ + ((head_ + pos) & (capacity_ - 1));
+  }
+  void relocate(size_type new_capacity);
+};
+
+}  // namespace s21
+
+#include "s21_circular_buffer.tpp"
+
+#endif  // SRC_S21_CONTAINERS_S21_CIRCULAR_BUFFER_H_
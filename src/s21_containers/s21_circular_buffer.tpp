@@ -0,0 +1,215 @@
+#ifndef SRC_S21_CONTAINERS_S21_CIRCULAR_BUFFER_TPP_
+#define SRC_S21_CONTAINERS_S21_CIRCULAR_BUFFER_TPP_
+
+#include "s21_circular_buffer.h"
+
+namespace s21 {
+
+// Moves the elements, front first, to the start of a block of new_capacity
+// slots.
+template <typename T>
+void circular_buffer<T>::relocate(size_type new_capacity) {
+  T *fresh = static_cast<T *>(::operator new(sizeof(T) * new_capacity));
+  hooks::allocated();
+  if (slots_) {
+    hooks::reallocated();
+    hooks::deallocated();
+  }
+  hooks::moved(size_);
+  for (size_type i = 0; i < size_; ++i) {
+    T *old = slot(i);
+    new (fresh + i) T(std::move(*old));
+    old->~T();
+  }
+  ::operator delete(slots_);
+  slots_ = fresh;
+  head_ = 0;
+  capacity_ = new_capacity;
+}
+
+// constructors
+// Both delegate to the default constructor, so the destructor cleans up if
+// copying an element throws.
+template <typename T>
+circular_buffer<T>::circular_buffer(
+    std::initializer_list<value_type> const &items)
+    : circular_buffer() {
+  reserve(items.size());
+  for (const_reference item : items) push_back(item);
+}
+
+template <typename T>
+circular_buffer<T>::circular_buffer(const circular_buffer &other)
+    : circular_buffer() {
+  reserve(other.size_);
+  for (size_type i = 0; i < other.size_; ++i) push_back(*other.slot(i));
+}
+
+template <typename T>
+circular_buffer<T>::circular_buffer(circular_buffer &&other) {
+  swap(other);
+}
+
+// destructor
+template <typename T>
+circular_buffer<T>::~circular_buffer() {
+  clear();
+  if (slots_) hooks::deallocated();
+  ::operator delete(slots_);
+}
+
+// assignment
+template <typename T>
+circular_buffer<T> &circular_buffer<T>::operator=(circular_buffer &&other) {
+  if (this != &other) {
+    circular_buffer gone(std::move(*this));
+    swap(other);
+  }
+  return *this;
+}
+
+// element access
+template <typename T>
+typename circular_buffer<T>::reference circular_buffer<T>::at(size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("Index out of range");
+  }
+  return *slot(pos);
+}
+
+template <typename T>
+typename circular_buffer<T>::reference circular_buffer<T>::operator[](
+    size_type pos) {
+  return at(pos);
+}
+
+template <typename T>
+typename circular_buffer<T>::const_reference circular_buffer<T>::operator[](
+    size_type pos) const {
+  if (pos >= size_) {
+    throw std::out_of_range("Index out of range");
+  }
+  return *slot(pos);
+}
+
+template <typename T>
+typename circular_buffer<T>::reference circular_buffer<T>::front() {
+  if (empty()) {
+    throw std::out_of_range("Out of range");
+  }
+  return *slot(0);
+}
+
+template <typename T>
+typename circular_buffer<T>::const_reference circular_buffer<T>::front()
+    const {
+  if (empty()) {
+    throw std::out_of_range("Out of range");
+  }
+  return *slot(0);
+}
+
+template <typename T>
+typename circular_buffer<T>::reference circular_buffer<T>::back() {
+  if (empty()) {
+    throw std::out_of_range("Out of range");
+  }
+  return *slot(size_ - 1);
+}
+
+template <typename T>
+typename circular_buffer<T>::const_reference circular_buffer<T>::back() const {
+  if (empty()) {
+    throw std::out_of_range("Out of range");
+  }
+  return *slot(size_ - 1);
+}
+
+// capacity
+template <typename T>
+void circular_buffer<T>::reserve(size_type n) {
+  if (n <= capacity_) return;
+  size_type grown = capacity_ ? capacity_ : kMinCapacity;
+  while (grown < n) grown *= 2;
+  relocate(grown);
+}
+
+template <typename T>
+MemoryStats circular_buffer<T>::memory_stats() const {
+  return memory::split(sizeof(*this) + capacity_ * sizeof(T), size_,
+                       sizeof(T), slots_ ? 1 : 0);
+}
+
+// modifiers
+template <typename T>
+void circular_buffer<T>::clear() {
+  while (size_ > 0) pop_back();
+  head_ = 0;
+}
+
+template <typename T>
+void circular_buffer<T>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T>
+void circular_buffer<T>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T>
+template <typename... Args>
+typename circular_buffer<T>::reference circular_buffer<T>::emplace_back(
+    Args &&...args) {
+  if (size_ == capacity_) {
+    // args may refer into the block that is about to move
+    value_type value(std::forward<Args>(args)...);
+    reserve(size_ + 1);
+    new (slot(size_)) T(std::move(value));
+  } else {
+    new (slot(size_)) T(std::forward<Args>(args)...);
+  }
+  return *slot(size_++);
+}
+
+template <typename T>
+void circular_buffer<T>::pop_front() {
+  if (size_ > 0) {
+    slot(0)->~T();
+    head_ = (head_ + 1) & (capacity_ - 1);
+    --size_;
+  }
+}
+
+template <typename T>
+void circular_buffer<T>::pop_back() {
+  if (size_ > 0) {
+    slot(size_ - 1)->~T();
+    --size_;
+  }
+}
+
+template <typename T>
+void circular_buffer<T>::swap(circular_buffer &other) {
+  std::swap(slots_, other.slots_);
+  std::swap(head_, other.head_);
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+}
+
+// part 3
+template <typename T>
+template <typename... Args>
+void circular_buffer<T>::insert_many_back(Args &&...args) {
+  if constexpr (sizeof...(Args) > 0) {
+    // args may refer into the block, so every value is built before the
+    // block can move
+    value_type values[] = {value_type(std::forward<Args>(args))...};
+    reserve(size_ + sizeof...(Args));
+    for (value_type &value : values) emplace_back(std::move(value));
+  }
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_CONTAINERS_S21_CIRCULAR_BUFFER_TPP_
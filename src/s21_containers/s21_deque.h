@@ -0,0 +1,234 @@
+#ifndef SRC_S21_CONTAINERS_S21_DEQUE_H_
+#define SRC_S21_CONTAINERS_S21_DEQUE_H_
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_instrument.h"
+#include "s21_memory_stats.h"
+
+namespace s21 {
+
+// Double-ended queue in fixed-size blocks. A map of block pointers, with
+// free slots at both ends, says where each block sits; element i lives at
+// offset (start_ + i) % kBlockSize of block (start_ + i) / kBlockSize, and
+// the block size is a power of two so both are a shift and a mask. Growing
+// at either end takes a new block and at most moves the block pointers to
+// recenter or double the map; elements never move, so references to them
+// stay valid across push and pop at the ends (iterators do not). One
+// emptied block is kept as a spare, so a deque used as a queue does not
+// allocate once it has warmed up.
+template <typename T>
+class deque {
+ private:
+  template <typename Value>
+  class Iter;
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = Iter<T>;
+  using const_iterator = Iter<const T>;
+  using size_type = std::size_t;
+
+  // constructors
+  deque() = default;
+  explicit deque(size_type n);
+  deque(std::initializer_list<value_type> const &items);
+  deque(const deque &other);
+  deque(deque &&other);
+
+  // destructor
+  ~deque();
+
+  // assignment
+  deque &operator=(deque &&other);
+
+  // element access
+  reference at(size_type pos);
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+
+  // iterators
+  iterator begin() { return iterator(this, 0); }
+  iterator end() { return iterator(this, size_); }
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, size_); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  // capacity
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type max_size() const;
+  // frees the spare block
+  void shrink_to_fit();
+  MemoryStats memory_stats() const;
+  size_type memory_usage() const { return memory_stats().total(); }
+
+  // modifiers
+  void clear();
+  // insert and erase shift the elements on the shorter side of pos
+  iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, value_type &&value);
+  iterator erase(iterator pos);
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+  void push_front(const_reference value);
+  void push_front(value_type &&value);
+  template <typename... Args>
+  reference emplace_front(Args &&...args);
+  void pop_back();
+  void pop_front();
+  void swap(deque &other);
+
+  // part 3
+  template <typename... Args>
+  void insert_many_back(Args &&...args);
+  template <typename... Args>
+  void insert_many_front(Args &&...args);
+
+ private:
+  using hooks = instrument::Hooks<instrument::family::deque>;
+
+  // elements per block: as many as fit in 4 KiB, rounded down to a power
+  // of two, but at least 16
+  static constexpr size_type block_shift() {
+    size_type shift = 4;
+    while ((size_type(2) << shift) * sizeof(T) <= 4096) ++shift;
+    return shift;
+  }
+  static constexpr size_type kShift = block_shift();
+  static constexpr size_type kBlockSize = size_type(1) << kShift;
+  static constexpr size_type kMask = kBlockSize - 1;
+  static constexpr size_type kMinMap = 8;
+
+  T **map_ = nullptr;
+  size_type map_size_ = 0;
+  size_type start_ = 0;   // position of the first element in map_
+  size_type size_ = 0;
+  size_type blocks_ = 0;  // blocks allocated, the spare included
+  T *spare_ = nullptr;
+
+  T *slot(size_type pos) const {
+    size_type at = start_ + pos;
+    return map_[at >> kShift] + (at & kMask);
+  }
+  T *take_block();
+  void release(size_type block);
+  void make_room();
+  template <typename... Args>
+  void build(size_type at, Args &&...args);
+  void rotate_in(size_type index, bool from_front);
+  template <typename Value>
+  iterator insert_at(iterator pos, Value &&value);
+};
+
+// Random-access iterator: the deque and an index, so it survives the map
+// being recentered but, as with std::deque, not a push at the front.
+template <typename T>
+template <typename Value>
+class deque<T>::Iter {
+  using owner_type =
+      std::conditional_t<std::is_const_v<Value>, const deque, deque>;
+
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using value_type = std::remove_const_t<Value>;
+  using pointer = Value *;
+  using reference = Value &;
+
+  Iter() = default;
+  Iter(owner_type *owner, size_type index) : owner(owner), index(index) {}
+  // iterator converts to const_iterator
+  template <typename Other,
+            typename = std::enable_if_t<std::is_const_v<Value> &&
+                                        !std::is_const_v<Other>>>
+  Iter(const Iter<Other> &other) : owner(other.owner), index(other.index) {}
+
+  reference operator*() const { return *owner->slot(index); }
+  pointer operator->() const { return owner->slot(index); }
+  reference operator[](difference_type n) const {
+    return *owner->slot(index + n);
+  }
+
+  Iter &operator++() {
+    ++index;
+    return *this;
+  }
+  Iter operator++(int) {
+    Iter old = *this;
+    ++index;
+    return old;
+  }
+  Iter &operator--() {
+    --index;
+    return *this;
+  }
+  Iter operator--(int) {
+    Iter old = *this;
+    --index;
+    return old;
+  }
+  Iter &operator+=(difference_type n) {
+    index += n;
+    return *this;
+  }
+  Iter &operator-=(difference_type n) {
+    index -= n;
+    return *this;
+  }
+  friend Iter operator+(Iter it, difference_type n) { return it += n; }
+  friend Iter operator+(difference_type n, Iter it) { return it += n; }
+  friend Iter operator-(Iter it, difference_type n) { return it -= n; }
+  friend difference_type operator-(const Iter &a, const Iter &b) {
+    return difference_type(a.index) - difference_type(b.index);
+  }
+
+  friend bool operator==(const Iter &a, const Iter &b) {
+    return a.index == b.index;
+  }
+  friend bool operator!=(const Iter &a, const Iter &b) {
+    return a.index != b.index;
+  }
+  friend bool operator<(const Iter &a, const Iter &b) {
+    return a.index < b.index;
+  }
+  friend bool operator>(const Iter &a, const Iter &b) {
+    return a.index > b.index;
+  }
+  friend bool operator<=(const Iter &a, const Iter &b) {
+    return a.index <= b.index;
+  }
+  friend bool operator>=(const Iter &a, const Iter &b) {
+    return a.index >= b.index;
+  }
+
+ private:
+  template <typename>
+  friend class Iter;
+  friend class deque;
+
+  owner_type *owner = nullptr;
+  size_type index = 0;
+};
+
+}  // namespace s21
+
+#include "s21_deque.tpp"
+
+#endif  // SRC_S21_CONTAINERS_S21_DEQUE_H_
@@ -0,0 +1,364 @@
+#ifndef SRC_S21_CONTAINERS_S21_DEQUE_TPP_
+#define SRC_S21_CONTAINERS_S21_DEQUE_TPP_
+
+#include <algorithm>
+
+#include "s21_deque.h"
+
+namespace s21 {
+
+// helper methods
+template <typename T>
+T *deque<T>::take_block() {
+  if (spare_) {
+    T *block = spare_;
+    spare_ = nullptr;
+    return block;
+  }
+  T *block = static_cast<T *>(::operator new(sizeof(T) * kBlockSize));
+  hooks::allocated();
+  ++blocks_;
+  return block;
+}
+
+// Takes an emptied block out of the map, keeping it as the spare unless
+// there is one already.
+template <typename T>
+void deque<T>::release(size_type block) {
+  T *emptied = map_[block];
+  map_[block] = nullptr;
+  if (!spare_) {
+    spare_ = emptied;
+  } else {
+    ::operator delete(emptied);
+    hooks::deallocated();
+    --blocks_;
+  }
+}
+
+// Leaves at least one free map slot on each side of the blocks in use.
+// The block pointers are moved to the middle of the map, which is doubled
+// first unless it is at least twice what they need.
+template <typename T>
+void deque<T>::make_room() {
+  size_type first = start_ >> kShift;
+  size_type used = size_ ? ((start_ + size_ - 1) >> kShift) - first + 1 : 0;
+  size_type new_size = map_size_;
+  T **fresh = map_;
+  if (!map_ || 2 * (used + 1) > map_size_) {
+    new_size = map_size_ ? map_size_ * 2 : kMinMap;
+    while (2 * (used + 1) > new_size) new_size *= 2;
+    fresh = new T *[new_size]();
+    hooks::allocated();
+  }
+  size_type new_first = (new_size - used) / 2;
+  if (fresh != map_) {
+    std::copy(map_ + first, map_ + first + used, fresh + new_first);
+    if (map_) {
+      hooks::reallocated();
+      hooks::deallocated();
+    }
+    delete[] map_;
+    map_ = fresh;
+    map_size_ = new_size;
+  } else if (new_first < first) {
+    std::copy(map_ + first, map_ + first + used, map_ + new_first);
+    std::fill(map_ + std::max(first, new_first + used), map_ + first + used,
+              nullptr);
+  } else if (new_first > first) {
+    std::copy_backward(map_ + first, map_ + first + used,
+                       map_ + new_first + used);
+    std::fill(map_ + first, map_ + std::min(new_first, first + used),
+              nullptr);
+  }
+  start_ = (new_first << kShift) + (start_ & kMask);
+}
+
+// Builds an element at position at of the map, taking a block if that
+// slot has none.
+template <typename T>
+template <typename... Args>
+void deque<T>::build(size_type at, Args &&...args) {
+  T *&block = map_[at >> kShift];
+  bool fresh = block == nullptr;
+  if (fresh) block = take_block();
+  try {
+    new (block + (at & kMask)) T(std::forward<Args>(args)...);
+  } catch (...) {
+    if (fresh) release(at >> kShift);
+    throw;
+  }
+}
+
+// Moves the element just pushed at the front (or back) to index.
+template <typename T>
+void deque<T>::rotate_in(size_type index, bool from_front) {
+  if (from_front) {
+    std::rotate(begin(), begin() + 1, begin() + index + 1);
+    hooks::moved(index);
+  } else {
+    std::rotate(begin() + index, end() - 1, end());
+    hooks::moved(size_ - 1 - index);
+  }
+}
+
+template <typename T>
+template <typename Value>
+typename deque<T>::iterator deque<T>::insert_at(iterator pos, Value &&value) {
+  size_type index = pos.index;
+  if (index > size_) {
+    throw std::out_of_range("Invalid insertion position");
+  }
+  bool from_front = index < size_ - index;
+  if (from_front) {
+    emplace_front(std::forward<Value>(value));
+  } else {
+    emplace_back(std::forward<Value>(value));
+  }
+  rotate_in(index, from_front);
+  return begin() + index;
+}
+
+// constructors
+// They delegate to the default constructor, so the destructor cleans up
+// if building an element throws.
+template <typename T>
+deque<T>::deque(size_type n) : deque() {
+  for (size_type i = 0; i < n; ++i) emplace_back();
+}
+
+template <typename T>
+deque<T>::deque(std::initializer_list<value_type> const &items) : deque() {
+  for (const_reference item : items) push_back(item);
+}
+
+template <typename T>
+deque<T>::deque(const deque &other) : deque() {
+  for (const_reference item : other) push_back(item);
+}
+
+template <typename T>
+deque<T>::deque(deque &&other) : deque() {
+  swap(other);
+}
+
+// destructor
+template <typename T>
+deque<T>::~deque() {
+  clear();
+  shrink_to_fit();
+  if (map_) hooks::deallocated();
+  delete[] map_;
+}
+
+// assignment
+template <typename T>
+deque<T> &deque<T>::operator=(deque &&other) {
+  if (this != &other) {
+    deque gone(std::move(*this));
+    swap(other);
+  }
+  return *this;
+}
+
+// element access
+template <typename T>
+typename deque<T>::reference deque<T>::at(size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("Index out of range");
+  }
+  return *slot(pos);
+}
+
+template <typename T>
+typename deque<T>::reference deque<T>::operator[](size_type pos) {
+  return at(pos);
+}
+
+template <typename T>
+typename deque<T>::const_reference deque<T>::operator[](size_type pos) const {
+  if (pos >= size_) {
+    throw std::out_of_range("Index out of range");
+  }
+  return *slot(pos);
+}
+
+template <typename T>
+typename deque<T>::reference deque<T>::front() {
+  if (empty()) {
+    throw std::out_of_range("Out of range");
+  }
+  return *slot(0);
+}
+
+template <typename T>
+typename deque<T>::const_reference deque<T>::front() const {
+  if (empty()) {
+    throw std::out_of_range("Out of range");
+  }
+  return *slot(0);
+}
+
+template <typename T>
+typename deque<T>::reference deque<T>::back() {
+  if (empty()) {
+    throw std::out_of_range("Out of range");
+  }
+  return *slot(size_ - 1);
+}
+
+template <typename T>
+typename deque<T>::const_reference deque<T>::back() const {
+  if (empty()) {
+    throw std::out_of_range("Out of range");
+  }
+  return *slot(size_ - 1);
+}
+
+// capacity
+template <typename T>
+typename deque<T>::size_type deque<T>::max_size() const {
+  return std::numeric_limits<size_type>::max() / 2 / sizeof(value_type);
+}
+
+template <typename T>
+void deque<T>::shrink_to_fit() {
+  if (spare_) {
+    ::operator delete(spare_);
+    hooks::deallocated();
+    --blocks_;
+    spare_ = nullptr;
+  }
+}
+
+template <typename T>
+MemoryStats deque<T>::memory_stats() const {
+  return memory::split(sizeof(*this) + map_size_ * sizeof(T *) +
+                           blocks_ * kBlockSize * sizeof(T),
+                       size_, sizeof(T), (map_ ? 1 : 0) + blocks_);
+}
+
+// modifiers
+template <typename T>
+void deque<T>::clear() {
+  while (size_ > 0) pop_back();
+}
+
+template <typename T>
+typename deque<T>::iterator deque<T>::insert(iterator pos,
+                                             const_reference value) {
+  return insert_at(pos, value);
+}
+
+template <typename T>
+typename deque<T>::iterator deque<T>::insert(iterator pos,
+                                             value_type &&value) {
+  return insert_at(pos, std::move(value));
+}
+
+template <typename T>
+typename deque<T>::iterator deque<T>::erase(iterator pos) {
+  size_type index = pos.index;
+  if (index >= size_) {
+    throw std::out_of_range("Invalid erase position");
+  }
+  if (index < size_ - 1 - index) {
+    std::move_backward(begin(), begin() + index, begin() + index + 1);
+    hooks::moved(index);
+    pop_front();
+  } else {
+    std::move(begin() + index + 1, end(), begin() + index);
+    hooks::moved(size_ - 1 - index);
+    pop_back();
+  }
+  return begin() + index;
+}
+
+template <typename T>
+void deque<T>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T>
+void deque<T>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T>
+template <typename... Args>
+typename deque<T>::reference deque<T>::emplace_back(Args &&...args) {
+  if (((start_ + size_) >> kShift) >= map_size_) make_room();
+  build(start_ + size_, std::forward<Args>(args)...);
+  ++size_;
+  return *slot(size_ - 1);
+}
+
+template <typename T>
+void deque<T>::push_front(const_reference value) {
+  emplace_front(value);
+}
+
+template <typename T>
+void deque<T>::push_front(value_type &&value) {
+  emplace_front(std::move(value));
+}
+
+template <typename T>
+template <typename... Args>
+typename deque<T>::reference deque<T>::emplace_front(Args &&...args) {
+  if (start_ == 0) make_room();
+  build(start_ - 1, std::forward<Args>(args)...);
+  --start_;
+  ++size_;
+  return *slot(0);
+}
+
+template <typename T>
+void deque<T>::pop_back() {
+  if (size_ > 0) {
+    size_type at = start_ + size_ - 1;
+    slot(size_ - 1)->~T();
+    --size_;
+    if (size_ == 0 || (at & kMask) == 0) release(at >> kShift);
+  }
+}
+
+template <typename T>
+void deque<T>::pop_front() {
+  if (size_ > 0) {
+    size_type block = start_ >> kShift;
+    slot(0)->~T();
+    ++start_;
+    --size_;
+    if (size_ == 0 || (start_ & kMask) == 0) release(block);
+  }
+}
+
+template <typename T>
+void deque<T>::swap(deque &other) {
+  std::swap(map_, other.map_);
+  std::swap(map_size_, other.map_size_);
+  std::swap(start_, other.start_);
+  std::swap(size_, other.size_);
+  std::swap(blocks_, other.blocks_);
+  std::swap(spare_, other.spare_);
+}
+
+// part 3
+template <typename T>
+template <typename... Args>
+void deque<T>::insert_many_back(Args &&...args) {
+  (emplace_back(std::forward<Args>(args)), ...);
+}
+
+// inserts the arguments, in order, before the first element
+template <typename T>
+template <typename... Args>
+void deque<T>::insert_many_front(Args &&...args) {
+  size_type index = 0;
+  ((insert(begin() + index, std::forward<Args>(args)), ++index), ...);
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_CONTAINERS_S21_DEQUE_TPP_
@@ -0,0 +1,187 @@
+#ifndef SRC_S21_CONTAINERS_S21_EYTZINGER_H_
+#define SRC_S21_CONTAINERS_S21_EYTZINGER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_bulk_load.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Immutable sorted keys in Eytzinger order: the array is a complete binary
+// search tree laid out level by level, with the root at index 1 and the
+// children of k at 2k and 2k + 1 (index 0 is unused and stands for end()).
+// A search is a loop of k = 2k + (key[k] < x) with no branch on the result,
+// and the first levels of the tree stay in cache for every lookup. The
+// 2^kAhead descendants kAhead levels down sit next to each other, so each
+// step prefetches them and the loads of later steps are already underway.
+// Iteration follows the sorted order by index arithmetic. Values, if any,
+// live in a second array in the same order, so a search touches only keys.
+// Keys and values must be default constructible.
+template <typename Key, typename Value, typename Compare = std::less<Key>>
+class EytzingerArray {
+ private:
+  static constexpr bool kSet = std::is_same_v<Value, std::nullptr_t>;
+  static constexpr size_t kCacheLine = 64;
+  // levels whose descendants together still fit in one cache line
+  static constexpr unsigned kAhead = sizeof(Key) >= kCacheLine / 2   ? 1
+                                     : sizeof(Key) >= kCacheLine / 4 ? 2
+                                     : sizeof(Key) >= kCacheLine / 8 ? 3
+                                                                     : 4;
+  static constexpr size_t kBatch = 16;
+
+  vector<Key> keys;
+  vector<Value> values;
+  size_t count;
+  Compare comp;
+  static inline std::nullptr_t no_value = nullptr;
+
+  // helper methods
+  Value& value_at(size_t k);
+  void prefetch(size_t k) const;
+  size_t first_index() const;
+  size_t last_index() const;
+  size_t next_index(size_t k) const;
+  size_t prev_index(size_t k) const;
+  template <typename K>
+  size_t lower_index(const K& key) const;
+  template <typename K>
+  size_t upper_index(const K& key) const;
+
+  // bulk construction
+  using traits = bulk::input_traits<Key, Value>;
+  template <typename T, typename U>
+  bool key_less(const T& a, const U& b) const;
+  template <typename Next>
+  void rebuild(size_t n, Next& next);
+
+ public:
+  class Iterator;
+  class ConstIterator;
+  using key_type = Key;
+  using value_type = Value;
+  using size_type = size_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+
+  class Iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::pair<Key, Value>;
+    using pointer = void;
+    using reference = std::pair<const Key&, Value&>;
+    Iterator() : array(nullptr), index(0) {}
+    Iterator(EytzingerArray* owner, size_type k) : array(owner), index(k) {}
+    Iterator& operator++() {
+      index = array->next_index(index);
+      return *this;
+    }
+    Iterator operator++(int) {
+      Iterator old = *this;
+      ++*this;
+      return old;
+    }
+    Iterator& operator--() {
+      index = array->prev_index(index);
+      return *this;
+    }
+    Iterator operator--(int) {
+      Iterator old = *this;
+      --*this;
+      return old;
+    }
+    bool operator!=(const Iterator& other) const { return !(*this == other); }
+    bool operator==(const Iterator& other) const {
+      return array == other.array && index == other.index;
+    }
+    reference operator*() const;
+
+   protected:
+    EytzingerArray* array;
+    size_type index;
+    friend class EytzingerArray;
+  };
+
+  class ConstIterator : public Iterator {
+   public:
+    using reference = std::pair<const Key&, const Value&>;
+    using Iterator::Iterator;
+    ConstIterator() : Iterator() {}
+    ConstIterator(const Iterator& it) : Iterator(it) {}
+    reference operator*() const { return Iterator::operator*(); }
+  };
+
+  // constructors
+  EytzingerArray() : EytzingerArray(Compare()) {}
+  explicit EytzingerArray(const Compare& compare) : count(0), comp(compare) {}
+  EytzingerArray(const EytzingerArray& other)
+      : keys(other.keys),
+        values(other.values),
+        count(other.count),
+        comp(other.comp) {}
+  EytzingerArray(EytzingerArray&& other) noexcept;
+
+  // destructor
+  ~EytzingerArray() = default;
+
+  // assignment
+  EytzingerArray& operator=(const EytzingerArray& other);
+  EytzingerArray& operator=(EytzingerArray&& other) noexcept;
+
+  // Iterators
+  Iterator begin() { return Iterator(this, first_index()); }
+  Iterator end() { return Iterator(this, 0); }
+  ConstIterator cbegin() const;
+  ConstIterator cend() const;
+
+  // capacity
+  bool empty() const { return count == 0; }
+  size_type size() const { return count; }
+  size_type max_size() const { return keys.max_size() - 1; }
+  MemoryStats memory_stats() const;
+  size_type memory_usage() const { return memory_stats().total(); }
+
+  // modifiers: the contents can only be replaced as a whole, from elements
+  // in any order (sorted input is detected and costs a single pass);
+  // duplicate keys keep their first element
+  template <typename InputIt>
+  void assign(InputIt first, InputIt last);
+  void swap(EytzingerArray& other);
+
+  // lookup: K is key_type or, with a transparent Compare, anything that
+  // compares against it
+  template <typename K>
+  Iterator lower_bound(const K& key) {
+    return Iterator(this, lower_index(key));
+  }
+  template <typename K>
+  Iterator upper_bound(const K& key) {
+    return Iterator(this, upper_index(key));
+  }
+  template <typename K>
+  Iterator find(const K& key);
+  template <typename K>
+  bool contains(const K& key) const;
+  // find for every key of [first, last), handed to emit(Iterator) in order;
+  // kBatch searches descend in lockstep so their cache misses overlap
+  template <typename ForwardIt, typename Emit>
+  void find_many(ForwardIt first, ForwardIt last, Emit emit);
+
+  // observers
+  Compare key_comp() const { return comp; }
+};
+
+}  // namespace s21
+
+#include "s21_eytzinger.tpp"
+
+#endif  // SRC_S21_CONTAINERS_S21_EYTZINGER_H_
@@ -0,0 +1,264 @@
+#ifndef SRC_S21_CONTAINERS_S21_EYTZINGER_TPP_
+#define SRC_S21_CONTAINERS_S21_EYTZINGER_TPP_
+
+#include "s21_eytzinger.h"
+
+namespace s21 {
+
+template <typename Key, typename Value, typename Compare>
+Value& EytzingerArray<Key, Value, Compare>::value_at(size_t k) {
+  if constexpr (kSet) {
+    (void)k;
+    return no_value;
+  } else {
+    return values.data()[k];
+  }
+}
+
+// The descendants of k kAhead levels down start at k << kAhead. Past the
+// bottom of the tree the address lies outside the array, which a prefetch
+// tolerates, so it is formed as an integer rather than a pointer.
+template <typename Key, typename Value, typename Compare>
+void EytzingerArray<Key, Value, Compare>::prefetch(size_t k) const {
+  uintptr_t base = reinterpret_cast<uintptr_t>(keys.cbegin());
+  __builtin_prefetch(
+      reinterpret_cast<const void*>(base + (k << kAhead) * sizeof(Key)));
+}
+
+// The smallest key is the leftmost node of the bottom full level, the
+// largest the rightmost node of the last level that is full.
+template <typename Key, typename Value, typename Compare>
+size_t EytzingerArray<Key, Value, Compare>::first_index() const {
+  if (!count) return 0;
+  return size_t(1) << (63 - __builtin_clzll(count));
+}
+
+template <typename Key, typename Value, typename Compare>
+size_t EytzingerArray<Key, Value, Compare>::last_index() const {
+  return (size_t(1) << (63 - __builtin_clzll(count + 1))) - 1;
+}
+
+// In order, the next node is the leftmost one of the right subtree, or
+// else the first ancestor reached from a left child: dropping the trailing
+// ones of k and one bit more climbs to it, and to 0 (end()) from the last.
+template <typename Key, typename Value, typename Compare>
+size_t EytzingerArray<Key, Value, Compare>::next_index(size_t k) const {
+  if (2 * k + 1 <= count) {
+    k = 2 * k + 1;
+    while (2 * k <= count) k *= 2;
+    return k;
+  }
+  return k >> __builtin_ffsll(~static_cast<long long>(k));
+}
+
+// the mirror image of next_index; end() steps back to the last node
+template <typename Key, typename Value, typename Compare>
+size_t EytzingerArray<Key, Value, Compare>::prev_index(size_t k) const {
+  if (!k) return last_index();
+  if (2 * k <= count) {
+    k = 2 * k;
+    while (2 * k + 1 <= count) k = 2 * k + 1;
+    return k;
+  }
+  return k >> __builtin_ffsll(static_cast<long long>(k));
+}
+
+// The loop walks down to a leaf, going right past every key that is still
+// less than key; the answer is the last node where it went left, which the
+// trailing ones of k (the right turns after it) and one more bit uncover.
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+size_t EytzingerArray<Key, Value, Compare>::lower_index(const K& key) const {
+  const Key* data = keys.cbegin();
+  size_t k = 1;
+  while (k <= count) {
+    prefetch(k);
+    k = 2 * k + comp(data[k], key);
+  }
+  return k >> __builtin_ffsll(~static_cast<long long>(k));
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+size_t EytzingerArray<Key, Value, Compare>::upper_index(const K& key) const {
+  const Key* data = keys.cbegin();
+  size_t k = 1;
+  while (k <= count) {
+    prefetch(k);
+    k = 2 * k + !comp(key, data[k]);
+  }
+  return k >> __builtin_ffsll(~static_cast<long long>(k));
+}
+
+// bulk construction
+template <typename Key, typename Value, typename Compare>
+template <typename T, typename U>
+bool EytzingerArray<Key, Value, Compare>::key_less(const T& a,
+                                                   const U& b) const {
+  return comp(traits::key_of(a), traits::key_of(b));
+}
+
+// The elements come in ascending order, so they are dealt out to the
+// nodes in the order of an in-order walk.
+template <typename Key, typename Value, typename Compare>
+template <typename Next>
+void EytzingerArray<Key, Value, Compare>::rebuild(size_t n, Next& next) {
+  EytzingerArray built(comp);
+  if (n) {
+    built.keys = vector<Key>(n + 1);
+    if constexpr (!kSet) built.values = vector<Value>(n + 1);
+    built.count = n;
+  }
+  Key* data = built.keys.data();
+  for (size_t k = built.first_index(); k; k = built.next_index(k)) {
+    std::pair<Key, Value> item = next();
+    data[k] = std::move(item.first);
+    built.value_at(k) = std::move(item.second);
+  }
+  swap(built);
+}
+
+// Iterator
+template <typename Key, typename Value, typename Compare>
+typename EytzingerArray<Key, Value, Compare>::Iterator::reference
+EytzingerArray<Key, Value, Compare>::Iterator::operator*() const {
+  if (!array || !index) {
+    throw std::out_of_range("Dereferencing end() iterator");
+  }
+  return reference(array->keys.data()[index], array->value_at(index));
+}
+
+// constructors
+template <typename Key, typename Value, typename Compare>
+EytzingerArray<Key, Value, Compare>::EytzingerArray(
+    EytzingerArray&& other) noexcept
+    : keys(std::move(other.keys)),
+      values(std::move(other.values)),
+      count(other.count),
+      comp(other.comp) {
+  other.count = 0;
+}
+
+// assignment
+template <typename Key, typename Value, typename Compare>
+EytzingerArray<Key, Value, Compare>&
+EytzingerArray<Key, Value, Compare>::operator=(const EytzingerArray& other) {
+  if (this != &other) {
+    EytzingerArray copy(other);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <typename Key, typename Value, typename Compare>
+EytzingerArray<Key, Value, Compare>&
+EytzingerArray<Key, Value, Compare>::operator=(
+    EytzingerArray&& other) noexcept {
+  if (this != &other) {
+    EytzingerArray taken(std::move(other));
+    swap(taken);
+  }
+  return *this;
+}
+
+// Iterators
+template <typename Key, typename Value, typename Compare>
+typename EytzingerArray<Key, Value, Compare>::ConstIterator
+EytzingerArray<Key, Value, Compare>::cbegin() const {
+  return ConstIterator(const_cast<EytzingerArray*>(this), first_index());
+}
+
+template <typename Key, typename Value, typename Compare>
+typename EytzingerArray<Key, Value, Compare>::ConstIterator
+EytzingerArray<Key, Value, Compare>::cend() const {
+  return ConstIterator(const_cast<EytzingerArray*>(this), 0);
+}
+
+// slot 0 of each array is unused and counts as overhead
+template <typename Key, typename Value, typename Compare>
+MemoryStats EytzingerArray<Key, Value, Compare>::memory_stats() const {
+  MemoryStats held = memory::held_by(keys);
+  held += memory::held_by(values);
+  return memory::split(sizeof(*this) + held.total(), count,
+                       memory::element_bytes<Key, Value>(), held.allocations);
+}
+
+// modifiers
+template <typename Key, typename Value, typename Compare>
+template <typename InputIt>
+void EytzingerArray<Key, Value, Compare>::assign(InputIt first,
+                                                 InputIt last) {
+  bulk::assign<Key, Value>(
+      first, last, false,
+      [this](const auto& a, const auto& b) { return key_less(a, b); },
+      [this](size_t n, auto& next) { rebuild(n, next); });
+}
+
+template <typename Key, typename Value, typename Compare>
+void EytzingerArray<Key, Value, Compare>::swap(EytzingerArray& other) {
+  keys.swap(other.keys);
+  values.swap(other.values);
+  std::swap(count, other.count);
+  std::swap(comp, other.comp);
+}
+
+// lookup
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+typename EytzingerArray<Key, Value, Compare>::Iterator
+EytzingerArray<Key, Value, Compare>::find(const K& key) {
+  size_t k = lower_index(key);
+  if (k && !comp(key, keys.cbegin()[k])) {
+    return Iterator(this, k);
+  }
+  return end();
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+bool EytzingerArray<Key, Value, Compare>::contains(const K& key) const {
+  size_t k = lower_index(key);
+  return k && !comp(key, keys.cbegin()[k]);
+}
+
+// The leaves of a complete tree are at most one level apart, so a lane
+// that reaches the bottom early just waits for the others.
+template <typename Key, typename Value, typename Compare>
+template <typename ForwardIt, typename Emit>
+void EytzingerArray<Key, Value, Compare>::find_many(ForwardIt first,
+                                                    ForwardIt last,
+                                                    Emit emit) {
+  const Key* data = keys.cbegin();
+  ForwardIt lanes[kBatch];
+  size_t current[kBatch];
+  while (first != last) {
+    size_t n = 0;
+    for (; n < kBatch && first != last; ++n, ++first) {
+      lanes[n] = first;
+      current[n] = 1;
+    }
+    for (bool active = count > 0; active;) {
+      active = false;
+      for (size_t i = 0; i < n; ++i) {
+        size_t k = current[i];
+        if (k > count) continue;
+        prefetch(k);
+        current[i] = 2 * k + comp(data[k], *lanes[i]);
+        active = true;
+      }
+    }
+    for (size_t i = 0; i < n; ++i) {
+      size_t k = current[i] >> __builtin_ffsll(~static_cast<long long>(
+                                   current[i]));
+      if (k && !comp(*lanes[i], data[k])) {
+        emit(Iterator(this, k));
+      } else {
+        emit(end());
+      }
+    }
+  }
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_CONTAINERS_S21_EYTZINGER_TPP_
@@ -0,0 +1,241 @@
+#ifndef SRC_S21_CONTAINERS_S21_FLAT_TREE_H_
+#define SRC_S21_CONTAINERS_S21_FLAT_TREE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "s21_bulk_load.h"
+#include "s21_node_handle.h"
+#include "s21_vector.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace s21 {
+
+// Sorted-array backend with the same interface as AVLTree, for sets and maps
+// that are built once and then mostly read. Keys and values live in two
+// separate s21::vectors, so a lookup only touches the keys: a branchless
+// binary search narrows the range down to a few cache lines, which are then
+// counted without early exit, 16 bytes per SSE2 compare where available for
+// integers of up to 4 bytes, floats and doubles under std::less or
+// std::greater. Inserting or erasing is O(n) and invalidates every iterator.
+// Dereferencing yields a pair of references into the two arrays rather than
+// a reference to a stored pair. A set (Value is std::nullptr_t) keeps no
+// value array at all. Keys and values must be default constructible, as
+// every s21::vector element is.
+template <typename Key, typename Value, typename Compare = std::less<Key>>
+class FlatTree {
+ private:
+  static constexpr bool kSet = std::is_same_v<Value, std::nullptr_t>;
+  static constexpr size_t kScanBytes = 256;
+  static constexpr size_t kScan =
+      std::max<size_t>(8, kScanBytes / sizeof(Key));
+  // the scan compares packed keys when Compare is the built-in order or its
+  // reverse; SSE2 has no 64-bit integer compare
+  static constexpr bool kAscending = std::is_same_v<Compare, std::less<Key>> ||
+                                     std::is_same_v<Compare, std::less<>>;
+  static constexpr bool kDescending =
+      std::is_same_v<Compare, std::greater<Key>> ||
+      std::is_same_v<Compare, std::greater<>>;
+  static constexpr bool kPackedScan =
+      (kAscending || kDescending) &&
+      (std::is_same_v<Key, float> || std::is_same_v<Key, double> ||
+       (std::is_integral_v<Key> && !std::is_same_v<Key, bool> &&
+        sizeof(Key) <= 4));
+
+  vector<Key> keys;
+  vector<Value> values;
+  Compare comp;
+  static inline std::nullptr_t no_value = nullptr;
+
+  // helper methods
+  Value& value_at(size_t i);
+  template <bool kUpper, typename K>
+  bool before(const Key& k, const K& key) const {
+    return kUpper ? !comp(key, k) : comp(k, key);
+  }
+  template <bool kUpper, typename K>
+  size_t partition_point(const K& key) const;
+  template <bool kUpper, typename K>
+  size_t count_before(const Key* base, size_t n, const K& key) const;
+#ifdef __SSE2__
+  template <bool kBelow>
+  static unsigned packed_mask(const Key* p, Key key);
+  template <bool kBelow>
+  static size_t count_packed(const Key* base, size_t n, Key key);
+#endif
+  template <typename K>
+  size_t lower_index(const K& key) const;
+  template <typename K>
+  size_t upper_index(const K& key) const;
+  size_t find_slot(const Key& key, bool multi, bool* found) const;
+  void reserve_one();
+  template <typename K, typename V>
+  void insert_at(size_t pos, K&& key, V&& value);
+  void erase_range(size_t first, size_t last);
+
+  // bulk construction
+  using traits = bulk::input_traits<Key, Value>;
+  template <typename T, typename U>
+  bool key_less(const T& a, const U& b) const;
+  template <typename Next>
+  void rebuild(size_t n, Next& next, bool multi);
+
+ public:
+  class Iterator;
+  class ConstIterator;
+  using key_type = Key;
+  using value_type = Value;
+  using size_type = size_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+  using node_type = ValueHandle<Key, Value>;
+
+ public:
+  class Iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::pair<Key, Value>;
+    using pointer = void;
+    using reference = std::pair<const Key&, Value&>;
+    Iterator() : tree(nullptr), index(0) {}
+    Iterator(FlatTree* owner, size_type i) : tree(owner), index(i) {}
+    Iterator& operator++() {
+      ++index;
+      return *this;
+    }
+    Iterator operator++(int) { return Iterator(tree, index++); }
+    Iterator& operator--() {
+      --index;
+      return *this;
+    }
+    Iterator operator--(int) { return Iterator(tree, index--); }
+    bool operator!=(const Iterator& other) const { return !(*this == other); }
+    bool operator==(const Iterator& other) const {
+      return tree == other.tree && index == other.index;
+    }
+    reference operator*() const;
+
+   protected:
+    FlatTree* tree;
+    size_type index;
+    friend class FlatTree;
+  };
+
+  class ConstIterator : public Iterator {
+   public:
+    using reference = std::pair<const Key&, const Value&>;
+    using Iterator::Iterator;
+    ConstIterator() : Iterator() {}
+    ConstIterator(const Iterator& it) : Iterator(it) {}
+    reference operator*() const { return Iterator::operator*(); }
+  };
+
+ public:
+  // constructors
+  FlatTree() : FlatTree(Compare()) {}
+  explicit FlatTree(const Compare& compare) : comp(compare) {}
+  FlatTree(const FlatTree& tree)
+      : keys(tree.keys), values(tree.values), comp(tree.comp) {}
+  FlatTree(FlatTree&& tree) noexcept
+      : keys(std::move(tree.keys)),
+        values(std::move(tree.values)),
+        comp(tree.comp) {}
+
+  // destructor
+  ~FlatTree() = default;
+
+  // assignment
+  FlatTree& operator=(const FlatTree& tree);
+  FlatTree& operator=(FlatTree&& tree) noexcept;
+
+  // Iterators
+  Iterator begin() { return Iterator(this, 0); }
+  Iterator end() { return Iterator(this, keys.size()); }
+  ConstIterator cbegin() const;
+  ConstIterator cend() const;
+
+  // capacity
+  bool empty() const { return keys.empty(); }
+  size_type size() const { return keys.size(); }
+  size_type max_size() const { return keys.max_size(); }
+  size_type capacity() const { return keys.capacity(); }
+  void reserve(size_type n);
+  MemoryStats memory_stats() const;
+  size_type memory_usage() const { return memory_stats().total(); }
+
+  // modifiers
+  void clear();
+  std::pair<Iterator, bool> insert(const std::pair<Key, Value>& data,
+                                   bool multi);
+  std::pair<Iterator, bool> insert(std::pair<Key, Value>&& data, bool multi);
+  std::pair<Iterator, bool> insert(Iterator hint,
+                                   const std::pair<Key, Value>& data,
+                                   bool multi);
+  std::pair<Iterator, bool> insert(Iterator hint, std::pair<Key, Value>&& data,
+                                   bool multi);
+  template <typename... Args>
+  std::pair<Iterator, bool> emplace(bool multi, Args&&... args);
+  template <typename K, typename... Args>
+  std::pair<Iterator, bool> try_emplace(K&& key, Args&&... args);
+  void erase(Iterator pos);
+  Iterator erase(Iterator first, Iterator last);
+  node_type extract(Iterator pos);
+  std::pair<Iterator, bool> insert(node_type& node, bool multi);
+  void swap(FlatTree& other);
+  void merge(FlatTree& other, bool multi);
+  // as in AVLTree; split moves the tail, join appends or prepends other
+  FlatTree split(Iterator pos);
+  bool join(FlatTree& other, bool multi);
+  template <typename InputIt>
+  void assign(InputIt first, InputIt last, bool multi);
+  template <typename ForwardIt>
+  void assign_sorted(ForwardIt first, ForwardIt last, bool multi);
+  template <typename InputIt>
+  void assign_parallel(InputIt first, InputIt last, bool multi,
+                       bulk::Keep keep, unsigned threads);
+
+  // lookup: K is key_type or, with a transparent Compare, anything that
+  // compares against it
+  template <typename K>
+  Iterator lower_bound(const K& key);
+  template <typename K>
+  Iterator upper_bound(const K& key);
+  template <typename K>
+  Iterator find(const K& key);
+  template <typename K>
+  bool contains(const K& key);
+  // as in AVLTree; every search takes the same number of halving steps, so
+  // kBatch of them advance together, prefetching their next midpoints
+  template <typename ForwardIt, typename Emit>
+  void find_many(ForwardIt first, ForwardIt last, Emit emit);
+
+  // observers
+  Compare key_comp() const { return comp; }
+
+ private:
+  static constexpr size_t kBatch = 16;
+  template <typename D>
+  std::pair<Iterator, bool> insert_data(D&& data, bool multi);
+  template <typename D>
+  std::pair<Iterator, bool> insert_hint_data(Iterator hint, D&& data,
+                                             bool multi);
+};
+
+}  // namespace s21
+
+#include "s21_flat_tree.tpp"
+
+#endif  // SRC_S21_CONTAINERS_S21_FLAT_TREE_H_
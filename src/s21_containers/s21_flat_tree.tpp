@@ -0,0 +1,600 @@
+#ifndef SRC_S21_CONTAINERS_S21_FLAT_TREE_TPP_
+#define SRC_S21_CONTAINERS_S21_FLAT_TREE_TPP_
+
+#include "s21_flat_tree.h"
+
+namespace s21 {
+
+template <typename Key, typename Value, typename Compare>
+Value& FlatTree<Key, Value, Compare>::value_at(size_t i) {
+  if constexpr (kSet) {
+    (void)i;
+    return no_value;
+  } else {
+    return values.data()[i];
+  }
+}
+
+// Returns the first index whose key is not before key: not less than key
+// for the lower bound, greater than key for the upper one. Each halving
+// step picks the upper or lower half with a conditional move instead of a
+// branch, so a mispredicted comparison costs nothing. The last kScan keys,
+// a few cache lines, are counted rather than searched.
+template <typename Key, typename Value, typename Compare>
+template <bool kUpper, typename K>
+size_t FlatTree<Key, Value, Compare>::partition_point(const K& key) const {
+  const Key* first = keys.cbegin();
+  const Key* base = first;
+  size_t n = keys.size();
+  while (n > kScan) {
+    size_t half = n / 2;
+    base = before<kUpper>(base[half], key) ? base + half : base;
+    n -= half;
+  }
+  return base - first + count_before<kUpper>(base, n, key);
+}
+
+// With std::less the lower bound counts the keys below key and the upper
+// bound all but those above it; std::greater swaps the two. Either way a
+// NaN lands where the scalar comparisons would put it.
+template <typename Key, typename Value, typename Compare>
+template <bool kUpper, typename K>
+size_t FlatTree<Key, Value, Compare>::count_before(const Key* base, size_t n,
+                                                   const K& key) const {
+#ifdef __SSE2__
+  if constexpr (kPackedScan && std::is_same_v<K, Key>) {
+    size_t counted = count_packed<kUpper == kDescending>(base, n, key);
+    return kUpper ? n - counted : counted;
+  }
+#endif
+  size_t count = 0;
+  for (size_t i = 0; i < n; ++i) {
+    count += before<kUpper>(base[i], key);
+  }
+  return count;
+}
+
+#ifdef __SSE2__
+// One bit per lane of the 16 bytes at p: set where the key is below key,
+// or above it without kBelow. Unsigned keys have their sign bits flipped,
+// which maps their order onto the signed compares SSE2 provides.
+template <typename Key, typename Value, typename Compare>
+template <bool kBelow>
+unsigned FlatTree<Key, Value, Compare>::packed_mask(const Key* p, Key key) {
+  if constexpr (std::is_same_v<Key, float>) {
+    __m128 k = _mm_set1_ps(key);
+    __m128 x = _mm_loadu_ps(p);
+    return _mm_movemask_ps(kBelow ? _mm_cmplt_ps(x, k) : _mm_cmplt_ps(k, x));
+  } else if constexpr (std::is_same_v<Key, double>) {
+    __m128d k = _mm_set1_pd(key);
+    __m128d x = _mm_loadu_pd(p);
+    return _mm_movemask_pd(kBelow ? _mm_cmplt_pd(x, k) : _mm_cmplt_pd(k, x));
+  } else {
+    using Signed = std::make_signed_t<Key>;
+    Signed flip =
+        std::is_signed_v<Key> ? 0 : std::numeric_limits<Signed>::min();
+    __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    __m128i k;
+    __m128i lanes;
+    if constexpr (sizeof(Key) == 1) {
+      x = _mm_xor_si128(x, _mm_set1_epi8(flip));
+      k = _mm_set1_epi8(static_cast<Signed>(key ^ flip));
+      lanes = kBelow ? _mm_cmplt_epi8(x, k) : _mm_cmpgt_epi8(x, k);
+      return _mm_movemask_epi8(lanes);
+    } else if constexpr (sizeof(Key) == 2) {
+      x = _mm_xor_si128(x, _mm_set1_epi16(flip));
+      k = _mm_set1_epi16(static_cast<Signed>(key ^ flip));
+      lanes = kBelow ? _mm_cmplt_epi16(x, k) : _mm_cmpgt_epi16(x, k);
+      return _mm_movemask_epi8(_mm_packs_epi16(lanes, _mm_setzero_si128()));
+    } else {
+      x = _mm_xor_si128(x, _mm_set1_epi32(flip));
+      k = _mm_set1_epi32(static_cast<Signed>(key ^ flip));
+      lanes = kBelow ? _mm_cmplt_epi32(x, k) : _mm_cmpgt_epi32(x, k);
+      return _mm_movemask_ps(_mm_castsi128_ps(lanes));
+    }
+  }
+}
+
+template <typename Key, typename Value, typename Compare>
+template <bool kBelow>
+size_t FlatTree<Key, Value, Compare>::count_packed(const Key* base, size_t n,
+                                                   Key key) {
+  constexpr size_t kLanes = 16 / sizeof(Key);
+  size_t count = 0;
+  size_t i = 0;
+  for (; i + kLanes <= n; i += kLanes) {
+    count += __builtin_popcount(packed_mask<kBelow>(base + i, key));
+  }
+  for (; i < n; ++i) {
+    count += kBelow ? base[i] < key : key < base[i];
+  }
+  return count;
+}
+#endif
+
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+size_t FlatTree<Key, Value, Compare>::lower_index(const K& key) const {
+  return partition_point<false>(key);
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+size_t FlatTree<Key, Value, Compare>::upper_index(const K& key) const {
+  return partition_point<true>(key);
+}
+
+// Returns where key goes, after any equal keys with multi. Without multi,
+// *found tells whether the returned index already holds the key.
+template <typename Key, typename Value, typename Compare>
+size_t FlatTree<Key, Value, Compare>::find_slot(const Key& key, bool multi,
+                                                bool* found) const {
+  *found = false;
+  if (multi) {
+    return upper_index(key);
+  }
+  size_t pos = lower_index(key);
+  *found = pos < keys.size() && !comp(key, keys.cbegin()[pos]);
+  return pos;
+}
+
+// Grows both arrays together, so that inserting into the second one can
+// no longer fail after the first one took its element.
+template <typename Key, typename Value, typename Compare>
+void FlatTree<Key, Value, Compare>::reserve_one() {
+  if (keys.size() == keys.capacity()) {
+    reserve(keys.capacity() ? keys.capacity() * 2 : 1);
+  }
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename K, typename V>
+void FlatTree<Key, Value, Compare>::insert_at(size_t pos, K&& key,
+                                              V&& value) {
+  reserve_one();
+  keys.insert(keys.begin() + pos, std::forward<K>(key));
+  if constexpr (!kSet) {
+    values.insert(values.begin() + pos, std::forward<V>(value));
+  } else {
+    (void)value;
+  }
+}
+
+// Shifts the tail down over [first, last) and resets the vacated slots, so
+// the erased elements release what they own right away.
+template <typename Key, typename Value, typename Compare>
+void FlatTree<Key, Value, Compare>::erase_range(size_t first, size_t last) {
+  size_t n = keys.size();
+  Key* k = keys.data();
+  std::move(k + last, k + n, k + first);
+  if constexpr (!kSet) {
+    Value* v = values.data();
+    std::move(v + last, v + n, v + first);
+  }
+  for (size_t i = n - (last - first); i < n; ++i) {
+    k[i] = Key();
+    keys.pop_back();
+    if constexpr (!kSet) {
+      values.data()[i] = Value();
+      values.pop_back();
+    }
+  }
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename T, typename U>
+bool FlatTree<Key, Value, Compare>::key_less(const T& a, const U& b) const {
+  return comp(traits::key_of(a), traits::key_of(b));
+}
+
+// bulk::assign has already sorted the elements; duplicates are dropped in
+// the same pass that splits them into the key and the value array.
+template <typename Key, typename Value, typename Compare>
+template <typename Next>
+void FlatTree<Key, Value, Compare>::rebuild(size_t n, Next& next,
+                                            bool multi) {
+  FlatTree built(comp);
+  built.reserve(n);
+  for (size_t i = 0; i < n; ++i) {
+    std::pair<Key, Value> data = next();
+    size_t size = built.keys.size();
+    if (multi || !size || comp(built.keys.cbegin()[size - 1], data.first)) {
+      built.insert_at(size, std::move(data.first), std::move(data.second));
+    }
+  }
+  swap(built);
+}
+
+// Iterator
+template <typename Key, typename Value, typename Compare>
+typename FlatTree<Key, Value, Compare>::Iterator::reference
+FlatTree<Key, Value, Compare>::Iterator::operator*() const {
+  if (!tree || index >= tree->keys.size()) {
+    throw std::out_of_range("Dereferencing end() iterator");
+  }
+  return reference(tree->keys.data()[index], tree->value_at(index));
+}
+
+// assignment
+template <typename Key, typename Value, typename Compare>
+FlatTree<Key, Value, Compare>& FlatTree<Key, Value, Compare>::operator=(
+    const FlatTree& tree) {
+  if (this != &tree) {
+    FlatTree copy(tree);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <typename Key, typename Value, typename Compare>
+FlatTree<Key, Value, Compare>& FlatTree<Key, Value, Compare>::operator=(
+    FlatTree&& tree) noexcept {
+  if (this != &tree) {
+    clear();
+    swap(tree);
+  }
+  return *this;
+}
+
+// Iterators
+template <typename Key, typename Value, typename Compare>
+typename FlatTree<Key, Value, Compare>::ConstIterator
+FlatTree<Key, Value, Compare>::cbegin() const {
+  return ConstIterator(const_cast<FlatTree*>(this), 0);
+}
+
+template <typename Key, typename Value, typename Compare>
+typename FlatTree<Key, Value, Compare>::ConstIterator
+FlatTree<Key, Value, Compare>::cend() const {
+  return ConstIterator(const_cast<FlatTree*>(this), keys.size());
+}
+
+// Capacity
+template <typename Key, typename Value, typename Compare>
+void FlatTree<Key, Value, Compare>::reserve(size_type n) {
+  keys.reserve(n);
+  if constexpr (!kSet) {
+    values.reserve(n);
+  }
+}
+
+template <typename Key, typename Value, typename Compare>
+MemoryStats FlatTree<Key, Value, Compare>::memory_stats() const {
+  MemoryStats held = memory::held_by(keys);
+  held += memory::held_by(values);
+  return memory::split(sizeof(*this) + held.total(), keys.size(),
+                       memory::element_bytes<Key, Value>(), held.allocations);
+}
+
+// Modifiers
+template <typename Key, typename Value, typename Compare>
+void FlatTree<Key, Value, Compare>::clear() {
+  keys.clear();
+  values.clear();
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename D>
+std::pair<typename FlatTree<Key, Value, Compare>::Iterator, bool>
+FlatTree<Key, Value, Compare>::insert_data(D&& data, bool multi) {
+  bool found;
+  size_t pos = find_slot(data.first, multi, &found);
+  if (found) {
+    return std::make_pair(Iterator(this, pos), false);
+  }
+  insert_at(pos, std::forward<D>(data).first, std::forward<D>(data).second);
+  return std::make_pair(Iterator(this, pos), true);
+}
+
+template <typename Key, typename Value, typename Compare>
+std::pair<typename FlatTree<Key, Value, Compare>::Iterator, bool>
+FlatTree<Key, Value, Compare>::insert(const std::pair<Key, Value>& data,
+                                      bool multi) {
+  return insert_data(data, multi);
+}
+
+template <typename Key, typename Value, typename Compare>
+std::pair<typename FlatTree<Key, Value, Compare>::Iterator, bool>
+FlatTree<Key, Value, Compare>::insert(std::pair<Key, Value>&& data,
+                                      bool multi) {
+  return insert_data(std::move(data), multi);
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename... Args>
+std::pair<typename FlatTree<Key, Value, Compare>::Iterator, bool>
+FlatTree<Key, Value, Compare>::emplace(bool multi, Args&&... args) {
+  return insert_data(std::pair<Key, Value>(std::forward<Args>(args)...),
+                     multi);
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename K, typename... Args>
+std::pair<typename FlatTree<Key, Value, Compare>::Iterator, bool>
+FlatTree<Key, Value, Compare>::try_emplace(K&& key, Args&&... args) {
+  bool found;
+  size_t pos = find_slot(key, false, &found);
+  if (found) {
+    return std::make_pair(Iterator(this, pos), false);
+  }
+  insert_at(pos, std::forward<K>(key), Value(std::forward<Args>(args)...));
+  return std::make_pair(Iterator(this, pos), true);
+}
+
+// The hint is taken when the key belongs right before it, which saves the
+// search but not the shift.
+template <typename Key, typename Value, typename Compare>
+template <typename D>
+std::pair<typename FlatTree<Key, Value, Compare>::Iterator, bool>
+FlatTree<Key, Value, Compare>::insert_hint_data(Iterator hint, D&& data,
+                                                bool multi) {
+  size_t pos = hint.index;
+  size_t n = keys.size();
+  if (hint.tree == this && pos <= n) {
+    const Key* k = keys.cbegin();
+    const Key& key = data.first;
+    bool after_prev = pos == 0 || (multi ? !comp(key, k[pos - 1])
+                                         : comp(k[pos - 1], key));
+    bool before_next =
+        pos == n || (multi ? !comp(k[pos], key) : comp(key, k[pos]));
+    if (after_prev && before_next) {
+      insert_at(pos, std::forward<D>(data).first,
+                std::forward<D>(data).second);
+      return std::make_pair(Iterator(this, pos), true);
+    }
+  }
+  return insert_data(std::forward<D>(data), multi);
+}
+
+template <typename Key, typename Value, typename Compare>
+std::pair<typename FlatTree<Key, Value, Compare>::Iterator, bool>
+FlatTree<Key, Value, Compare>::insert(Iterator hint,
+                                      const std::pair<Key, Value>& data,
+                                      bool multi) {
+  return insert_hint_data(hint, data, multi);
+}
+
+template <typename Key, typename Value, typename Compare>
+std::pair<typename FlatTree<Key, Value, Compare>::Iterator, bool>
+FlatTree<Key, Value, Compare>::insert(Iterator hint,
+                                      std::pair<Key, Value>&& data,
+                                      bool multi) {
+  return insert_hint_data(hint, std::move(data), multi);
+}
+
+template <typename Key, typename Value, typename Compare>
+void FlatTree<Key, Value, Compare>::erase(Iterator pos) {
+  if (pos.index < keys.size()) {
+    erase_range(pos.index, pos.index + 1);
+  }
+}
+
+template <typename Key, typename Value, typename Compare>
+typename FlatTree<Key, Value, Compare>::Iterator
+FlatTree<Key, Value, Compare>::erase(Iterator first, Iterator last) {
+  erase_range(first.index, last.index);
+  return Iterator(this, first.index);
+}
+
+template <typename Key, typename Value, typename Compare>
+typename FlatTree<Key, Value, Compare>::node_type
+FlatTree<Key, Value, Compare>::extract(Iterator pos) {
+  if (pos.index >= keys.size()) {
+    return node_type();
+  }
+  node_type node(std::pair<Key, Value>(std::move(keys.data()[pos.index]),
+                                       std::move(value_at(pos.index))));
+  erase(pos);
+  return node;
+}
+
+template <typename Key, typename Value, typename Compare>
+std::pair<typename FlatTree<Key, Value, Compare>::Iterator, bool>
+FlatTree<Key, Value, Compare>::insert(node_type& node, bool multi) {
+  if (node.empty()) {
+    return std::make_pair(end(), false);
+  }
+  std::pair<Iterator, bool> result = insert_data(std::move(*node.data), multi);
+  if (result.second) node.data.reset();
+  return result;
+}
+
+template <typename Key, typename Value, typename Compare>
+void FlatTree<Key, Value, Compare>::swap(FlatTree& other) {
+  keys.swap(other.keys);
+  values.swap(other.values);
+  std::swap(comp, other.comp);
+}
+
+// Merges the two sorted arrays in one linear pass; an equal key from other
+// comes after ours, or stays in other without multi.
+template <typename Key, typename Value, typename Compare>
+void FlatTree<Key, Value, Compare>::merge(FlatTree& other, bool multi) {
+  if (this == &other) {
+    return;
+  }
+  FlatTree merged(comp);
+  FlatTree rest(other.comp);
+  merged.reserve(size() + other.size());
+  auto take = [](FlatTree& to, FlatTree& from, size_t i) {
+    to.insert_at(to.size(), std::move(from.keys.data()[i]),
+                 std::move(from.value_at(i)));
+  };
+  size_t i = 0;
+  size_t j = 0;
+  const Key* ours = keys.cbegin();
+  const Key* theirs = other.keys.cbegin();
+  while (i < size() && j < other.size()) {
+    if (comp(theirs[j], ours[i])) {
+      take(merged, other, j++);
+    } else if (multi || comp(ours[i], theirs[j])) {
+      take(merged, *this, i++);
+    } else {
+      take(merged, *this, i++);
+      take(rest, other, j++);
+    }
+  }
+  for (; i < size(); ++i) take(merged, *this, i);
+  for (; j < other.size(); ++j) take(merged, other, j);
+  swap(merged);
+  other.swap(rest);
+}
+
+template <typename Key, typename Value, typename Compare>
+FlatTree<Key, Value, Compare> FlatTree<Key, Value, Compare>::split(
+    Iterator pos) {
+  FlatTree tail(comp);
+  size_t n = keys.size();
+  if (pos.index >= n) {
+    return tail;
+  }
+  tail.reserve(n - pos.index);
+  for (size_t i = pos.index; i < n; ++i) {
+    tail.insert_at(tail.size(), std::move(keys.data()[i]),
+                   std::move(value_at(i)));
+  }
+  erase_range(pos.index, n);
+  return tail;
+}
+
+// Prepending moves our elements behind those of other, so it costs the
+// size of both arrays; appending only the size of other.
+template <typename Key, typename Value, typename Compare>
+bool FlatTree<Key, Value, Compare>::join(FlatTree& other, bool multi) {
+  if (this == &other) {
+    return false;
+  }
+  if (other.empty()) {
+    return true;
+  }
+  if (empty()) {
+    swap(other);
+    return true;
+  }
+  auto before = [this, multi](const Key& a, const Key& b) {
+    return multi ? !comp(b, a) : comp(a, b);
+  };
+  const Key* ours = keys.cbegin();
+  const Key* theirs = other.keys.cbegin();
+  FlatTree* from = &other;
+  FlatTree* to = this;
+  if (before(theirs[other.size() - 1], ours[0])) {
+    std::swap(from, to);
+  } else if (!before(ours[size() - 1], theirs[0])) {
+    return false;
+  }
+  to->reserve(size() + other.size());
+  for (size_t i = 0; i < from->size(); ++i) {
+    to->insert_at(to->size(), std::move(from->keys.data()[i]),
+                  std::move(from->value_at(i)));
+  }
+  if (to != this) {
+    swap(other);
+  }
+  other.clear();
+  return true;
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename InputIt>
+void FlatTree<Key, Value, Compare>::assign(InputIt first, InputIt last,
+                                           bool multi) {
+  bulk::assign<Key, Value>(
+      first, last, true,
+      [this](const auto& a, const auto& b) { return key_less(a, b); },
+      [this, multi](size_t n, auto& next) { rebuild(n, next, multi); });
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename ForwardIt>
+void FlatTree<Key, Value, Compare>::assign_sorted(ForwardIt first,
+                                                  ForwardIt last, bool multi) {
+  bulk::assign_sorted<Key, Value>(
+      first, last, true,
+      [this](const auto& a, const auto& b) { return key_less(a, b); },
+      [this, multi](size_t n, auto& next) { rebuild(n, next, multi); });
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename InputIt>
+void FlatTree<Key, Value, Compare>::assign_parallel(InputIt first, InputIt last,
+                                                    bool multi, bulk::Keep keep,
+                                                    unsigned threads) {
+  bulk::assign_parallel<Key, Value>(
+      first, last, multi, keep, threads,
+      [this](const auto& a, const auto& b) { return key_less(a, b); },
+      [this, multi](size_t n, auto& next) { rebuild(n, next, multi); });
+}
+
+// Lookup
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+typename FlatTree<Key, Value, Compare>::Iterator
+FlatTree<Key, Value, Compare>::lower_bound(const K& key) {
+  return Iterator(this, lower_index(key));
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+typename FlatTree<Key, Value, Compare>::Iterator
+FlatTree<Key, Value, Compare>::upper_bound(const K& key) {
+  return Iterator(this, upper_index(key));
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+typename FlatTree<Key, Value, Compare>::Iterator
+FlatTree<Key, Value, Compare>::find(const K& key) {
+  size_t pos = lower_index(key);
+  if (pos < keys.size() && !comp(key, keys.cbegin()[pos])) {
+    return Iterator(this, pos);
+  }
+  return end();
+}
+
+template <typename Key, typename Value, typename Compare>
+template <typename K>
+bool FlatTree<Key, Value, Compare>::contains(const K& key) {
+  return find(key) != end();
+}
+
+// partition_point for kBatch keys at once; the final scans run one key
+// after another, over lines the last prefetches already brought in.
+template <typename Key, typename Value, typename Compare>
+template <typename ForwardIt, typename Emit>
+void FlatTree<Key, Value, Compare>::find_many(ForwardIt first,
+                                              ForwardIt last, Emit emit) {
+  const Key* data = keys.cbegin();
+  size_t size = keys.size();
+  ForwardIt lanes[kBatch];
+  const Key* base[kBatch];
+  while (first != last) {
+    size_t n = 0;
+    for (; n < kBatch && first != last; ++n, ++first) {
+      lanes[n] = first;
+      base[n] = data;
+    }
+    size_t len = size;
+    while (len > kScan) {
+      size_t half = len / 2;
+      for (size_t i = 0; i < n; ++i) {
+        base[i] = comp(base[i][half], *lanes[i]) ? base[i] + half : base[i];
+        __builtin_prefetch(base[i] + (len - half) / 2);
+      }
+      len -= half;
+    }
+    for (size_t i = 0; i < n; ++i) {
+      size_t pos =
+          base[i] - data + count_before<false>(base[i], len, *lanes[i]);
+      if (pos < size && !comp(*lanes[i], data[pos])) {
+        emit(Iterator(this, pos));
+      } else {
+        emit(end());
+      }
+    }
+  }
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_CONTAINERS_S21_FLAT_TREE_TPP_
@@ -0,0 +1,184 @@
+#ifndef SRC_S21_CONTAINERS_S21_HASH_TABLE_H_
+#define SRC_S21_CONTAINERS_S21_HASH_TABLE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "s21_vector.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace s21 {
+
+// Open-addressing table behind unordered_map and unordered_set. Slots live
+// in one flat s21::vector and every slot has a control byte in a parallel
+// array: kEmpty, or the low 7 bits of the key's hash. A lookup starts at
+// the key's home group of kGroup slots, matches all of its control bytes
+// against those 7 bits at once (one SSE2 compare where available) and
+// compares keys only for the hits. Groups are probed linearly and a probe
+// stops at the first group with an empty slot.
+//
+// There are no tombstones: erase moves a later element back into the hole
+// when that element's probe passed through it, so lookups never slow down
+// after many deletions. Because of that, erase may move other elements, and
+// any insert that grows the table moves all of them; both invalidate
+// iterators. Keys and values must be default constructible, as every
+// s21::vector element is.
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class HashTable {
+ private:
+  using ctrl_t = signed char;
+  static constexpr size_t kGroup = 16;
+  static constexpr ctrl_t kEmpty = -128;
+  static constexpr float kDefaultMaxLoad = 0.875f;
+
+  vector<ctrl_t> ctrl;
+  vector<std::pair<Key, Value>> slots;
+  size_t count;
+  size_t growth_limit;
+  float max_load;
+  Hash hash;
+  KeyEqual equal;
+
+  // helper methods
+  static unsigned match(const ctrl_t* group, ctrl_t h2);
+  static unsigned match_empty(const ctrl_t* group);
+  static size_t lowest_bit(unsigned mask);
+  size_t mixed_hash(const Key& key) const;
+  size_t home_group(size_t h) const;
+  const ctrl_t* group_at(size_t g) const {
+    return ctrl.cbegin() + g * kGroup;
+  }
+  size_t limit_for(size_t cap) const;
+  size_t capacity_for(size_t n) const;
+  size_t find_index(const Key& key) const;
+  size_t empty_slot(size_t h) const;
+  size_t prepare_slot(const Key& key);
+  void rehash_to(size_t cap);
+  void erase_index(size_t index);
+
+ public:
+  class Iterator;
+  class ConstIterator;
+  using key_type = Key;
+  using value_type = Value;
+  using size_type = size_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+
+ public:
+  class Iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::pair<Key, Value>;
+    using pointer = value_type*;
+    using reference = value_type&;
+    Iterator() : table(nullptr), index(0) {}
+    Iterator(HashTable* owner, size_type i) : table(owner), index(i) {}
+    Iterator& operator++();
+    Iterator operator++(int);
+    bool operator!=(const Iterator& other) const { return !(*this == other); }
+    bool operator==(const Iterator& other) const {
+      return table == other.table && index == other.index;
+    }
+    reference operator*() const;
+
+   protected:
+    HashTable* table;
+    size_type index;
+    friend class HashTable;
+  };
+
+  class ConstIterator : public Iterator {
+   public:
+    using Iterator::Iterator;
+    ConstIterator() : Iterator() {}
+    ConstIterator(const Iterator& it) : Iterator(it) {}
+    const typename Iterator::value_type& operator*() const {
+      return Iterator::operator*();
+    }
+  };
+
+ public:
+  // constructors
+  HashTable() : HashTable(Hash(), KeyEqual()) {}
+  HashTable(const Hash& hasher, const KeyEqual& key_equal)
+      : count(0),
+        growth_limit(0),
+        max_load(kDefaultMaxLoad),
+        hash(hasher),
+        equal(key_equal) {}
+  HashTable(const HashTable& table);
+  HashTable(HashTable&& table) noexcept;
+
+  // destructor
+  ~HashTable() = default;
+
+  // assignment
+  HashTable& operator=(const HashTable& table);
+  HashTable& operator=(HashTable&& table) noexcept;
+
+  // Iterators
+  Iterator begin();
+  Iterator end() { return Iterator(this, slots.size()); }
+  ConstIterator cbegin() const;
+  ConstIterator cend() const;
+
+  // capacity
+  bool empty() const { return count == 0; }
+  size_type size() const { return count; }
+  size_type max_size() const { return slots.max_size(); }
+  size_type capacity() const { return slots.size(); }
+  MemoryStats memory_stats() const;
+  size_type memory_usage() const { return memory_stats().total(); }
+  // makes room for n elements, so that inserting them does not rehash
+  void reserve(size_type n);
+  // resizes to the smallest capacity that holds at least n slots and the
+  // current elements; may shrink
+  void rehash(size_type n);
+  float load_factor() const;
+  float max_load_factor() const { return max_load; }
+  // throws std::invalid_argument unless 0 < ml < 1; grows the table if it
+  // is now too full
+  void max_load_factor(float ml);
+
+  // modifiers
+  void clear();
+  std::pair<Iterator, bool> insert(const std::pair<Key, Value>& data);
+  std::pair<Iterator, bool> insert(std::pair<Key, Value>&& data);
+  template <typename... Args>
+  std::pair<Iterator, bool> emplace(Args&&... args);
+  template <typename K, typename... Args>
+  std::pair<Iterator, bool> try_emplace(K&& key, Args&&... args);
+  void erase(Iterator pos);
+  size_type erase(const Key& key);
+  void swap(HashTable& other);
+  // moves in every element of other whose key is not here yet
+  void merge(HashTable& other);
+
+  // lookup
+  Iterator find(const Key& key);
+  bool contains(const Key& key) const;
+
+  // observers
+  Hash hash_function() const { return hash; }
+  KeyEqual key_eq() const { return equal; }
+};
+
+}  // namespace s21
+
+#include "s21_hash_table.tpp"
+
+#endif  // SRC_S21_CONTAINERS_S21_HASH_TABLE_H_
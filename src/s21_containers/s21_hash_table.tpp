@@ -0,0 +1,451 @@
+#ifndef SRC_S21_CONTAINERS_S21_HASH_TABLE_TPP_
+#define SRC_S21_CONTAINERS_S21_HASH_TABLE_TPP_
+
+#include "s21_hash_table.h"
+
+namespace s21 {
+
+// Bit i of the result is set when control byte i of the group equals h2.
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+unsigned HashTable<Key, Value, Hash, KeyEqual>::match(const ctrl_t* group,
+                                                      ctrl_t h2) {
+#ifdef __SSE2__
+  __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(h2)));
+#else
+  unsigned mask = 0;
+  for (size_t i = 0; i < kGroup; ++i) {
+    mask |= static_cast<unsigned>(group[i] == h2) << i;
+  }
+  return mask;
+#endif
+}
+
+// Full slots hold 0..127, so kEmpty is the only byte with its sign bit set.
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+unsigned HashTable<Key, Value, Hash, KeyEqual>::match_empty(
+    const ctrl_t* group) {
+#ifdef __SSE2__
+  __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+  return _mm_movemask_epi8(bytes);
+#else
+  unsigned mask = 0;
+  for (size_t i = 0; i < kGroup; ++i) {
+    mask |= static_cast<unsigned>(group[i] < 0) << i;
+  }
+  return mask;
+#endif
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Value, Hash, KeyEqual>::lowest_bit(unsigned mask) {
+  return __builtin_ctz(mask);
+}
+
+// std::hash is the identity for integers, so its result is mixed before
+// the low 7 bits become the control byte and the rest picks the group.
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Value, Hash, KeyEqual>::mixed_hash(
+    const Key& key) const {
+  uint64_t h = hash(key);
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  return static_cast<size_t>(h);
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Value, Hash, KeyEqual>::home_group(size_t h) const {
+  return (h >> 7) & (slots.size() / kGroup - 1);
+}
+
+// At least one slot always stays empty, so every probe terminates.
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Value, Hash, KeyEqual>::limit_for(size_t cap) const {
+  size_t limit = static_cast<size_t>(cap * max_load);
+  return limit < cap ? limit : cap - 1;
+}
+
+// the smallest power-of-two number of groups whose limit admits n elements
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Value, Hash, KeyEqual>::capacity_for(size_t n) const {
+  if (!n) return 0;
+  size_t cap = kGroup;
+  while (limit_for(cap) < n) {
+    if (cap > max_size() / 2) {
+      throw std::length_error("HashTable: too many elements");
+    }
+    cap *= 2;
+  }
+  return cap;
+}
+
+// Returns the slot holding key, or capacity() if there is none.
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Value, Hash, KeyEqual>::find_index(
+    const Key& key) const {
+  size_t cap = slots.size();
+  if (!count) return cap;
+  size_t h = mixed_hash(key);
+  ctrl_t h2 = static_cast<ctrl_t>(h & 0x7f);
+  size_t mask = cap / kGroup - 1;
+  const std::pair<Key, Value>* data = slots.cbegin();
+  for (size_t g = home_group(h);; g = (g + 1) & mask) {
+    const ctrl_t* group = group_at(g);
+    for (unsigned hits = match(group, h2); hits; hits &= hits - 1) {
+      size_t i = g * kGroup + lowest_bit(hits);
+      if (equal(data[i].first, key)) return i;
+    }
+    if (match_empty(group)) return cap;
+  }
+}
+
+// the first empty slot on the probe sequence of hash h
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Value, Hash, KeyEqual>::empty_slot(size_t h) const {
+  size_t mask = slots.size() / kGroup - 1;
+  for (size_t g = home_group(h);; g = (g + 1) & mask) {
+    unsigned empties = match_empty(group_at(g));
+    if (empties) return g * kGroup + lowest_bit(empties);
+  }
+}
+
+// Claims an empty slot for key, which must not be in the table yet, and
+// grows the table first if it is full. The caller fills the slot.
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+size_t HashTable<Key, Value, Hash, KeyEqual>::prepare_slot(const Key& key) {
+  if (count + 1 > growth_limit) {
+    size_t cap = capacity_for(count + 1);
+    rehash_to(cap > 2 * slots.size() ? cap : 2 * slots.size());
+  }
+  size_t h = mixed_hash(key);
+  size_t i = empty_slot(h);
+  ctrl.data()[i] = static_cast<ctrl_t>(h & 0x7f);
+  ++count;
+  return i;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Hash, KeyEqual>::rehash_to(size_t cap) {
+  HashTable built(hash, equal);
+  built.max_load = max_load;
+  if (cap) {
+    vector<ctrl_t> empty_ctrl(cap);
+    std::fill(empty_ctrl.begin(), empty_ctrl.end(), kEmpty);
+    built.ctrl = std::move(empty_ctrl);
+    built.slots = vector<std::pair<Key, Value>>(cap);
+    built.growth_limit = built.limit_for(cap);
+  }
+  const ctrl_t* old_ctrl = ctrl.cbegin();
+  std::pair<Key, Value>* old_slots = slots.data();
+  for (size_t i = 0; i < slots.size(); ++i) {
+    if (old_ctrl[i] != kEmpty) {
+      size_t h = mixed_hash(old_slots[i].first);
+      size_t j = built.empty_slot(h);
+      built.ctrl.data()[j] = static_cast<ctrl_t>(h & 0x7f);
+      built.slots.data()[j] = std::move(old_slots[i]);
+    }
+  }
+  built.count = count;
+  swap(built);
+}
+
+// Empties the slot, then closes the gap instead of leaving a tombstone. A
+// probe only ever passed through the hole's group if that group was full;
+// then the following groups are searched for an element whose home group
+// lies at or before the hole. The first one found moves into the hole, and
+// the search goes on from the slot it left, as long as the groups it
+// crosses were full.
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Hash, KeyEqual>::erase_index(size_t index) {
+  ctrl_t* c = ctrl.data();
+  std::pair<Key, Value>* data = slots.data();
+  data[index] = std::pair<Key, Value>();
+  c[index] = kEmpty;
+  --count;
+  size_t mask = slots.size() / kGroup - 1;
+  size_t hole = index;
+  size_t hole_group = hole / kGroup;
+  if (__builtin_popcount(match_empty(group_at(hole_group))) > 1) return;
+  for (size_t g = (hole_group + 1) & mask; g != hole_group;
+       g = (g + 1) & mask) {
+    unsigned empties = match_empty(group_at(g));
+    unsigned full = ~empties & ((1u << kGroup) - 1);
+    size_t reach = (g - hole_group) & mask;
+    for (; full; full &= full - 1) {
+      size_t i = g * kGroup + lowest_bit(full);
+      if (((g - home_group(mixed_hash(data[i].first))) & mask) >= reach) {
+        data[hole] = std::move(data[i]);
+        data[i] = std::pair<Key, Value>();
+        c[hole] = c[i];
+        c[i] = kEmpty;
+        hole = i;
+        hole_group = g;
+        break;
+      }
+    }
+    if (empties) return;
+  }
+}
+
+// Iterator
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename HashTable<Key, Value, Hash, KeyEqual>::Iterator&
+HashTable<Key, Value, Hash, KeyEqual>::Iterator::operator++() {
+  const ctrl_t* c = table->ctrl.cbegin();
+  size_type cap = table->slots.size();
+  do {
+    ++index;
+  } while (index < cap && c[index] == kEmpty);
+  return *this;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename HashTable<Key, Value, Hash, KeyEqual>::Iterator
+HashTable<Key, Value, Hash, KeyEqual>::Iterator::operator++(int) {
+  Iterator old = *this;
+  ++*this;
+  return old;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename HashTable<Key, Value, Hash, KeyEqual>::Iterator::reference
+HashTable<Key, Value, Hash, KeyEqual>::Iterator::operator*() const {
+  if (!table || index >= table->slots.size()) {
+    throw std::out_of_range("Dereferencing end() iterator");
+  }
+  return table->slots.data()[index];
+}
+
+// constructors
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+HashTable<Key, Value, Hash, KeyEqual>::HashTable(const HashTable& table)
+    : ctrl(table.ctrl),
+      slots(table.slots),
+      count(table.count),
+      growth_limit(table.growth_limit),
+      max_load(table.max_load),
+      hash(table.hash),
+      equal(table.equal) {}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+HashTable<Key, Value, Hash, KeyEqual>::HashTable(HashTable&& table) noexcept
+    : ctrl(std::move(table.ctrl)),
+      slots(std::move(table.slots)),
+      count(table.count),
+      growth_limit(table.growth_limit),
+      max_load(table.max_load),
+      hash(table.hash),
+      equal(table.equal) {
+  table.count = 0;
+  table.growth_limit = 0;
+}
+
+// assignment
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+HashTable<Key, Value, Hash, KeyEqual>&
+HashTable<Key, Value, Hash, KeyEqual>::operator=(const HashTable& table) {
+  if (this != &table) {
+    HashTable copy(table);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+HashTable<Key, Value, Hash, KeyEqual>&
+HashTable<Key, Value, Hash, KeyEqual>::operator=(HashTable&& table) noexcept {
+  if (this != &table) {
+    HashTable taken(std::move(table));
+    swap(taken);
+  }
+  return *this;
+}
+
+// Iterators
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename HashTable<Key, Value, Hash, KeyEqual>::Iterator
+HashTable<Key, Value, Hash, KeyEqual>::begin() {
+  const ctrl_t* c = ctrl.cbegin();
+  size_t i = 0;
+  while (i < slots.size() && c[i] == kEmpty) ++i;
+  return Iterator(this, i);
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename HashTable<Key, Value, Hash, KeyEqual>::ConstIterator
+HashTable<Key, Value, Hash, KeyEqual>::cbegin() const {
+  return ConstIterator(const_cast<HashTable*>(this)->begin());
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename HashTable<Key, Value, Hash, KeyEqual>::ConstIterator
+HashTable<Key, Value, Hash, KeyEqual>::cend() const {
+  return ConstIterator(const_cast<HashTable*>(this), slots.size());
+}
+
+// capacity
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Hash, KeyEqual>::reserve(size_type n) {
+  if (n > growth_limit) {
+    rehash_to(capacity_for(n));
+  }
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Hash, KeyEqual>::rehash(size_type n) {
+  size_t cap = capacity_for(count);
+  while (cap < n) {
+    cap = cap ? cap * 2 : kGroup;
+  }
+  if (cap != slots.size()) {
+    rehash_to(cap);
+  }
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+float HashTable<Key, Value, Hash, KeyEqual>::load_factor() const {
+  return slots.size() ? static_cast<float>(count) / slots.size() : 0.0f;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Hash, KeyEqual>::max_load_factor(float ml) {
+  if (!(ml > 0.0f && ml < 1.0f)) {
+    throw std::invalid_argument("max_load_factor must be in (0, 1)");
+  }
+  max_load = ml;
+  growth_limit = slots.size() ? limit_for(slots.size()) : 0;
+  if (count > growth_limit) {
+    rehash_to(capacity_for(count));
+  }
+}
+
+// empty slots and the control bytes are overhead
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+MemoryStats HashTable<Key, Value, Hash, KeyEqual>::memory_stats() const {
+  MemoryStats held = memory::held_by(ctrl);
+  held += memory::held_by(slots);
+  return memory::split(sizeof(*this) + held.total(), count,
+                       memory::element_bytes<Key, Value>(), held.allocations);
+}
+
+// modifiers
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Hash, KeyEqual>::clear() {
+  ctrl_t* c = ctrl.data();
+  std::pair<Key, Value>* data = slots.data();
+  for (size_t i = 0; i < slots.size(); ++i) {
+    if (c[i] != kEmpty) {
+      data[i] = std::pair<Key, Value>();
+      c[i] = kEmpty;
+    }
+  }
+  count = 0;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+std::pair<typename HashTable<Key, Value, Hash, KeyEqual>::Iterator, bool>
+HashTable<Key, Value, Hash, KeyEqual>::insert(
+    const std::pair<Key, Value>& data) {
+  return try_emplace(data.first, data.second);
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+std::pair<typename HashTable<Key, Value, Hash, KeyEqual>::Iterator, bool>
+HashTable<Key, Value, Hash, KeyEqual>::insert(std::pair<Key, Value>&& data) {
+  return try_emplace(std::move(data.first), std::move(data.second));
+}
+
+// The element is built first, since its key is only known afterwards.
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+template <typename... Args>
+std::pair<typename HashTable<Key, Value, Hash, KeyEqual>::Iterator, bool>
+HashTable<Key, Value, Hash, KeyEqual>::emplace(Args&&... args) {
+  std::pair<Key, Value> data(std::forward<Args>(args)...);
+  return insert(std::move(data));
+}
+
+// key and args are only consumed when the key is new. The element is built
+// before a slot is claimed: args may refer into the table, which the claim
+// can rehash, and a constructor that throws must leave no key behind.
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+template <typename K, typename... Args>
+std::pair<typename HashTable<Key, Value, Hash, KeyEqual>::Iterator, bool>
+HashTable<Key, Value, Hash, KeyEqual>::try_emplace(K&& key, Args&&... args) {
+  size_t i = find_index(key);
+  if (i != slots.size()) {
+    return {Iterator(this, i), false};
+  }
+  std::pair<Key, Value> data(
+      std::piecewise_construct, std::forward_as_tuple(std::forward<K>(key)),
+      std::forward_as_tuple(std::forward<Args>(args)...));
+  i = prepare_slot(data.first);
+  slots.data()[i] = std::move(data);
+  return {Iterator(this, i), true};
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Hash, KeyEqual>::erase(Iterator pos) {
+  if (pos.table != this || pos.index >= slots.size() ||
+      ctrl.cbegin()[pos.index] == kEmpty) {
+    throw std::out_of_range("Erasing an invalid iterator");
+  }
+  erase_index(pos.index);
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename HashTable<Key, Value, Hash, KeyEqual>::size_type
+HashTable<Key, Value, Hash, KeyEqual>::erase(const Key& key) {
+  size_t i = find_index(key);
+  if (i == slots.size()) return 0;
+  erase_index(i);
+  return 1;
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Hash, KeyEqual>::swap(HashTable& other) {
+  ctrl.swap(other.ctrl);
+  slots.swap(other.slots);
+  std::swap(count, other.count);
+  std::swap(growth_limit, other.growth_limit);
+  std::swap(max_load, other.max_load);
+  std::swap(hash, other.hash);
+  std::swap(equal, other.equal);
+}
+
+// Erasing from other while walking it could move elements behind the
+// walk, so what stays in other is collected into a fresh table instead.
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void HashTable<Key, Value, Hash, KeyEqual>::merge(HashTable& other) {
+  if (this == &other || other.empty()) return;
+  HashTable rest(other.hash, other.equal);
+  rest.max_load = other.max_load;
+  const ctrl_t* c = other.ctrl.cbegin();
+  std::pair<Key, Value>* data = other.slots.data();
+  for (size_t i = 0; i < other.slots.size(); ++i) {
+    if (c[i] != kEmpty) {
+      if (contains(data[i].first)) {
+        rest.insert(std::move(data[i]));
+      } else {
+        insert(std::move(data[i]));
+      }
+    }
+  }
+  other.swap(rest);
+}
+
+// lookup
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+typename HashTable<Key, Value, Hash, KeyEqual>::Iterator
+HashTable<Key, Value, Hash, KeyEqual>::find(const Key& key) {
+  return Iterator(this, find_index(key));
+}
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+bool HashTable<Key, Value, Hash, KeyEqual>::contains(const Key& key) const {
+  return find_index(key) != slots.size();
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_CONTAINERS_S21_HASH_TABLE_TPP_
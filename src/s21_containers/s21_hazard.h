@@ -0,0 +1,44 @@
+#ifndef SRC_S21_CONTAINERS_S21_HAZARD_H_
+#define SRC_S21_CONTAINERS_S21_HAZARD_H_
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Hazard pointers: safe memory reclamation for lock-free containers. A
+// thread that is about to dereference a shared node publishes it in its
+// hazard slot and checks that the node is still reachable; a node that has
+// been unlinked is retired instead of deleted, and is freed only once no
+// slot holds it. Because a node cannot be freed and reused while a thread
+// holds it, compare-and-swap on node pointers is also safe from ABA.
+//
+// Every thread gets one slot, taken on its first use and given back when
+// the thread exits. Its retired nodes are scanned once there are about
+// twice as many as there are slots; what is still protected when the
+// thread exits is handed to the next thread that scans.
+namespace hazard {
+
+using deleter_type = void (*)(void*);
+
+struct Retired {
+  void* pointer = nullptr;
+  deleter_type deleter = nullptr;
+};
+
+// the hazard slot of the calling thread
+std::atomic<const void*>& slot();
+// frees pointer with deleter once no hazard slot holds it
+void retire(void* pointer, deleter_type deleter);
+// frees whatever the calling thread retired that is no longer protected
+void scan();
+
+}  // namespace hazard
+}  // namespace s21
+
+#include "s21_hazard.tpp"
+
+#endif  // SRC_S21_CONTAINERS_S21_HAZARD_H_
@@ -0,0 +1,175 @@
+#ifndef SRC_S21_CONTAINERS_S21_HAZARD_TPP_
+#define SRC_S21_CONTAINERS_S21_HAZARD_TPP_
+
+#include <algorithm>
+
+#include "s21_hazard.h"
+
+namespace s21 {
+namespace hazard {
+
+inline constexpr std::size_t kScanFloor = 64;
+
+struct Record {
+  std::atomic<const void*> pointer{nullptr};
+  std::atomic<bool> taken{true};
+  Record* next = nullptr;
+};
+
+// The slots of every thread that has ever taken one, and the nodes that
+// exiting threads could not free yet. Slots are reused but never freed
+// before the program ends.
+class Domain {
+ public:
+  Domain() = default;
+  Domain(const Domain&) = delete;
+  Domain& operator=(const Domain&) = delete;
+  ~Domain();
+
+  Record* acquire();
+  void release(Record* record);
+  std::size_t records() const { return count.load(std::memory_order_relaxed); }
+  void collect(vector<const void*>& hazards) const;
+  void orphan(vector<Retired>& retired);
+  void adopt(vector<Retired>& retired);
+
+ private:
+  std::atomic<Record*> head{nullptr};
+  std::atomic<std::size_t> count{0};
+  std::mutex orphans_lock;
+  vector<Retired> orphans;
+};
+
+inline Domain::~Domain() {
+  for (Retired* it = orphans.begin(); it != orphans.end(); ++it) {
+    it->deleter(it->pointer);
+  }
+  for (Record* record = head.load(); record;) {
+    Record* next = record->next;
+    delete record;
+    record = next;
+  }
+}
+
+inline Record* Domain::acquire() {
+  for (Record* record = head.load(std::memory_order_acquire); record;
+       record = record->next) {
+    bool free = false;
+    if (!record->taken.load(std::memory_order_relaxed) &&
+        record->taken.compare_exchange_strong(free, true,
+                                              std::memory_order_acquire)) {
+      return record;
+    }
+  }
+  Record* record = new Record;
+  record->next = head.load(std::memory_order_relaxed);
+  while (!head.compare_exchange_weak(record->next, record,
+                                     std::memory_order_release,
+                                     std::memory_order_relaxed)) {
+  }
+  count.fetch_add(1, std::memory_order_relaxed);
+  return record;
+}
+
+inline void Domain::release(Record* record) {
+  record->pointer.store(nullptr, std::memory_order_release);
+  record->taken.store(false, std::memory_order_release);
+}
+
+inline void Domain::collect(vector<const void*>& hazards) const {
+  for (Record* record = head.load(std::memory_order_acquire); record;
+       record = record->next) {
+    if (const void* pointer = record->pointer.load()) {
+      hazards.push_back(pointer);
+    }
+  }
+}
+
+inline void Domain::orphan(vector<Retired>& retired) {
+  std::lock_guard<std::mutex> lock(orphans_lock);
+  for (Retired* it = retired.begin(); it != retired.end(); ++it) {
+    orphans.push_back(*it);
+  }
+  retired.clear();
+}
+
+inline void Domain::adopt(vector<Retired>& retired) {
+  std::lock_guard<std::mutex> lock(orphans_lock);
+  for (Retired* it = orphans.begin(); it != orphans.end(); ++it) {
+    retired.push_back(*it);
+  }
+  orphans.clear();
+}
+
+inline Domain domain;
+
+// What one thread holds: its slot, taken on first use, and the nodes it
+// retired. The thread gives both back when it exits.
+class ThreadState {
+ public:
+  ThreadState() = default;
+  ThreadState(const ThreadState&) = delete;
+  ThreadState& operator=(const ThreadState&) = delete;
+  ~ThreadState();
+
+  std::atomic<const void*>& slot();
+  void retire(void* pointer, deleter_type deleter);
+  void scan();
+
+ private:
+  Record* record = nullptr;
+  vector<Retired> retired;
+};
+
+inline ThreadState::~ThreadState() {
+  scan();
+  if (!retired.empty()) domain.orphan(retired);
+  if (record) domain.release(record);
+}
+
+inline std::atomic<const void*>& ThreadState::slot() {
+  if (!record) record = domain.acquire();
+  return record->pointer;
+}
+
+inline void ThreadState::retire(void* pointer, deleter_type deleter) {
+  retired.push_back(Retired{pointer, deleter});
+  if (retired.size() >= 2 * domain.records() + kScanFloor) scan();
+}
+
+inline void ThreadState::scan() {
+  domain.adopt(retired);
+  if (retired.empty()) return;
+  // Orders the unlinks before the reads of the slots; it pairs with the
+  // seq_cst store and reload a reader does when it publishes a hazard, so
+  // either the reader sees the node gone or the scan sees the hazard.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  vector<const void*> hazards;
+  domain.collect(hazards);
+  std::sort(hazards.begin(), hazards.end());
+  std::size_t kept = 0;
+  for (std::size_t i = 0; i < retired.size(); ++i) {
+    Retired node = retired.data()[i];
+    if (std::binary_search(hazards.begin(), hazards.end(), node.pointer)) {
+      retired.data()[kept++] = node;
+    } else {
+      node.deleter(node.pointer);
+    }
+  }
+  while (retired.size() > kept) retired.pop_back();
+}
+
+inline thread_local ThreadState thread_state;
+
+inline std::atomic<const void*>& slot() { return thread_state.slot(); }
+
+inline void retire(void* pointer, deleter_type deleter) {
+  thread_state.retire(pointer, deleter);
+}
+
+inline void scan() { thread_state.scan(); }
+
+}  // namespace hazard
+}  // namespace s21
+
+#endif  // SRC_S21_CONTAINERS_S21_HAZARD_TPP_
@@ -0,0 +1,158 @@
+#ifndef SRC_S21_CONTAINERS_S21_INSTRUMENT_H_
+#define SRC_S21_CONTAINERS_S21_INSTRUMENT_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Opt-in operation counters. Build with -DS21_INSTRUMENT and the containers
+// report their allocations, element moves, comparisons and rebalancing to
+// one set of counters per container family (every vector<T> shares the
+// "vector" counters, for instance). Without the flag every hook is an empty
+// if constexpr branch and the comparators are not wrapped, so the
+// containers compile to exactly what they were. The flag has to be the same
+// in every translation unit of a program.
+namespace instrument {
+
+#ifdef S21_INSTRUMENT
+inline constexpr bool kEnabled = true;
+#else
+inline constexpr bool kEnabled = false;
+#endif
+
+enum class Event : unsigned {
+  kAllocation,    // heap blocks taken: a node, an array, an arena
+  kDeallocation,  // heap blocks given back
+  kReallocation,  // a live buffer replaced by a bigger or smaller one
+  kMove,          // elements moved to another slot
+  kComparison,    // calls of the key comparator
+  kRotation,      // single tree rotations
+  kRebalance,     // rebalancing steps, whether or not they rotate
+};
+inline constexpr std::size_t kEvents = 7;
+inline constexpr const char* kEventNames[kEvents] = {
+    "allocations", "deallocations", "reallocations", "moves",
+    "comparisons", "rotations",     "rebalances"};
+
+// The counters of one family. They are created on the first event and
+// live until the program ends; every family links itself into a list that
+// reset() and the dumps walk. Counting is atomic, so containers of one
+// family may be used from several threads.
+class Counters {
+ public:
+  explicit Counters(const char* family);
+  Counters(const Counters&) = delete;
+  Counters& operator=(const Counters&) = delete;
+
+  const char* family() const { return name; }
+  std::uint64_t get(Event event) const;
+  void add(Event event, std::uint64_t n);
+  void reset();
+  const Counters* next_family() const { return next; }
+
+ private:
+  const char* name;
+  std::atomic<std::uint64_t> counts[kEvents];
+  Counters* next;
+};
+
+// families with hooks in them
+namespace family {
+struct vector {
+  static constexpr const char* kName = "vector";
+};
+struct list {
+  static constexpr const char* kName = "list";
+};
+struct circular_buffer {
+  static constexpr const char* kName = "circular_buffer";
+};
+struct deque {
+  static constexpr const char* kName = "deque";
+};
+struct avl_tree {
+  static constexpr const char* kName = "AVLTree";
+};
+struct arena_avl_tree {
+  static constexpr const char* kName = "ArenaAVLTree";
+};
+struct b_plus_tree {
+  static constexpr const char* kName = "BPlusTree";
+};
+struct priority_queue {
+  static constexpr const char* kName = "priority_queue";
+};
+struct indexed_priority_queue {
+  static constexpr const char* kName = "indexed_priority_queue";
+};
+}  // namespace family
+
+template <typename Family>
+Counters& counters();
+
+// What the containers call. Each hook is a no-op unless S21_INSTRUMENT is
+// defined.
+template <typename Family>
+struct Hooks {
+  static void allocated(std::uint64_t n = 1) { add(Event::kAllocation, n); }
+  static void deallocated(std::uint64_t n = 1) {
+    add(Event::kDeallocation, n);
+  }
+  static void reallocated() { add(Event::kReallocation, 1); }
+  static void moved(std::uint64_t n) { add(Event::kMove, n); }
+  static void rotated(std::uint64_t n = 1) { add(Event::kRotation, n); }
+  static void rebalanced() { add(Event::kRebalance, 1); }
+  static void add(Event event, std::uint64_t n) {
+    if constexpr (kEnabled) {
+      counters<Family>().add(event, n);
+    }
+  }
+};
+
+// Wraps a comparator to count its calls; it converts back to Compare, so
+// key_comp() and the constructors that take a Compare keep working.
+template <typename Compare, typename Family>
+class CountingCompare {
+ public:
+  CountingCompare() = default;
+  CountingCompare(const Compare& compare) : comp(compare) {}
+  operator Compare() const { return comp; }
+
+  template <typename A, typename B>
+  bool operator()(const A& a, const B& b) const {
+    Hooks<Family>::add(Event::kComparison, 1);
+    return comp(a, b);
+  }
+
+ private:
+  Compare comp;
+};
+
+// the comparator a container of Family stores: Compare itself unless the
+// build is instrumented
+template <typename Compare, typename Family>
+using compare_t = std::conditional_t<kEnabled, CountingCompare<Compare, Family>,
+                                     Compare>;
+
+// the counters of a family, or null if it has not recorded anything yet
+const Counters* find(std::string_view family);
+// zeroes every family
+void reset();
+// one line per family, "vector: allocations=3 deallocations=1 ...", sorted
+// by family name
+std::string to_text();
+// {"vector": {"allocations": 3, ...}, ...}, sorted by family name
+std::string to_json();
+
+}  // namespace instrument
+}  // namespace s21
+
+#include "s21_instrument.tpp"
+
+#endif  // SRC_S21_CONTAINERS_S21_INSTRUMENT_H_
@@ -0,0 +1,112 @@
+#ifndef SRC_S21_CONTAINERS_S21_INSTRUMENT_TPP_
+#define SRC_S21_CONTAINERS_S21_INSTRUMENT_TPP_
+
+#include <algorithm>
+#include <vector>
+
+#include "s21_instrument.h"
+
+namespace s21 {
+namespace instrument {
+
+// head of the list of families, newest first
+inline std::atomic<Counters*> families{nullptr};
+
+inline Counters::Counters(const char* family) : name(family), next(nullptr) {
+  for (auto& count : counts) count.store(0, std::memory_order_relaxed);
+  next = families.load(std::memory_order_relaxed);
+  while (!families.compare_exchange_weak(next, this,
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed)) {
+  }
+}
+
+inline std::uint64_t Counters::get(Event event) const {
+  return counts[static_cast<unsigned>(event)].load(std::memory_order_relaxed);
+}
+
+inline void Counters::add(Event event, std::uint64_t n) {
+  counts[static_cast<unsigned>(event)].fetch_add(n,
+                                                 std::memory_order_relaxed);
+}
+
+inline void Counters::reset() {
+  for (auto& count : counts) count.store(0, std::memory_order_relaxed);
+}
+
+template <typename Family>
+Counters& counters() {
+  static Counters family_counters(Family::kName);
+  return family_counters;
+}
+
+inline const Counters* find(std::string_view family) {
+  const Counters* node = families.load(std::memory_order_acquire);
+  while (node && family != node->family()) node = node->next_family();
+  return node;
+}
+
+inline void reset() {
+  for (Counters* node = families.load(std::memory_order_acquire); node;
+       node = const_cast<Counters*>(node->next_family())) {
+    node->reset();
+  }
+}
+
+// std::vector rather than s21::vector, so that dumping does not count
+// itself
+inline std::vector<const Counters*> sorted_families() {
+  std::vector<const Counters*> sorted;
+  for (const Counters* node = families.load(std::memory_order_acquire); node;
+       node = node->next_family()) {
+    sorted.push_back(node);
+  }
+  std::sort(sorted.begin(), sorted.end(),
+            [](const Counters* a, const Counters* b) {
+              return std::string_view(a->family()) <
+                     std::string_view(b->family());
+            });
+  return sorted;
+}
+
+inline std::string to_text() {
+  std::string text;
+  for (const Counters* node : sorted_families()) {
+    text += node->family();
+    text += ':';
+    for (std::size_t e = 0; e < kEvents; ++e) {
+      text += ' ';
+      text += kEventNames[e];
+      text += '=';
+      text += std::to_string(node->get(static_cast<Event>(e)));
+    }
+    text += '\n';
+  }
+  return text;
+}
+
+inline std::string to_json() {
+  std::string json = "{";
+  const char* separator = "";
+  for (const Counters* node : sorted_families()) {
+    json += separator;
+    json += '"';
+    json += node->family();
+    json += "\": {";
+    for (std::size_t e = 0; e < kEvents; ++e) {
+      json += e ? ", \"" : "\"";
+      json += kEventNames[e];
+      json += "\": ";
+      json += std::to_string(node->get(static_cast<Event>(e)));
+    }
+    json += '}';
+    separator = ", ";
+  }
+  json += '}';
+  return json;
+}
+
+}  // namespace instrument
+}  // namespace s21
+
+#endif  // SRC_S21_CONTAINERS_S21_INSTRUMENT_TPP_
@@ -4,6 +4,10 @@
 #include <initializer_list>
 #include <iostream>
 #include <limits>
+#include <utility>
+
+#include "s21_instrument.h"
+#include "s21_memory_stats.h"
 
 namespace s21 {
 
@@ -36,8 +40,8 @@ class list {
   list &operator=(list &&other);
 
   // accessing
-  const_reference front();
-  const_reference back();
+  const_reference front() const;
+  const_reference back() const;
 
   // iterating
   iterator begin();
@@ -49,12 +53,16 @@ class list {
   bool empty() const;
   size_type size() const;
   size_type max_size() const;
+  MemoryStats memory_stats() const;
+  size_type memory_usage() const { return memory_stats().total(); }
 
   // modifying
   void clear();
   iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, value_type &&value);
   void erase(iterator pos);
   void push_back(const_reference value);
+  void push_back(value_type &&value);
   void push_front(const_reference value);
   void pop_back();
   void pop_front();
@@ -75,11 +83,12 @@ class list {
 
   // Node Struct
  private:
+  using hooks = instrument::Hooks<instrument::family::list>;
   struct Node {
     // constructors
     Node() : next(this), prev(this), data(value_type()) {}
     explicit Node(value_type value)
-        : next(nullptr), prev(nullptr), data(value) {}
+        : next(nullptr), prev(nullptr), data(std::move(value)) {}
 
     // methods
     void links_insert(Node *new_node) {
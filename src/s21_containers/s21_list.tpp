@@ -5,7 +5,9 @@ namespace s21 {
 
 // constructors
 template <typename T>
-list<T>::list() : tail(new Node()), list_sz(0){};
+list<T>::list() : tail(new Node()), list_sz(0) {
+  hooks::allocated();
+}
 
 template <typename T>
 list<T>::list(size_type n) : list() {
@@ -31,6 +33,7 @@ list<T>::list(list &&other) : list() {
 template <typename T>
 list<T>::~list() {
   clear();
+  hooks::deallocated();
   delete tail;
   tail = nullptr;
 }
@@ -40,6 +43,7 @@ template <typename T>
 list<T> &list<T>::operator=(const list &other) {
   if (this != &other) {
     clear();
+    hooks::deallocated();
     delete tail;
     tail = nullptr;
     new (this) list(other);
@@ -58,12 +62,12 @@ list<T> &list<T>::operator=(list &&other) {
 
 // methods to access elements of the class
 template <typename T>
-typename list<T>::const_reference list<T>::front() {
+typename list<T>::const_reference list<T>::front() const {
   return *begin();
 }
 
 template <typename T>
-typename list<T>::const_reference list<T>::back() {
+typename list<T>::const_reference list<T>::back() const {
   return *(--end());
 }
 
@@ -104,6 +108,13 @@ typename list<T>::size_type list<T>::max_size() const {
   return ((std::numeric_limits<size_type>::max() / 2) / sizeof(Node));
 }
 
+// the tail sentinel is allocated even for an empty list
+template <typename T>
+MemoryStats list<T>::memory_stats() const {
+  return memory::split(sizeof(*this) + (list_sz + 1) * sizeof(Node), list_sz,
+                       sizeof(T), list_sz + 1);
+}
+
 // methods for modifying a container
 template <typename T>
 void list<T>::clear() {
@@ -114,6 +125,16 @@ template <typename T>
 typename list<T>::iterator list<T>::insert(iterator pos,
                                            const_reference value) {
   Node *new_node = new Node(value);
+  hooks::allocated();
+  pos.node->links_insert(new_node);
+  ++list_sz;
+  return iterator(new_node);
+}
+
+template <typename T>
+typename list<T>::iterator list<T>::insert(iterator pos, value_type &&value) {
+  Node *new_node = new Node(std::move(value));
+  hooks::allocated();
   pos.node->links_insert(new_node);
   ++list_sz;
   return iterator(new_node);
@@ -123,6 +144,7 @@ template <typename T>
 void list<T>::erase(iterator pos) {
   if (pos != end()) {
     pos.node->links_erase();
+    hooks::deallocated();
     delete pos.node;
     --list_sz;
   }
@@ -133,6 +155,11 @@ void list<T>::push_back(const_reference value) {
   insert(end(), value);
 }
 
+template <typename T>
+void list<T>::push_back(value_type &&value) {
+  insert(end(), std::move(value));
+}
+
 template <typename T>
 void list<T>::push_front(const_reference value) {
   insert(begin(), value);
@@ -1,28 +1,50 @@
 #ifndef SRC_S21_CONTAINERS_S21_MAP_H_
 #define SRC_S21_CONTAINERS_S21_MAP_H_
 
+#include "s21_arena_avltree.h"
 #include "s21_avltree.h"
+#include "s21_bloom_tree.h"
+#include "s21_btree.h"
 
 namespace s21 {
 
-template <typename Key, typename Val>
+// Tree selects the backing store: AVLTree (the default), ArenaAVLTree,
+// BPlusTree or FlatTree, optionally behind a BloomTree filter.
+template <typename Key, typename Val, typename Compare = std::less<Key>,
+          template <typename, typename, typename> class Tree = AVLTree>
 class map {
  private:
-  AVLTree<Key, Val> tree;
+  using tree_type = Tree<Key, Val, Compare>;
+  tree_type tree;
 
  public:
   using key_type = Key;
   using mapped_type = Val;
   using value_type = std::pair<const key_type, mapped_type>;
+  using key_compare = Compare;
   using reference = value_type&;
   using const_reference = const value_type&;
-  using iterator = typename AVLTree<Key, Val>::iterator;
-  using const_iterator = typename AVLTree<Key, Val>::const_iterator;
-  using size_type = typename AVLTree<Key, Val>::size_type;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+  using size_type = typename tree_type::size_type;
+  using node_type = typename tree_type::node_type;
+
+  // what insert(node_type&&) returns: node is empty unless the key was
+  // already taken, in which case it hands the element back
+  struct insert_return_type {
+    iterator position;
+    bool inserted;
+    node_type node;
+  };
 
   // constructors
   map() = default;
+  explicit map(const Compare& comp) : tree(comp) {}
   map(std::initializer_list<value_type> const& items);
+  template <typename InputIt>
+  map(InputIt first, InputIt last, const Compare& comp = Compare());
   map(const map& m) : tree(m.tree) {}
   map(map&& m) : tree(std::move(m.tree)) {}
 
@@ -35,32 +57,123 @@ class map {
   // element access
   Val& at(const Key& key);
   Val& operator[](const Key& key);
+  Val& operator[](Key&& key);
 
   // iterators
   iterator begin() { return tree.begin(); }
   iterator end() { return tree.end(); }
   const_iterator cbegin() { return tree.cbegin(); }
   const_iterator cend() { return tree.cend(); }
+  reverse_iterator rbegin() { return reverse_iterator(end()); }
+  reverse_iterator rend() { return reverse_iterator(begin()); }
+  const_reverse_iterator crbegin() { return const_reverse_iterator(cend()); }
+  const_reverse_iterator crend() { return const_reverse_iterator(cbegin()); }
+
+  // O(1): the elements with the smallest and the largest key
+  typename iterator::reference front() { return *begin(); }
+  typename iterator::reference back() { return *--end(); }
 
   // Capacity
   bool empty() const { return tree.empty(); }
   size_type size() const { return tree.size(); }
   size_type max_size() const { return tree.max_size(); }
+  MemoryStats memory_stats() const { return tree.memory_stats(); }
+  size_type memory_usage() const { return tree.memory_usage(); }
+  // ArenaAVLTree and FlatTree only: preallocates room for n elements;
+  // BloomTree sizes its filter for n keys
+  void reserve(size_type n) { tree.reserve(n); }
+  // BloomTree only: the estimated chance that looking up a missing key
+  // still searches the tree
+  double false_positive_rate() const { return tree.false_positive_rate(); }
 
   // Modifiers
   void clear() { tree.clear(); }
   std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(value_type&& value);
   std::pair<iterator, bool> insert(const Key& key, const Val& obj);
-  std::pair<iterator, bool> insert_or_assign(const Key& key, const Val& obj);
+  iterator insert(iterator hint, const value_type& value);
+  iterator insert(iterator hint, value_type&& value);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  template <typename... Args>
+  iterator emplace_hint(iterator hint, Args&&... args);
+  // the mapped value is built from args only when key is not there yet
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args);
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(const Key& key, M&& obj);
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(Key&& key, M&& obj);
   void erase(iterator pos) { tree.erase(pos); }
+  iterator erase(iterator first, iterator last) {
+    return tree.erase(first, last);
+  }
+  // node handles move elements between maps without copying them; with
+  // the default AVLTree backend they do not allocate either
+  node_type extract(iterator pos) { return tree.extract(pos); }
+  node_type extract(const key_type& key) {
+    return tree.extract(tree.find(key));
+  }
+  insert_return_type insert(node_type&& node);
   void swap(map& other) { tree.swap(other.tree); }
   void merge(map& other) { tree.merge(other.tree, false); }
+  // split keeps the keys less than key and returns the rest; join takes
+  // every element of other, whose keys must all sort before or all after
+  // ours, and throws std::invalid_argument if they overlap. On AVLTree
+  // both only relink O(log n) nodes.
+  map split(const key_type& key);
+  void join(map& other);
+  template <typename ForwardIt>
+  void assign_sorted(ForwardIt first, ForwardIt last);
+  // the range constructor for large unsorted input: the elements are sorted
+  // on up to threads threads (0: one per hardware thread) before the tree
+  // is built bottom-up; keep picks whether the first or the last value
+  // given for a key stays
+  template <typename InputIt>
+  void assign_parallel(InputIt first, InputIt last,
+                       bulk::Keep keep = bulk::Keep::kFirst,
+                       unsigned threads = 0);
 
   // Lookup
   bool contains(const key_type& key) { return tree.contains(key); }
 
   // extra methods
   iterator find(const key_type& key) { return tree.find(key); }
+  // heterogeneous lookup, only with a transparent Compare such as
+  // std::less<>
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K& key) {
+    return tree.find(key);
+  }
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K& key) {
+    return tree.contains(key);
+  }
+  // find and contains for every key of [first, last), written to out in
+  // order; the lookups run in interleaved batches that overlap their cache
+  // misses, which pays off for many keys in a tree larger than the cache
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out) {
+    tree.find_many(first, last, [&out](typename tree_type::Iterator it) {
+      *out++ = it;
+    });
+    return out;
+  }
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt contains_many(ForwardIt first, ForwardIt last, OutputIt out) {
+    typename tree_type::Iterator none = tree.end();
+    tree.find_many(first, last, [&out, none](typename tree_type::Iterator it) {
+      *out++ = it != none;
+    });
+    return out;
+  }
+
+  // Observers
+  key_compare key_comp() const { return tree.key_comp(); }
 
   // part 3
   template <typename... Args>
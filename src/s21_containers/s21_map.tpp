@@ -5,60 +5,196 @@
 
 namespace s21 {
 
-template <typename Key, typename Val>
-map<Key, Val>::map(std::initializer_list<value_type> const& items) {
-  for (const auto& item : items) {
-    tree.insert(item, false);
-  }
+template <typename Key, typename Val, typename Compare,
+          template <typename, typename, typename> class Tree>
+map<Key, Val, Compare, Tree>::map(
+    std::initializer_list<value_type> const& items) {
+  tree.assign(items.begin(), items.end(), false);
+}
+
+template <typename Key, typename Val, typename Compare,
+          template <typename, typename, typename> class Tree>
+template <typename InputIt>
+map<Key, Val, Compare, Tree>::map(InputIt first, InputIt last,
+                                  const Compare& comp)
+    : tree(comp) {
+  tree.assign(first, last, false);
 }
 
-template <typename Key, typename Val>
-map<Key, Val>& map<Key, Val>::operator=(map&& m) noexcept {
+template <typename Key, typename Val, typename Compare,
+          template <typename, typename, typename> class Tree>
+map<Key, Val, Compare, Tree>& map<Key, Val, Compare, Tree>::operator=(
+    map&& m) noexcept {
   if (this != &m) {
-    tree = m.tree;
+    tree = std::move(m.tree);
   }
   return *this;
 }
 
-template <typename Key, typename Val>
-Val& map<Key, Val>::at(const Key& key) {
+template <typename Key, typename Val, typename Compare,
+          template <typename, typename, typename> class Tree>
+template <typename ForwardIt>
+void map<Key, Val, Compare, Tree>::assign_sorted(ForwardIt first,
+                                                 ForwardIt last) {
+  tree.assign_sorted(first, last, false);
+}
+
+template <typename Key, typename Val, typename Compare,
+          template <typename, typename, typename> class Tree>
+template <typename InputIt>
+void map<Key, Val, Compare, Tree>::assign_parallel(InputIt first,
+                                                   InputIt last,
+                                                   bulk::Keep keep,
+                                                   unsigned threads) {
+  tree.assign_parallel(first, last, false, keep, threads);
+}
+
+template <typename Key, typename Val, typename Compare,
+          template <typename, typename, typename> class Tree>
+Val& map<Key, Val, Compare, Tree>::at(const Key& key) {
   auto res = tree.find(key);
   if (res == end()) throw std::out_of_range("key not found");
   return (*res).second;
 }
 
-template <typename Key, typename Val>
-Val& map<Key, Val>::operator[](const Key& key) {
-  auto res = tree.insert(std::make_pair(key, Val()), false).first;
-  return (*res).second;
+template <typename Key, typename Val, typename Compare,
+          template <typename, typename, typename> class Tree>
+Val& map<Key, Val, Compare, Tree>::operator[](const Key& key) {
+  return (*tree.try_emplace(key).first).second;
+}
+
+template <typename Key, typename Val, typename Compare,
+          template <typename, typename, typename> class Tree>
+Val& map<Key, Val, Compare, Tree>::operator[](Key&& key) {
+  return (*tree.try_emplace(std::move(key)).first).second;
 }
 
-template <typename Key, typename Val>
-std::pair<typename map<Key, Val>::iterator, bool> map<Key, Val>::insert(
-    const value_type& value) {
+template <typename Key, typename Val, typename Compare,
+          template <typename, typename, typename> class Tree>
+std::pair<typename map<Key, Val, Compare, Tree>::iterator, bool>
+map<Key, Val, Compare, Tree>::insert(const value_type& value) {
   return tree.insert(value, false);
 }
 
-template <typename Key, typename Val>
-std::pair<typename map<Key, Val>::iterator, bool> map<Key, Val>::insert(
-    const Key& key, const Val& obj) {
-  return tree.insert(std::make_pair(key, obj), false);
+// The key is const, so only the mapped value can be moved.
+template <typename Key, typename Val, typename Compare,
+          template <typename, typename, typename> class Tree>
+std::pair<typename map<Key, Val, Compare, Tree>::iterator, bool>
+map<Key, Val, Compare, Tree>::insert(value_type&& value) {
+  return tree.insert(std::pair<Key, Val>(std::move(value)), false);
+}
+
+template <typename Key, typename Val, typename Compare,
+          template <typename, typename, typename> class Tree>
+std::pair<typename map<Key, Val, Compare, Tree>::iterator, bool>
+map<Key, Val, Compare, Tree>::insert(const Key& key, const Val& obj) {
+  return tree.try_emplace(key, obj);
+}
+
+template <typename Key, typename Val, typename Compare,
+          template <typename, typename, typename> class Tree>
+typename map<Key, Val, Compare, Tree>::iterator
+map<Key, Val, Compare, Tree>::insert(iterator hint, const value_type& value) {
+  return tree.insert(hint, value, false).first;
+}
+
+template <typename Key, typename Val, typename Compare,
+          template <typename, typename, typename> class Tree>
+typename map<Key, Val, Compare, Tree>::iterator
+map<Key, Val, Compare, Tree>::insert(iterator hint, value_type&& value) {
+  return tree.insert(hint, std::pair<Key, Val>(std::move(value)), false).first;
+}
+
+template <typename Key, typename Val, typename Compare,
+          template <typename, typename, typename> class Tree>
+template <typename... Args>
+std::pair<typename map<Key, Val, Compare, Tree>::iterator, bool>
+map<Key, Val, Compare, Tree>::emplace(Args&&... args) {
+  return tree.emplace(false, std::forward<Args>(args)...);
+}
+
+template <typename Key, typename Val, typename Compare,
+          template <typename, typename, typename> class Tree>
+template <typename... Args>
+typename map<Key, Val, Compare, Tree>::iterator
+map<Key, Val, Compare, Tree>::emplace_hint(iterator hint, Args&&... args) {
+  return tree.insert(hint, std::pair<Key, Val>(std::forward<Args>(args)...),
+                     false)
+      .first;
+}
+
+template <typename Key, typename Val, typename Compare,
+          template <typename, typename, typename> class Tree>
+typename map<Key, Val, Compare, Tree>::insert_return_type
+map<Key, Val, Compare, Tree>::insert(node_type&& node) {
+  auto res = tree.insert(node, false);
+  return insert_return_type{res.first, res.second, std::move(node)};
+}
+
+template <typename Key, typename Val, typename Compare,
+          template <typename, typename, typename> class Tree>
+template <typename... Args>
+std::pair<typename map<Key, Val, Compare, Tree>::iterator, bool>
+map<Key, Val, Compare, Tree>::try_emplace(const Key& key, Args&&... args) {
+  return tree.try_emplace(key, std::forward<Args>(args)...);
+}
+
+template <typename Key, typename Val, typename Compare,
+          template <typename, typename, typename> class Tree>
+template <typename... Args>
+std::pair<typename map<Key, Val, Compare, Tree>::iterator, bool>
+map<Key, Val, Compare, Tree>::try_emplace(Key&& key, Args&&... args) {
+  return tree.try_emplace(std::move(key), std::forward<Args>(args)...);
+}
+
+// obj is consumed by exactly one of the two branches: try_emplace only
+// touches it when it creates the element.
+template <typename Key, typename Val, typename Compare,
+          template <typename, typename, typename> class Tree>
+template <typename M>
+std::pair<typename map<Key, Val, Compare, Tree>::iterator, bool>
+map<Key, Val, Compare, Tree>::insert_or_assign(const Key& key, M&& obj) {
+  auto res = tree.try_emplace(key, std::forward<M>(obj));
+  if (!res.second) {
+    (*res.first).second = std::forward<M>(obj);
+  }
+  return res;
 }
 
-template <typename Key, typename Val>
-std::pair<typename map<Key, Val>::iterator, bool>
-map<Key, Val>::insert_or_assign(const Key& key, const Val& obj) {
-  auto res = tree.insert(std::make_pair(key, obj), false);
+template <typename Key, typename Val, typename Compare,
+          template <typename, typename, typename> class Tree>
+template <typename M>
+std::pair<typename map<Key, Val, Compare, Tree>::iterator, bool>
+map<Key, Val, Compare, Tree>::insert_or_assign(Key&& key, M&& obj) {
+  auto res = tree.try_emplace(std::move(key), std::forward<M>(obj));
   if (!res.second) {
-    (*res.first).second = obj;
+    (*res.first).second = std::forward<M>(obj);
   }
   return res;
 }
 
-template <typename Key, typename Val>
+template <typename Key, typename Val, typename Compare,
+          template <typename, typename, typename> class Tree>
+map<Key, Val, Compare, Tree> map<Key, Val, Compare, Tree>::split(
+    const key_type& key) {
+  map tail(key_comp());
+  tail.tree = tree.split(tree.lower_bound(key));
+  return tail;
+}
+
+template <typename Key, typename Val, typename Compare,
+          template <typename, typename, typename> class Tree>
+void map<Key, Val, Compare, Tree>::join(map& other) {
+  if (!tree.join(other.tree, false)) {
+    throw std::invalid_argument("join: key ranges overlap");
+  }
+}
+
+template <typename Key, typename Val, typename Compare,
+          template <typename, typename, typename> class Tree>
 template <typename... Args>
-vector<std::pair<typename map<Key, Val>::iterator, bool>>
-map<Key, Val>::insert_many(Args&&... args) {
+vector<std::pair<typename map<Key, Val, Compare, Tree>::iterator, bool>>
+map<Key, Val, Compare, Tree>::insert_many(Args&&... args) {
   vector<std::pair<iterator, bool>> result;
   (result.push_back(insert(std::forward<Args>(args))), ...);
   return result;
@@ -0,0 +1,66 @@
+#ifndef SRC_S21_CONTAINERS_S21_MEMORY_STATS_H_
+#define SRC_S21_CONTAINERS_S21_MEMORY_STATS_H_
+
+#include <cstddef>
+#include <type_traits>
+
+namespace s21 {
+
+// What a container costs in memory, as returned by memory_stats(). payload
+// is the bytes of the elements themselves; overhead is everything else the
+// container holds: the container object, node links and balance fields,
+// sentinels, padding, unused capacity and any index such as a filter.
+// Elements are counted by sizeof only, so memory they own in turn (the
+// characters of a std::string, say) is not included. Every container works
+// these out in O(1) from counters it already keeps.
+struct MemoryStats {
+  std::size_t payload = 0;
+  std::size_t overhead = 0;
+  std::size_t allocations = 0;  // heap blocks currently held
+
+  std::size_t total() const { return payload + overhead; }
+  MemoryStats& operator+=(const MemoryStats& other) {
+    payload += other.payload;
+    overhead += other.overhead;
+    allocations += other.allocations;
+    return *this;
+  }
+};
+
+namespace memory {
+
+// The payload of one element of a tree or table: the key and, unless it
+// backs a set (Value is std::nullptr_t), the value.
+template <typename Key, typename Value>
+constexpr std::size_t element_bytes() {
+  if constexpr (std::is_same_v<Value, std::nullptr_t>) {
+    return sizeof(Key);
+  } else {
+    return sizeof(Key) + sizeof(Value);
+  }
+}
+
+// Stats for n elements of element bytes each inside a container whose
+// object and heap blocks take bytes in all.
+inline MemoryStats split(std::size_t bytes, std::size_t n,
+                         std::size_t element, std::size_t allocations) {
+  MemoryStats stats;
+  stats.payload = n * element;
+  stats.overhead = bytes - stats.payload;
+  stats.allocations = allocations;
+  return stats;
+}
+
+// The heap side of a member container: its stats less the member object,
+// which the sizeof of the owner already covers.
+template <typename Member>
+MemoryStats held_by(const Member& member) {
+  MemoryStats stats = member.memory_stats();
+  stats.overhead -= sizeof(Member);
+  return stats;
+}
+
+}  // namespace memory
+}  // namespace s21
+
+#endif  // SRC_S21_CONTAINERS_S21_MEMORY_STATS_H_
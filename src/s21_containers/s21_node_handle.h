@@ -0,0 +1,48 @@
+#ifndef SRC_S21_CONTAINERS_S21_NODE_HANDLE_H_
+#define SRC_S21_CONTAINERS_S21_NODE_HANDLE_H_
+
+#include <optional>
+#include <utility>
+
+namespace s21 {
+
+template <typename Key, typename Value, typename Compare>
+class ArenaAVLTree;
+template <typename Key, typename Value, typename Compare>
+class BPlusTree;
+template <typename Key, typename Value, typename Compare>
+class FlatTree;
+
+// Node handle of the backends that keep their elements inside shared blocks
+// (arena slots, B+-tree leaves, sorted arrays) and so have no node of their
+// own to give away. extract moves the element into the handle and insert
+// moves it back: nothing is allocated or copied, but the element is moved
+// twice. The accessors match AVLTree::NodeHandle.
+template <typename Key, typename Value>
+class ValueHandle {
+ public:
+  ValueHandle() = default;
+  ValueHandle(ValueHandle&& other) noexcept = default;
+  ValueHandle& operator=(ValueHandle&& other) noexcept = default;
+  bool empty() const { return !data; }
+  explicit operator bool() const { return data.has_value(); }
+  Key& key() { return data->first; }
+  Value& mapped() { return data->second; }
+  Key& value() { return data->first; }
+  void swap(ValueHandle& other) { data.swap(other.data); }
+
+ private:
+  explicit ValueHandle(std::pair<Key, Value>&& taken)
+      : data(std::move(taken)) {}
+  std::optional<std::pair<Key, Value>> data;
+  template <typename, typename, typename>
+  friend class ArenaAVLTree;
+  template <typename, typename, typename>
+  friend class BPlusTree;
+  template <typename, typename, typename>
+  friend class FlatTree;
+};
+
+}  // namespace s21
+
+#endif  // SRC_S21_CONTAINERS_S21_NODE_HANDLE_H_
@@ -1,24 +1,46 @@
 #ifndef SRC_S21_CONTAINERS_S21_QUEUE_H_
 #define SRC_S21_CONTAINERS_S21_QUEUE_H_
 
-#include "s21_vector.h"
+#include <type_traits>
+#include <utility>
+
+#include "s21_circular_buffer.h"
+#include "s21_deque.h"
+#include "s21_list.h"
 
 namespace s21 {
 
-template <typename T>
+// FIFO adaptor over Container, which needs front, back, push_back,
+// pop_front, empty, size and swap; emplace also needs emplace_back. With
+// the default circular_buffer push, pop, front and back are all O(1) and
+// draining the queue never shifts the elements that are left; it grows by
+// doubling and moving them. s21::deque grows a block at a time and never
+// moves an element, and s21::list allocates per element.
+template <typename T, typename Container = circular_buffer<T>>
 class queue {
  private:
-  vector<T> data_;
+  Container data_;
+
+  // whether push_many can reserve room up front
+  template <typename C, typename = void>
+  struct has_reserve : std::false_type {};
+  template <typename C>
+  struct has_reserve<
+      C, std::void_t<decltype(std::declval<C &>().reserve(size_t()))>>
+      : std::true_type {};
 
  public:
-  using value_type = typename vector<T>::value_type;
-  using reference = typename vector<T>::reference;
-  using const_reference = typename vector<T>::const_reference;
-  using size_type = typename vector<T>::size_type;
+  using container_type = Container;
+  using value_type = typename Container::value_type;
+  using reference = typename Container::reference;
+  using const_reference = typename Container::const_reference;
+  using size_type = typename Container::size_type;
 
   // constructors
   queue() = default;
   queue(std::initializer_list<T> const &items) : data_(items) {}
+  explicit queue(const Container &c) : data_(c) {}
+  explicit queue(Container &&c) : data_(std::move(c)) {}
   queue(const queue &q) : data_(q.data_) {}
   queue(queue &&q) : data_(std::move(q.data_)) {}
 
@@ -35,10 +57,24 @@ class queue {
   // Capacity
   bool empty() const;
   size_type size() const;
+  MemoryStats memory_stats() const { return data_.memory_stats(); }
+  size_type memory_usage() const { return data_.memory_usage(); }
 
   // Modifiers
   void push(const_reference value);
+  void push(value_type &&value);
+  // builds the element from args in place at the back
+  template <typename... Args>
+  void emplace(Args &&...args);
+  // pushes the range in order; a container with reserve grows at most
+  // once when the iterators can be walked twice
+  template <typename InputIt>
+  void push_many(InputIt first, InputIt last);
   void pop();
+  // moves up to max elements from the front into out, oldest first;
+  // returns the end of out
+  template <typename OutputIt>
+  OutputIt pop_many(OutputIt out, size_type max);
   void swap(queue &other);
 
   // part 3
@@ -50,4 +86,4 @@ class queue {
 
 #include "s21_queue.tpp"
 
-#endif  // SRC_S21_CONTAINERS_S21_QUEUE_H_
\ No newline at end of file
+#endif  // SRC_S21_CONTAINERS_S21_QUEUE_H_
@@ -1,13 +1,16 @@
 #ifndef SRC_S21_CONTAINERS_S21_QUEUE_TPP_
 #define SRC_S21_CONTAINERS_S21_QUEUE_TPP_
 
+#include <iterator>
+#include <type_traits>
+
 #include "s21_queue.h"
 
 namespace s21 {
 
 // assignment
-template <typename T>
-queue<T>& queue<T>::operator=(queue&& q) {
+template <typename T, typename Container>
+queue<T, Container>& queue<T, Container>::operator=(queue&& q) {
   if (this != &q) {
     data_ = std::move(q.data_);
   }
@@ -15,16 +18,18 @@ queue<T>& queue<T>::operator=(queue&& q) {
 }
 
 // Element access
-template <typename T>
-typename queue<T>::const_reference queue<T>::front() const {
+template <typename T, typename Container>
+typename queue<T, Container>::const_reference queue<T, Container>::front()
+    const {
   if (empty()) {
     throw std::out_of_range("Front on empty queue");
   }
   return data_.front();
 }
 
-template <typename T>
-typename queue<T>::const_reference queue<T>::back() const {
+template <typename T, typename Container>
+typename queue<T, Container>::const_reference queue<T, Container>::back()
+    const {
   if (empty()) {
     throw std::out_of_range("Back on empty queue");
   }
@@ -32,40 +37,72 @@ typename queue<T>::const_reference queue<T>::back() const {
 }
 
 // Capacity
-template <typename T>
-bool queue<T>::empty() const {
+template <typename T, typename Container>
+bool queue<T, Container>::empty() const {
   return data_.empty();
 }
 
-template <typename T>
-typename queue<T>::size_type queue<T>::size() const {
+template <typename T, typename Container>
+typename queue<T, Container>::size_type queue<T, Container>::size() const {
   return data_.size();
 }
 
 // Modifiers
-template <typename T>
-void queue<T>::push(const_reference value) {
+template <typename T, typename Container>
+void queue<T, Container>::push(const_reference value) {
   data_.push_back(value);
 }
 
-template <typename T>
-void queue<T>::pop() {
+template <typename T, typename Container>
+void queue<T, Container>::push(value_type&& value) {
+  data_.push_back(std::move(value));
+}
+
+template <typename T, typename Container>
+template <typename... Args>
+void queue<T, Container>::emplace(Args&&... args) {
+  data_.emplace_back(std::forward<Args>(args)...);
+}
+
+template <typename T, typename Container>
+template <typename InputIt>
+void queue<T, Container>::push_many(InputIt first, InputIt last) {
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag, category> &&
+                has_reserve<Container>::value) {
+    data_.reserve(data_.size() + std::distance(first, last));
+  }
+  for (; first != last; ++first) data_.push_back(*first);
+}
+
+template <typename T, typename Container>
+void queue<T, Container>::pop() {
   if (empty()) {
     throw std::out_of_range("Pop on empty queue");
   }
-  data_.erase(data_.begin());
+  data_.pop_front();
+}
+
+template <typename T, typename Container>
+template <typename OutputIt>
+OutputIt queue<T, Container>::pop_many(OutputIt out, size_type max) {
+  for (; max > 0 && !data_.empty(); --max) {
+    *out++ = std::move(data_.front());
+    data_.pop_front();
+  }
+  return out;
 }
 
-template <typename T>
-void queue<T>::swap(queue& other) {
+template <typename T, typename Container>
+void queue<T, Container>::swap(queue& other) {
   data_.swap(other.data_);
 }
 
 // part 3
-template <typename T>
+template <typename T, typename Container>
 template <typename... Args>
-void queue<T>::insert_many_back(Args&&... args) {
-  data_.insert_many_back(args...);
+void queue<T, Container>::insert_many_back(Args&&... args) {
+  data_.insert_many_back(std::forward<Args>(args)...);
 }
 
 }  // namespace s21
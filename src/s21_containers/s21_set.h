@@ -1,59 +1,99 @@
 #ifndef SRC_S21_CONSTAINERS_S21_SET_H_
 #define SRC_S21_CONSTAINERS_S21_SET_H_
 
+#include "s21_arena_avltree.h"
 #include "s21_avltree.h"
+#include "s21_bloom_tree.h"
+#include "s21_btree.h"
 
 namespace s21 {
 
-template <typename Key>
+// Tree selects the backing store: AVLTree (the default), ArenaAVLTree,
+// BPlusTree or FlatTree, optionally behind a BloomTree filter.
+template <typename Key, typename Compare = std::less<Key>,
+          template <typename, typename, typename> class Tree = AVLTree>
 class set {
  private:
-  AVLTree<Key, std::nullptr_t> tree;
+  using tree_type = Tree<Key, std::nullptr_t, Compare>;
+  tree_type tree;
 
  public:
   class Iterator;
   class ConstIterator;
   using key_type = Key;
   using value_type = Key;
+  using key_compare = Compare;
+  using value_compare = Compare;
   using reference = value_type&;
   using const_reference = const value_type&;
   using iterator = Iterator;
   using const_iterator = ConstIterator;  // make
-  using size_type = typename AVLTree<Key, std::nullptr_t>::size_type;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+  using size_type = typename tree_type::size_type;
+  using node_type = typename tree_type::node_type;
 
   class Iterator {
    public:
-    explicit Iterator(typename AVLTree<Key, std::nullptr_t>::Iterator it)
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = Key;
+    using pointer = const Key*;
+    using reference = const Key&;
+    explicit Iterator(typename tree_type::Iterator it)
         : it_(it) {}
     Iterator() = default;
     Iterator& operator++() {
       ++it_;
       return *this;
     }
+    Iterator operator++(int) { return Iterator(it_++); }
+    Iterator& operator--() {
+      --it_;
+      return *this;
+    }
+    Iterator operator--(int) { return Iterator(it_--); }
     bool operator!=(const Iterator& other) const { return it_ != other.it_; }
     bool operator==(const Iterator& other) const { return it_ == other.it_; }
-    const value_type operator*() const { return (*it_).first; }
+    const_reference operator*() const { return (*it_).first; }
 
    protected:
-    typename AVLTree<Key, std::nullptr_t>::Iterator it_;
+    typename tree_type::Iterator it_;
     friend class set;
+    template <typename, typename, template <typename, typename, typename> class>
+    friend class multiset;
   };
 
   class ConstIterator : public Iterator {
    public:
     using Iterator::Iterator;
     ConstIterator()
-        : Iterator(typename AVLTree<Key, std::nullptr_t>::ConstIterator()) {}
+        : Iterator(typename tree_type::ConstIterator()) {}
     const_reference operator*() const { return Iterator::operator*(); };
     ConstIterator& operator++() {
       Iterator::operator++();
       return *this;
     }
+    ConstIterator& operator--() {
+      Iterator::operator--();
+      return *this;
+    }
+  };
+
+  // what insert(node_type&&) returns: node is empty unless the key was
+  // already taken, in which case it hands the element back
+  struct insert_return_type {
+    iterator position;
+    bool inserted;
+    node_type node;
   };
 
   // constructors
   set() = default;
+  explicit set(const Compare& comp) : tree(comp) {}
   set(std::initializer_list<Key> const& items);
+  template <typename InputIt>
+  set(InputIt first, InputIt last, const Compare& comp = Compare());
   set(const set& s) : tree(s.tree) {}
   set(set&& s) : tree(std::move(s.tree)) {}
 
@@ -68,22 +108,104 @@ class set {
   iterator end() { return Iterator(tree.end()); }
   const_iterator cbegin() { return ConstIterator(tree.cbegin()); }
   const_iterator cend() { return ConstIterator(tree.cend()); }
+  reverse_iterator rbegin() { return reverse_iterator(end()); }
+  reverse_iterator rend() { return reverse_iterator(begin()); }
+  const_reverse_iterator crbegin() { return const_reverse_iterator(cend()); }
+  const_reverse_iterator crend() { return const_reverse_iterator(cbegin()); }
+
+  // element access, O(1): the smallest and the largest key
+  const_reference front() { return *begin(); }
+  const_reference back() { return *--end(); }
 
   // Capacity
   bool empty() const { return tree.empty(); }
   size_type size() const { return tree.size(); }
   size_type max_size() const { return tree.max_size(); }
+  MemoryStats memory_stats() const { return tree.memory_stats(); }
+  size_type memory_usage() const { return tree.memory_usage(); }
+  // ArenaAVLTree and FlatTree only: preallocates room for n elements;
+  // BloomTree sizes its filter for n keys
+  void reserve(size_type n) { tree.reserve(n); }
+  // BloomTree only: the estimated chance that looking up a missing key
+  // still searches the tree
+  double false_positive_rate() const { return tree.false_positive_rate(); }
 
   // Modifiers
   void clear() { tree.clear(); }
   std::pair<iterator, bool> insert(const value_type& value);
-  void erase(iterator pos) { tree.erase(tree.find(*pos)); }
+  std::pair<iterator, bool> insert(value_type&& value);
+  iterator insert(iterator hint, const value_type& value);
+  iterator insert(iterator hint, value_type&& value);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  template <typename... Args>
+  iterator emplace_hint(iterator hint, Args&&... args);
+  void erase(iterator pos) { tree.erase(pos.it_); }
+  iterator erase(iterator first, iterator last) {
+    return Iterator(tree.erase(first.it_, last.it_));
+  }
+  // node handles move elements between sets without copying them; with
+  // the default AVLTree backend they do not allocate either
+  node_type extract(iterator pos) { return tree.extract(pos.it_); }
+  node_type extract(const key_type& key) {
+    return tree.extract(tree.find(key));
+  }
+  insert_return_type insert(node_type&& node);
   void swap(set& other) { tree.swap(other.tree); }
   void merge(set& other) { tree.merge(other.tree, false); }
+  // split keeps the keys less than key and returns the rest; join takes
+  // every element of other, whose keys must all sort before or all after
+  // ours, and throws std::invalid_argument if they overlap. On AVLTree
+  // both only relink O(log n) nodes.
+  set split(const key_type& key);
+  void join(set& other);
+  template <typename ForwardIt>
+  void assign_sorted(ForwardIt first, ForwardIt last);
+  // the range constructor for large unsorted input: the keys are sorted on
+  // up to threads threads (0: one per hardware thread) before the tree is
+  // built bottom-up; keep picks which of several equivalent keys stays
+  template <typename InputIt>
+  void assign_parallel(InputIt first, InputIt last,
+                       bulk::Keep keep = bulk::Keep::kFirst,
+                       unsigned threads = 0);
 
   // Lookup
   iterator find(const key_type& key) { return Iterator(tree.find(key)); }
   bool contains(const key_type& key) { return tree.contains(key); }
+  // heterogeneous lookup, only with a transparent Compare such as
+  // std::less<>
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K& key) {
+    return Iterator(tree.find(key));
+  }
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K& key) {
+    return tree.contains(key);
+  }
+  // find and contains for every key of [first, last), written to out in
+  // order; the lookups run in interleaved batches that overlap their cache
+  // misses, which pays off for many keys in a tree larger than the cache
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out) {
+    tree.find_many(first, last, [&out](typename tree_type::Iterator it) {
+      *out++ = Iterator(it);
+    });
+    return out;
+  }
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt contains_many(ForwardIt first, ForwardIt last, OutputIt out) {
+    typename tree_type::Iterator none = tree.end();
+    tree.find_many(first, last, [&out, none](typename tree_type::Iterator it) {
+      *out++ = it != none;
+    });
+    return out;
+  }
+
+  // Observers
+  key_compare key_comp() const { return tree.key_comp(); }
+  value_compare value_comp() const { return tree.key_comp(); }
 
   // part 3
   template <typename... Args>
@@ -5,32 +5,129 @@
 
 namespace s21 {
 
-template <typename Key>
-set<Key>::set(std::initializer_list<Key> const& items) {
-  for (const auto& item : items) {
-    tree.insert(std::make_pair(item, nullptr), false);
-  }
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+set<Key, Compare, Tree>::set(std::initializer_list<Key> const& items) {
+  tree.assign(items.begin(), items.end(), false);
+}
+
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+template <typename InputIt>
+set<Key, Compare, Tree>::set(InputIt first, InputIt last,
+                             const Compare& comp)
+    : tree(comp) {
+  tree.assign(first, last, false);
 }
 
-template <typename Key>
-set<Key>& set<Key>::operator=(set&& s) noexcept {
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+set<Key, Compare, Tree>& set<Key, Compare, Tree>::operator=(set&& s) noexcept {
   if (this != &s) {
-    tree = s.tree;
+    tree = std::move(s.tree);
   }
   return *this;
 }
 
-template <typename Key>
-std::pair<typename set<Key>::iterator, bool> set<Key>::insert(
-    const value_type& value) {
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+template <typename ForwardIt>
+void set<Key, Compare, Tree>::assign_sorted(ForwardIt first, ForwardIt last) {
+  tree.assign_sorted(first, last, false);
+}
+
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+template <typename InputIt>
+void set<Key, Compare, Tree>::assign_parallel(InputIt first, InputIt last,
+                                              bulk::Keep keep,
+                                              unsigned threads) {
+  tree.assign_parallel(first, last, false, keep, threads);
+}
+
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+std::pair<typename set<Key, Compare, Tree>::iterator, bool>
+set<Key, Compare, Tree>::insert(const value_type& value) {
   auto iter = tree.insert(std::make_pair(value, nullptr), false);
   return std::make_pair(Iterator(iter.first), iter.second);
 }
 
-template <typename Key>
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+std::pair<typename set<Key, Compare, Tree>::iterator, bool>
+set<Key, Compare, Tree>::insert(value_type&& value) {
+  auto iter = tree.insert(std::make_pair(std::move(value), nullptr), false);
+  return std::make_pair(Iterator(iter.first), iter.second);
+}
+
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+typename set<Key, Compare, Tree>::iterator set<Key, Compare, Tree>::insert(
+    iterator hint, const value_type& value) {
+  return Iterator(
+      tree.insert(hint.it_, std::make_pair(value, nullptr), false).first);
+}
+
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+typename set<Key, Compare, Tree>::iterator set<Key, Compare, Tree>::insert(
+    iterator hint, value_type&& value) {
+  return Iterator(
+      tree.insert(hint.it_, std::make_pair(std::move(value), nullptr), false)
+          .first);
+}
+
+// The key is built straight into the new node.
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+template <typename... Args>
+std::pair<typename set<Key, Compare, Tree>::iterator, bool>
+set<Key, Compare, Tree>::emplace(Args&&... args) {
+  auto iter = tree.emplace(
+      false, std::piecewise_construct,
+      std::forward_as_tuple(std::forward<Args>(args)...), std::tuple<>());
+  return std::make_pair(Iterator(iter.first), iter.second);
+}
+
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+template <typename... Args>
+typename set<Key, Compare, Tree>::iterator
+set<Key, Compare, Tree>::emplace_hint(iterator hint, Args&&... args) {
+  return insert(hint, value_type(std::forward<Args>(args)...));
+}
+
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+typename set<Key, Compare, Tree>::insert_return_type
+set<Key, Compare, Tree>::insert(node_type&& node) {
+  auto iter = tree.insert(node, false);
+  return insert_return_type{Iterator(iter.first), iter.second,
+                            std::move(node)};
+}
+
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+set<Key, Compare, Tree> set<Key, Compare, Tree>::split(const key_type& key) {
+  set tail(key_comp());
+  tail.tree = tree.split(tree.lower_bound(key));
+  return tail;
+}
+
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+void set<Key, Compare, Tree>::join(set& other) {
+  if (!tree.join(other.tree, false)) {
+    throw std::invalid_argument("join: key ranges overlap");
+  }
+}
+
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
 template <typename... Args>
-vector<std::pair<typename set<Key>::iterator, bool>> set<Key>::insert_many(
-    Args&&... args) {
+vector<std::pair<typename set<Key, Compare, Tree>::iterator, bool>>
+set<Key, Compare, Tree>::insert_many(Args&&... args) {
   vector<std::pair<iterator, bool>> result;
   (result.push_back(insert(std::forward<Args>(args))), ...);
   return result;
@@ -1,24 +1,35 @@
 #ifndef SRC_S21_CONTAINERS_S21_STACK_H_
 #define SRC_S21_CONTAINERS_S21_STACK_H_
 
+#include "s21_deque.h"
+#include "s21_list.h"
 #include "s21_vector.h"
 
 namespace s21 {
 
-template <typename T>
+// LIFO adaptor over Container, which needs back, push_back, pop_back,
+// insert, begin and end (with a decrementable iterator), empty, size and
+// swap, as s21::vector, s21::deque and s21::list provide. vector keeps the
+// elements contiguous and grows by doubling, moving them each time; deque
+// grows a block at a time and list a node at a time, and neither moves an
+// element once it is pushed.
+template <typename T, typename Container = vector<T>>
 class stack {
  private:
-  vector<T> data_;
+  Container data_;
 
  public:
-  using value_type = typename vector<T>::value_type;
-  using reference = typename vector<T>::reference;
-  using const_reference = typename vector<T>::const_reference;
-  using size_type = typename vector<T>::size_type;
+  using container_type = Container;
+  using value_type = typename Container::value_type;
+  using reference = typename Container::reference;
+  using const_reference = typename Container::const_reference;
+  using size_type = typename Container::size_type;
 
   // constructors
   stack() = default;
   stack(std::initializer_list<T> const &items) : data_(items) {}
+  explicit stack(const Container &c) : data_(c) {}
+  explicit stack(Container &&c) : data_(std::move(c)) {}
   stack(const stack &s) : data_(s.data_) {}
   stack(stack &&s) : data_(std::move(s.data_)) {}
 
@@ -34,10 +45,18 @@ class stack {
   // Stack Capacity
   bool empty() const;
   size_type size() const;
+  MemoryStats memory_stats() const { return data_.memory_stats(); }
+  size_type memory_usage() const { return data_.memory_usage(); }
 
   // Stack Modifiers
   void push(const_reference value);
+  void push(value_type &&value);
+  // builds the element from args and moves it onto the stack
+  template <typename... Args>
+  void emplace(Args &&...args);
   void pop();
+  // removes the top element and returns it, moved rather than copied
+  value_type pop_value();
   void swap(stack &other);
 
   // part 3
@@ -49,4 +68,4 @@ class stack {
 
 #include "s21_stack.tpp"
 
-#endif  // SRC_S21_CONTAINERS_S21_STACK_H_
\ No newline at end of file
+#endif  // SRC_S21_CONTAINERS_S21_STACK_H_
@@ -6,8 +6,8 @@
 namespace s21 {
 
 // assignment
-template <typename T>
-stack<T>& stack<T>::operator=(stack&& s) {
+template <typename T, typename Container>
+stack<T, Container>& stack<T, Container>::operator=(stack&& s) {
   if (this != &s) {
     data_ = std::move(s.data_);
   }
@@ -15,49 +15,73 @@ stack<T>& stack<T>::operator=(stack&& s) {
 }
 
 // Stack Element access
-template <typename T>
-typename stack<T>::const_reference stack<T>::top() const {
+template <typename T, typename Container>
+typename stack<T, Container>::const_reference stack<T, Container>::top()
+    const {
   return data_.back();
 }
 
 // Stack Capacity
-template <typename T>
-bool stack<T>::empty() const {
+template <typename T, typename Container>
+bool stack<T, Container>::empty() const {
   return data_.empty();
 }
 
-template <typename T>
-typename stack<T>::size_type stack<T>::size() const {
+template <typename T, typename Container>
+typename stack<T, Container>::size_type stack<T, Container>::size() const {
   return data_.size();
 }
 
 // Stack Modifiers
-template <typename T>
-void stack<T>::push(const_reference value) {
+template <typename T, typename Container>
+void stack<T, Container>::push(const_reference value) {
   data_.push_back(value);
 }
 
-template <typename T>
-void stack<T>::pop() {
+template <typename T, typename Container>
+void stack<T, Container>::push(value_type&& value) {
+  data_.push_back(std::move(value));
+}
+
+template <typename T, typename Container>
+template <typename... Args>
+void stack<T, Container>::emplace(Args&&... args) {
+  data_.push_back(value_type(std::forward<Args>(args)...));
+}
+
+template <typename T, typename Container>
+void stack<T, Container>::pop() {
+  if (empty()) {
+    throw std::out_of_range("Pop on empty stack");
+  }
+  data_.pop_back();
+}
+
+template <typename T, typename Container>
+typename stack<T, Container>::value_type stack<T, Container>::pop_value() {
   if (empty()) {
     throw std::out_of_range("Pop on empty stack");
   }
+  auto last = data_.end();
+  --last;
+  value_type value = std::move(*last);
   data_.pop_back();
+  return value;
 }
 
-template <typename T>
-void stack<T>::swap(stack& other) {
+template <typename T, typename Container>
+void stack<T, Container>::swap(stack& other) {
   data_.swap(other.data_);
 }
 
 // part 3
-template <typename T>
+template <typename T, typename Container>
 template <typename... Args>
-void stack<T>::insert_many_front(Args&&... args) {
-  size_type pos = 0;
-  (data_.insert(data_.begin() + pos++, std::forward<Args>(args)), ...);
+void stack<T, Container>::insert_many_front(Args&&... args) {
+  auto pos = data_.begin();
+  ((pos = data_.insert(pos, std::forward<Args>(args)), ++pos), ...);
 }
 
 }  // namespace s21
 
-#endif  // SRC_S21_CONTAINERS_S21_STACK_TPP_
\ No newline at end of file
+#endif  // SRC_S21_CONTAINERS_S21_STACK_TPP_
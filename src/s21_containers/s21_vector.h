@@ -8,6 +8,9 @@
 #include <stdexcept>
 #include <utility>
 
+#include "s21_instrument.h"
+#include "s21_memory_stats.h"
+
 namespace s21 {
 
 template <typename T>
@@ -29,6 +32,7 @@ class vector {
 
   // private method
  private:
+  using hooks = instrument::Hooks<instrument::family::vector>;
   void reserve_more_capacity(size_type size);
 
   // public methods
@@ -39,22 +43,29 @@ class vector {
   // parametrized constructor for fixed size vector (explicit was used in order
   // to avoid automatic type conversion)
   explicit vector(size_type n)
-      : size_(n), capacity_(n), arr_(n ? new T[n]{} : nullptr) {}
+      : size_(n), capacity_(n), arr_(n ? new T[n]{} : nullptr) {
+    if (arr_) hooks::allocated();
+  }
   // initializer list constructor (allows creating lists with initializer lists,
   // see main.cpp)
   vector(std::initializer_list<value_type> const &items);
   // copy constructor with simplified syntax
   vector(const vector &v) : size_(v.size_), capacity_(v.capacity_) {
     arr_ = new value_type[v.capacity_];
+    hooks::allocated();
     std::copy(v.arr_, v.arr_ + v.size_, arr_);
   }
   // move constructor with simplified syntax
   vector(vector &&v) : size_(v.size_), capacity_(v.capacity_), arr_(v.arr_) {
     v.arr_ = nullptr;
     v.size_ = 0;
+    v.capacity_ = 0;
   }
   // destructor
-  ~vector() { delete[] arr_; }
+  ~vector() {
+    if (arr_) hooks::deallocated();
+    delete[] arr_;
+  }
 
   // assignment
   vector &operator=(vector &&v);
@@ -79,12 +90,16 @@ class vector {
   void reserve(size_type size);
   size_type capacity() const;
   void shrink_to_fit();
+  MemoryStats memory_stats() const;
+  size_type memory_usage() const { return memory_stats().total(); }
 
   // modifiers
   void clear();
   iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, value_type &&value);
   void erase(iterator pos);
   void push_back(const_reference value);
+  void push_back(value_type &&value);
   void pop_back();
   void swap(vector &other);
 
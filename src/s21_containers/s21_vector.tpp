@@ -11,6 +11,12 @@ void vector<T>::reserve_more_capacity(size_type size) {
   if (size > capacity_) {
     value_type *buff = new value_type[size];
     for (size_t i = 0; i < size_; ++i) buff[i] = std::move(arr_[i]);
+    hooks::allocated();
+    if (arr_) {
+      hooks::reallocated();
+      hooks::deallocated();
+    }
+    hooks::moved(size_);
     delete[] arr_;
     arr_ = buff;
     capacity_ = size;
@@ -21,6 +27,7 @@ void vector<T>::reserve_more_capacity(size_type size) {
 template <typename T>
 inline vector<T>::vector(std::initializer_list<value_type> const &items) {
   arr_ = new value_type[items.size()];
+  hooks::allocated();
   int i = 0;
   for (auto it = items.begin(); it != items.end(); it++) {
     arr_[i] = *it;
@@ -34,6 +41,7 @@ inline vector<T>::vector(std::initializer_list<value_type> const &items) {
 template <typename T>
 vector<T> &vector<T>::operator=(vector &&v) {
   if (this != &v) {
+    if (arr_) hooks::deallocated();
     delete[] arr_;
     size_ = v.size_;
     capacity_ = v.capacity_;
@@ -132,11 +140,23 @@ typename vector<T>::size_type vector<T>::capacity() const {
   return capacity_;
 }
 
+// Unused capacity counts as overhead.
+template <typename T>
+MemoryStats vector<T>::memory_stats() const {
+  size_type held = arr_ ? capacity_ : 0;
+  return memory::split(sizeof(*this) + held * sizeof(T), size_, sizeof(T),
+                       arr_ ? 1 : 0);
+}
+
 template <typename T>
 void vector<T>::shrink_to_fit() {
   if (size_ < capacity_) {
     value_type *buff = new value_type[size_];
     for (size_t i = 0; i < size_; ++i) buff[i] = std::move(arr_[i]);
+    hooks::allocated();
+    hooks::reallocated();
+    hooks::deallocated();
+    hooks::moved(size_);
     delete[] arr_;
     arr_ = buff;
     capacity_ = size_;
@@ -146,6 +166,7 @@ void vector<T>::shrink_to_fit() {
 // modifiers
 template <typename T>
 void vector<T>::clear() {
+  if (arr_) hooks::deallocated();
   delete[] arr_;
   arr_ = nullptr;
   size_ = 0;
@@ -165,11 +186,31 @@ typename vector<T>::iterator vector<T>::insert(iterator pos,
   for (size_type i = size_; i > index; --i) {
     arr_[i] = std::move(arr_[i - 1]);
   }
+  hooks::moved(size_ - index);
   arr_[index] = value;
   ++size_;
   return arr_ + index;
 }
 
+template <typename T>
+typename vector<T>::iterator vector<T>::insert(iterator pos,
+                                               value_type &&value) {
+  size_type index = pos - arr_;
+  if (index > size_) {
+    throw std::out_of_range("Invalid insertion position");
+  }
+  if (size_ == capacity_) {
+    reserve_more_capacity(capacity_ == 0 ? 1 : capacity_ * 2);
+  }
+  for (size_type i = size_; i > index; --i) {
+    arr_[i] = std::move(arr_[i - 1]);
+  }
+  hooks::moved(size_ - index);
+  arr_[index] = std::move(value);
+  ++size_;
+  return arr_ + index;
+}
+
 template <typename T>
 void vector<T>::erase(iterator pos) {
   size_type index = pos - arr_;
@@ -179,6 +220,7 @@ void vector<T>::erase(iterator pos) {
   for (size_type i = index; i < size_ - 1; i++) {
     arr_[i] = std::move(arr_[i + 1]);
   }
+  hooks::moved(size_ - 1 - index);
   --size_;
 }
 
@@ -190,6 +232,14 @@ void vector<T>::push_back(const_reference value) {
   arr_[size_++] = value;
 }
 
+template <typename T>
+void vector<T>::push_back(value_type &&value) {
+  if (size_ == capacity_) {
+    reserve_more_capacity(capacity_ == 0 ? 1 : capacity_ * 2);
+  }
+  arr_[size_++] = std::move(value);
+}
+
 template <typename T>
 void vector<T>::pop_back() {
   if (size_ > 0) {
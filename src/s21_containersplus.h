@@ -2,6 +2,17 @@
 #define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_H_
 
 #include "s21_containersplus/s21_array.h"
+#include "s21_containersplus/s21_concurrent_stack.h"
+#include "s21_containersplus/s21_flat_map.h"
+#include "s21_containersplus/s21_flat_set.h"
+#include "s21_containersplus/s21_indexed_priority_queue.h"
+#include "s21_containersplus/s21_mpmc_queue.h"
 #include "s21_containersplus/s21_multiset.h"
+#include "s21_containersplus/s21_priority_queue.h"
+#include "s21_containersplus/s21_spsc_queue.h"
+#include "s21_containersplus/s21_static_map.h"
+#include "s21_containersplus/s21_static_set.h"
+#include "s21_containersplus/s21_unordered_map.h"
+#include "s21_containersplus/s21_unordered_set.h"
 
 #endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_H_
\ No newline at end of file
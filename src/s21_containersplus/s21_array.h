@@ -3,6 +3,8 @@
 
 //#include <cstdlib>
 
+#include "../s21_containers/s21_memory_stats.h"
+
 namespace s21 {
 template <class T, std::size_t N>
 class array {
@@ -45,6 +47,8 @@ class array {
   constexpr bool empty() const noexcept;
   constexpr size_type size() const noexcept;
   constexpr size_type max_size() const noexcept;
+  MemoryStats memory_stats() const;
+  size_type memory_usage() const { return memory_stats().total(); }
 
   // operations
   void fill(const_reference value);
@@ -140,6 +140,11 @@ constexpr typename array<T, N>::size_type array<T, N>::max_size()
   return capacity;
 }
 
+template <typename T, std::size_t N>
+MemoryStats array<T, N>::memory_stats() const {
+  return memory::split(sizeof(*this), N, sizeof(T), 0);
+}
+
 // operations
 
 template <typename T, std::size_t N>
@@ -0,0 +1,106 @@
+#ifndef SRC_S21_CONTAINERSPLUS_S21_CONCURRENT_STACK_H_
+#define SRC_S21_CONTAINERSPLUS_S21_CONCURRENT_STACK_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <utility>
+
+#include "../s21_containers/s21_hazard.h"
+
+namespace s21 {
+
+// Lock-free LIFO stack for any number of threads (a Treiber stack). push
+// and try_pop each swing the head pointer with one compare-and-swap.
+// Popped nodes go to the hazard pointer domain, which frees them once no
+// thread can still be reading them; that also keeps the compare-and-swap
+// free of ABA.
+//
+// Under contention a failed compare-and-swap sends the thread to a small
+// elimination array first: a push parks its node in a random slot for a
+// short while, and a pop that finds a parked node takes it without
+// touching the head at all. A push and a pop that meet there cancel out,
+// which is a valid order for a stack. A pop marks the slot taken rather
+// than emptying it, so the parker cannot mistake a new node at a reused
+// address for its own.
+//
+// There is no size(); under concurrency any count is stale on return.
+// Constructing and destroying the stack must not overlap with other calls.
+template <typename T>
+class concurrent_stack {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = std::size_t;
+
+  // constructors
+  concurrent_stack() = default;
+  concurrent_stack(std::initializer_list<value_type> const& items);
+  concurrent_stack(const concurrent_stack&) = delete;
+  concurrent_stack& operator=(const concurrent_stack&) = delete;
+
+  // destructor
+  ~concurrent_stack();
+
+  // capacity
+  bool empty() const;
+
+  // modifiers
+  void push(const_reference value);
+  void push(value_type&& value);
+  template <typename... Args>
+  void emplace(Args&&... args);
+  // pushes the range with a single compare-and-swap; the last element ends
+  // up on top, as if pushed one by one
+  template <typename InputIt>
+  void push_many(InputIt first, InputIt last);
+  // moves the top element into value; false if the stack was empty
+  bool try_pop(reference value);
+  // pops up to max elements into out, top first; returns the end of out
+  template <typename OutputIt>
+  OutputIt pop_many(OutputIt out, size_type max);
+  // empties the stack with one exchange and writes what it held into out,
+  // top first
+  template <typename OutputIt>
+  OutputIt pop_all(OutputIt out);
+
+ private:
+  static constexpr size_t kCacheLine = 64;
+  static constexpr size_t kSlots = 8;
+  static constexpr unsigned kParkSpins = 256;
+
+  struct Node {
+    template <typename... Args>
+    explicit Node(Args&&... args) : value(std::forward<Args>(args)...) {}
+    value_type value;
+    Node* next = nullptr;
+  };
+  // A slot holds 0, a parked node, or that node with kTaken set once a pop
+  // has taken it. Only the parker clears a taken slot, so the slot cannot
+  // be reused, and a freed node's address come back, while the parker
+  // still looks at it.
+  static constexpr std::uintptr_t kTaken = 1;
+  struct alignas(kCacheLine) Slot {
+    std::atomic<std::uintptr_t> node{0};
+  };
+
+  alignas(kCacheLine) std::atomic<Node*> head{nullptr};
+  Slot slots[kSlots];
+
+  // helper methods
+  void push_chain(Node* first, Node* last);
+  Node* pop_node(bool* parked);
+  void release(Node* node, bool parked);
+  bool park(Node* node);
+  Node* take_parked();
+  static size_t random_slot();
+  static void destroy(void* node);
+};
+
+}  // namespace s21
+
+#include "s21_concurrent_stack.tpp"
+
+#endif  // SRC_S21_CONTAINERSPLUS_S21_CONCURRENT_STACK_H_
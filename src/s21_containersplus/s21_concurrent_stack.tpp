@@ -0,0 +1,224 @@
+#ifndef SRC_S21_CONTAINERSPLUS_S21_CONCURRENT_STACK_TPP_
+#define SRC_S21_CONTAINERSPLUS_S21_CONCURRENT_STACK_TPP_
+
+#include "s21_concurrent_stack.h"
+
+namespace s21 {
+
+// helper methods
+template <typename T>
+void concurrent_stack<T>::destroy(void* node) {
+  delete static_cast<Node*>(node);
+}
+
+// xorshift per thread, seeded from the address of its own state
+template <typename T>
+size_t concurrent_stack<T>::random_slot() {
+  static thread_local std::uint32_t state = 0;
+  if (state == 0) {
+    state = static_cast<std::uint32_t>(
+                reinterpret_cast<std::uintptr_t>(&state) >> 4) |
+            1;
+  }
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state % kSlots;
+}
+
+// Offers node to a pop in a random slot for a short while. True if a pop
+// took it, false if the slot was busy or nobody came.
+template <typename T>
+bool concurrent_stack<T>::park(Node* node) {
+  std::atomic<std::uintptr_t>& slot = slots[random_slot()].node;
+  std::uintptr_t parked = reinterpret_cast<std::uintptr_t>(node);
+  std::uintptr_t empty = 0;
+  if (!slot.compare_exchange_strong(empty, parked, std::memory_order_release,
+                                    std::memory_order_relaxed)) {
+    return false;
+  }
+  bool taken = false;
+  for (unsigned spin = 0; spin < kParkSpins && !taken; ++spin) {
+    taken = slot.load(std::memory_order_relaxed) != parked;
+  }
+  if (!taken) {
+    taken = !slot.compare_exchange_strong(parked, 0,
+                                          std::memory_order_relaxed);
+  }
+  // a pop has marked the slot; hand it back for the next park
+  if (taken) slot.store(0, std::memory_order_relaxed);
+  return taken;
+}
+
+template <typename T>
+typename concurrent_stack<T>::Node* concurrent_stack<T>::take_parked() {
+  std::atomic<std::uintptr_t>& slot = slots[random_slot()].node;
+  std::uintptr_t parked = slot.load(std::memory_order_relaxed);
+  if (parked != 0 && !(parked & kTaken) &&
+      slot.compare_exchange_strong(parked, parked | kTaken,
+                                   std::memory_order_acquire,
+                                   std::memory_order_relaxed)) {
+    return reinterpret_cast<Node*>(parked);
+  }
+  return nullptr;
+}
+
+// Links the chain first..last on top of the stack. A single node that
+// loses the race tries the elimination array before the next attempt.
+template <typename T>
+void concurrent_stack<T>::push_chain(Node* first, Node* last) {
+  last->next = head.load(std::memory_order_relaxed);
+  while (!head.compare_exchange_weak(last->next, first,
+                                     std::memory_order_release,
+                                     std::memory_order_relaxed)) {
+    if (first == last && park(first)) return;
+  }
+}
+
+// Unlinks the top node, or takes a parked one. *parked tells which: a
+// parked node was never in the stack, so no other thread can be reading it.
+template <typename T>
+typename concurrent_stack<T>::Node* concurrent_stack<T>::pop_node(
+    bool* parked) {
+  std::atomic<const void*>& guard = hazard::slot();
+  Node* top = head.load(std::memory_order_acquire);
+  Node* node = nullptr;
+  *parked = false;
+  while (top) {
+    guard.store(top);
+    Node* current = head.load();
+    if (current != top) {
+      top = current;
+      continue;
+    }
+    // top cannot be freed while it is in the slot, so top->next is safe
+    if (head.compare_exchange_weak(top, top->next, std::memory_order_acquire,
+                                   std::memory_order_acquire)) {
+      node = current;
+      break;
+    }
+    if ((node = take_parked())) {
+      *parked = true;
+      break;
+    }
+  }
+  guard.store(nullptr, std::memory_order_release);
+  if (!node && (node = take_parked())) *parked = true;
+  return node;
+}
+
+template <typename T>
+void concurrent_stack<T>::release(Node* node, bool parked) {
+  if (parked) {
+    delete node;
+  } else {
+    hazard::retire(node, destroy);
+  }
+}
+
+// constructors
+template <typename T>
+concurrent_stack<T>::concurrent_stack(
+    std::initializer_list<value_type> const& items) {
+  push_many(items.begin(), items.end());
+}
+
+// destructor
+template <typename T>
+concurrent_stack<T>::~concurrent_stack() {
+  Node* node = head.load(std::memory_order_acquire);
+  while (node) {
+    Node* next = node->next;
+    delete node;
+    node = next;
+  }
+}
+
+// capacity
+template <typename T>
+bool concurrent_stack<T>::empty() const {
+  return head.load(std::memory_order_acquire) == nullptr;
+}
+
+// modifiers
+template <typename T>
+void concurrent_stack<T>::push(const_reference value) {
+  emplace(value);
+}
+
+template <typename T>
+void concurrent_stack<T>::push(value_type&& value) {
+  emplace(std::move(value));
+}
+
+template <typename T>
+template <typename... Args>
+void concurrent_stack<T>::emplace(Args&&... args) {
+  Node* node = new Node(std::forward<Args>(args)...);
+  push_chain(node, node);
+}
+
+template <typename T>
+template <typename InputIt>
+void concurrent_stack<T>::push_many(InputIt first, InputIt last) {
+  Node* top = nullptr;
+  Node* bottom = nullptr;
+  try {
+    for (; first != last; ++first) {
+      Node* node = new Node(*first);
+      node->next = top;
+      top = node;
+      if (!bottom) bottom = node;
+    }
+  } catch (...) {
+    while (top) {
+      Node* next = top->next;
+      delete top;
+      top = next;
+    }
+    throw;
+  }
+  if (top) push_chain(top, bottom);
+}
+
+template <typename T>
+bool concurrent_stack<T>::try_pop(reference value) {
+  bool parked;
+  Node* node = pop_node(&parked);
+  if (!node) return false;
+  value = std::move(node->value);
+  release(node, parked);
+  return true;
+}
+
+template <typename T>
+template <typename OutputIt>
+OutputIt concurrent_stack<T>::pop_many(OutputIt out, size_type max) {
+  for (; max > 0; --max) {
+    bool parked;
+    Node* node = pop_node(&parked);
+    if (!node) break;
+    *out++ = std::move(node->value);
+    release(node, parked);
+  }
+  return out;
+}
+
+// Other threads may still hold a hazard on any node of the chain, having
+// read it as the head before the exchange, so every node is retired.
+template <typename T>
+template <typename OutputIt>
+OutputIt concurrent_stack<T>::pop_all(OutputIt out) {
+  Node* node = head.exchange(nullptr, std::memory_order_acquire);
+  while (node) {
+    Node* next = node->next;
+    *out++ = std::move(node->value);
+    hazard::retire(node, destroy);
+    node = next;
+  }
+  return out;
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_CONTAINERSPLUS_S21_CONCURRENT_STACK_TPP_
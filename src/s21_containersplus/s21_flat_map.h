@@ -0,0 +1,19 @@
+#ifndef SRC_S21_CONTAINERSPLUS_S21_FLAT_MAP_H_
+#define SRC_S21_CONTAINERSPLUS_S21_FLAT_MAP_H_
+
+#include "../s21_containers/s21_flat_tree.h"
+#include "../s21_containers/s21_map.h"
+
+namespace s21 {
+
+// s21::map over FlatTree: the same interface, with the keys and the values
+// in two sorted arrays, so lookups scan only keys. Inserts and erases are
+// O(n) and invalidate every iterator. An iterator yields a pair of
+// references, so (*it).first and (*it).second work as with map, but the
+// pair itself is a temporary.
+template <typename Key, typename Val, typename Compare = std::less<Key>>
+using flat_map = map<Key, Val, Compare, FlatTree>;
+
+}  // namespace s21
+
+#endif  // SRC_S21_CONTAINERSPLUS_S21_FLAT_MAP_H_
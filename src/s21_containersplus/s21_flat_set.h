@@ -0,0 +1,18 @@
+#ifndef SRC_S21_CONTAINERSPLUS_S21_FLAT_SET_H_
+#define SRC_S21_CONTAINERSPLUS_S21_FLAT_SET_H_
+
+#include "../s21_containers/s21_flat_tree.h"
+#include "../s21_containers/s21_set.h"
+
+namespace s21 {
+
+// s21::set over FlatTree: the same interface, with the keys kept in one
+// sorted array. Lookups are faster and inserts and erases O(n), so it suits
+// sets that are built in bulk (from a range or with assign_sorted) and then
+// read. Any insert or erase invalidates every iterator.
+template <typename Key, typename Compare = std::less<Key>>
+using flat_set = set<Key, Compare, FlatTree>;
+
+}  // namespace s21
+
+#endif  // SRC_S21_CONTAINERSPLUS_S21_FLAT_SET_H_
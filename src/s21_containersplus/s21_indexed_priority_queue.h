@@ -0,0 +1,111 @@
+#ifndef SRC_S21_CONTAINERSPLUS_S21_INDEXED_PRIORITY_QUEUE_H_
+#define SRC_S21_CONTAINERSPLUS_S21_INDEXED_PRIORITY_QUEUE_H_
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "../s21_containers/s21_instrument.h"
+#include "../s21_containers/s21_memory_stats.h"
+#include "../s21_containers/s21_vector.h"
+
+namespace s21 {
+
+// d-ary heap that can change or remove any queued element. push returns a
+// handle, a small integer that names the element until it is popped or
+// erased; update, erase and value look it up in a table of heap positions
+// that every move in the heap keeps current. update, erase, push and pop
+// are all O(log n). A handle given back by pop or erase is reused by a
+// later push.
+//
+// Each heap slot holds the element next to its handle, so sifting compares
+// within one array and touches the position table only to record moves.
+// top() is the greatest element under Compare, so std::greater gives a
+// min-heap, as a scheduler or Dijkstra's algorithm wants.
+template <typename T, typename Compare = std::less<T>,
+          std::size_t Arity = 4>
+class indexed_priority_queue {
+  static_assert(Arity >= 2, "a heap needs at least two children per node");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using handle_type = std::size_t;
+  using value_compare = Compare;
+  static constexpr size_type arity = Arity;
+
+  // constructors
+  indexed_priority_queue() = default;
+  explicit indexed_priority_queue(const Compare &comp) : comp(comp) {}
+  indexed_priority_queue(const indexed_priority_queue &other) = default;
+  indexed_priority_queue(indexed_priority_queue &&other) = default;
+
+  // destructor
+  ~indexed_priority_queue() = default;
+
+  // assignment
+  indexed_priority_queue &operator=(indexed_priority_queue &&other);
+
+  // element access; the handle overloads throw std::out_of_range for a
+  // handle that names nothing
+  const_reference top() const;
+  handle_type top_handle() const;
+  const_reference value(handle_type handle) const;
+  bool contains(handle_type handle) const;
+
+  // capacity
+  bool empty() const { return heap_.empty(); }
+  size_type size() const { return heap_.size(); }
+  void reserve(size_type n);
+  MemoryStats memory_stats() const;
+  size_type memory_usage() const { return memory_stats().total(); }
+
+  // modifiers
+  handle_type push(const_reference value);
+  handle_type push(value_type &&value);
+  template <typename... Args>
+  handle_type emplace(Args &&...args);
+  // gives the element a new value and moves it up or down to match
+  void update(handle_type handle, const_reference value);
+  void update(handle_type handle, value_type &&value);
+  void erase(handle_type handle);
+  void pop();
+  // removes the top element and returns it, moved rather than copied
+  value_type pop_value();
+  void clear();
+  void swap(indexed_priority_queue &other);
+
+ private:
+  static constexpr size_type kFree = std::numeric_limits<size_type>::max();
+
+  struct Entry {
+    T value;
+    handle_type handle;
+  };
+
+  vector<Entry> heap_;
+  vector<size_type> position_;  // heap slot of each handle, kFree if none
+  vector<handle_type> free_;    // handles to hand out again
+  instrument::compare_t<Compare, instrument::family::indexed_priority_queue>
+      comp;
+
+  // helper methods
+  size_type slot_of(handle_type handle) const;
+  handle_type insert(value_type &&value);
+  template <typename V>
+  void assign(handle_type handle, V &&value);
+  Entry remove(size_type i);
+  void place(size_type i, Entry &&entry);
+  void sift_up(size_type i);
+  void sift_down(size_type i);
+};
+
+}  // namespace s21
+
+#include "s21_indexed_priority_queue.tpp"
+
+#endif  // SRC_S21_CONTAINERSPLUS_S21_INDEXED_PRIORITY_QUEUE_H_
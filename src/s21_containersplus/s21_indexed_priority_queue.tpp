@@ -0,0 +1,243 @@
+#ifndef SRC_S21_CONTAINERSPLUS_S21_INDEXED_PRIORITY_QUEUE_TPP_
+#define SRC_S21_CONTAINERSPLUS_S21_INDEXED_PRIORITY_QUEUE_TPP_
+
+#include "s21_indexed_priority_queue.h"
+
+namespace s21 {
+
+// helper methods
+template <typename T, typename Compare, std::size_t Arity>
+typename indexed_priority_queue<T, Compare, Arity>::size_type
+indexed_priority_queue<T, Compare, Arity>::slot_of(handle_type handle) const {
+  if (handle >= position_.size() || position_.cbegin()[handle] == kFree) {
+    throw std::out_of_range("indexed_priority_queue: no such handle");
+  }
+  return position_.cbegin()[handle];
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::place(size_type i,
+                                                      Entry &&entry) {
+  Entry *heap = heap_.data();
+  heap[i] = std::move(entry);
+  position_.data()[heap[i].handle] = i;
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::sift_up(size_type i) {
+  Entry *heap = heap_.data();
+  Entry entry = std::move(heap[i]);
+  while (i > 0) {
+    size_type parent = (i - 1) / Arity;
+    if (!comp(heap[parent].value, entry.value)) break;
+    place(i, std::move(heap[parent]));
+    i = parent;
+  }
+  place(i, std::move(entry));
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::sift_down(size_type i) {
+  Entry *heap = heap_.data();
+  size_type n = heap_.size();
+  Entry entry = std::move(heap[i]);
+  for (;;) {
+    size_type first = i * Arity + 1;
+    if (first >= n) break;
+    size_type last = first + Arity < n ? first + Arity : n;
+    size_type best = first;
+    for (size_type child = first + 1; child < last; ++child) {
+      if (comp(heap[best].value, heap[child].value)) best = child;
+    }
+    if (!comp(entry.value, heap[best].value)) break;
+    place(i, std::move(heap[best]));
+    i = best;
+  }
+  place(i, std::move(entry));
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+typename indexed_priority_queue<T, Compare, Arity>::handle_type
+indexed_priority_queue<T, Compare, Arity>::insert(value_type &&value) {
+  handle_type handle;
+  if (free_.empty()) {
+    handle = position_.size();
+    position_.push_back(kFree);
+  } else {
+    handle = free_.back();
+    free_.pop_back();
+  }
+  heap_.push_back(Entry{std::move(value), handle});
+  position_.data()[handle] = heap_.size() - 1;
+  sift_up(heap_.size() - 1);
+  return handle;
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+template <typename V>
+void indexed_priority_queue<T, Compare, Arity>::assign(handle_type handle,
+                                                       V &&value) {
+  size_type i = slot_of(handle);
+  Entry &entry = heap_.data()[i];
+  bool up = comp(entry.value, value);
+  entry.value = std::forward<V>(value);
+  if (up) {
+    sift_up(i);
+  } else {
+    sift_down(i);
+  }
+}
+
+// Takes the entry in slot i out of the heap, fills the gap with the last
+// entry and moves that one whichever way it has to go.
+template <typename T, typename Compare, std::size_t Arity>
+typename indexed_priority_queue<T, Compare, Arity>::Entry
+indexed_priority_queue<T, Compare, Arity>::remove(size_type i) {
+  Entry *heap = heap_.data();
+  free_.push_back(heap[i].handle);
+  position_.data()[heap[i].handle] = kFree;
+  Entry gone = std::move(heap[i]);
+  size_type last = heap_.size() - 1;
+  if (i != last) place(i, std::move(heap[last]));
+  heap_.pop_back();
+  if (i != last) {
+    if (i > 0 && comp(heap[(i - 1) / Arity].value, heap[i].value)) {
+      sift_up(i);
+    } else {
+      sift_down(i);
+    }
+  }
+  return gone;
+}
+
+// assignment
+template <typename T, typename Compare, std::size_t Arity>
+indexed_priority_queue<T, Compare, Arity> &
+indexed_priority_queue<T, Compare, Arity>::operator=(
+    indexed_priority_queue &&other) {
+  if (this != &other) {
+    heap_ = std::move(other.heap_);
+    position_ = std::move(other.position_);
+    free_ = std::move(other.free_);
+    comp = std::move(other.comp);
+  }
+  return *this;
+}
+
+// element access
+template <typename T, typename Compare, std::size_t Arity>
+typename indexed_priority_queue<T, Compare, Arity>::const_reference
+indexed_priority_queue<T, Compare, Arity>::top() const {
+  if (empty()) {
+    throw std::out_of_range("Top on empty indexed_priority_queue");
+  }
+  return heap_.front().value;
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+typename indexed_priority_queue<T, Compare, Arity>::handle_type
+indexed_priority_queue<T, Compare, Arity>::top_handle() const {
+  if (empty()) {
+    throw std::out_of_range("Top on empty indexed_priority_queue");
+  }
+  return heap_.front().handle;
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+typename indexed_priority_queue<T, Compare, Arity>::const_reference
+indexed_priority_queue<T, Compare, Arity>::value(handle_type handle) const {
+  return heap_.cbegin()[slot_of(handle)].value;
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+bool indexed_priority_queue<T, Compare, Arity>::contains(
+    handle_type handle) const {
+  return handle < position_.size() && position_.cbegin()[handle] != kFree;
+}
+
+// capacity
+template <typename T, typename Compare, std::size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::reserve(size_type n) {
+  heap_.reserve(n);
+  position_.reserve(n);
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+MemoryStats indexed_priority_queue<T, Compare, Arity>::memory_stats() const {
+  MemoryStats held = memory::held_by(heap_);
+  held += memory::held_by(position_);
+  held += memory::held_by(free_);
+  return memory::split(sizeof(*this) + held.total(), size(), sizeof(T),
+                       held.allocations);
+}
+
+// modifiers
+template <typename T, typename Compare, std::size_t Arity>
+typename indexed_priority_queue<T, Compare, Arity>::handle_type
+indexed_priority_queue<T, Compare, Arity>::push(const_reference value) {
+  return insert(value_type(value));
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+typename indexed_priority_queue<T, Compare, Arity>::handle_type
+indexed_priority_queue<T, Compare, Arity>::push(value_type &&value) {
+  return insert(std::move(value));
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+template <typename... Args>
+typename indexed_priority_queue<T, Compare, Arity>::handle_type
+indexed_priority_queue<T, Compare, Arity>::emplace(Args &&...args) {
+  return insert(value_type(std::forward<Args>(args)...));
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::update(handle_type handle,
+                                                       const_reference value) {
+  assign(handle, value);
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::update(handle_type handle,
+                                                       value_type &&value) {
+  assign(handle, std::move(value));
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::erase(handle_type handle) {
+  remove(slot_of(handle));
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::pop() {
+  pop_value();
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+typename indexed_priority_queue<T, Compare, Arity>::value_type
+indexed_priority_queue<T, Compare, Arity>::pop_value() {
+  if (empty()) {
+    throw std::out_of_range("Pop on empty indexed_priority_queue");
+  }
+  return std::move(remove(0).value);
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::clear() {
+  heap_.clear();
+  position_.clear();
+  free_.clear();
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::swap(
+    indexed_priority_queue &other) {
+  heap_.swap(other.heap_);
+  position_.swap(other.position_);
+  free_.swap(other.free_);
+  std::swap(comp, other.comp);
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_CONTAINERSPLUS_S21_INDEXED_PRIORITY_QUEUE_TPP_
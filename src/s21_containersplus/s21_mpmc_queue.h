@@ -0,0 +1,123 @@
+#ifndef SRC_S21_CONTAINERSPLUS_S21_MPMC_QUEUE_H_
+#define SRC_S21_CONTAINERSPLUS_S21_MPMC_QUEUE_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <iterator>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Bounded lock-free FIFO queue for any number of producer and consumer
+// threads, after Dmitry Vyukov's array queue. Every cell carries a
+// sequence number that says whose turn it is: equal to a position when a
+// push may fill it, one past it once the element is there to pop. A push
+// or pop claims its position with one compare-and-swap on a shared index,
+// then works on its cell alone, so threads only meet on the two indices,
+// which sit on cache lines of their own.
+//
+// try_push and try_pop give up at once on a full or empty queue. push and
+// pop retry for a while and then park on a condition variable until the
+// other side makes progress. The batch calls claim a run of cells with one
+// compare-and-swap.
+//
+// T must move and destroy without throwing: once a cell is claimed the
+// operation has to finish. Values whose construction may throw are built
+// before a cell is claimed.
+template <typename T>
+class mpmc_queue {
+  static_assert(std::is_nothrow_move_constructible_v<T> &&
+                    std::is_nothrow_move_assignable_v<T> &&
+                    std::is_nothrow_destructible_v<T>,
+                "mpmc_queue needs nothrow move and destruction");
+
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = std::size_t;
+
+  // constructors
+  // room for capacity elements, rounded up to a power of two of at least 2
+  explicit mpmc_queue(size_type capacity);
+  mpmc_queue(const mpmc_queue&) = delete;
+  mpmc_queue& operator=(const mpmc_queue&) = delete;
+
+  // destructor
+  ~mpmc_queue();
+
+  // capacity
+  size_type capacity() const { return mask_ + 1; }
+
+  // modifiers; a failed try_ call leaves its argument as it was
+  bool try_push(const_reference value);
+  bool try_push(value_type&& value);
+  template <typename... Args>
+  bool try_emplace(Args&&... args);
+  bool try_pop(reference value);
+  // wait while the queue is full or empty
+  void push(const_reference value);
+  void push(value_type&& value);
+  void pop(reference value);
+  // pushes from the range until it ends or the queue fills; returns the
+  // first element that was not pushed
+  template <typename ForwardIt>
+  ForwardIt try_push_many(ForwardIt first, ForwardIt last);
+  // pops up to max elements into out, oldest first; returns the end of out.
+  // If writing to out throws, the rest of the claimed run is dropped.
+  template <typename OutputIt>
+  OutputIt try_pop_many(OutputIt out, size_type max);
+
+ private:
+  static constexpr size_type kCacheLine = 64;
+  static constexpr unsigned kSpins = 64;
+
+  struct Cell {
+    std::atomic<size_type> sequence;
+    alignas(T) unsigned char storage[sizeof(T)];
+    T& value() { return *std::launder(reinterpret_cast<T*>(storage)); }
+  };
+
+  // threads parked in push and pop, and what they wait on; each wake-up
+  // bumps its counter under the lock, so a parked thread can tell whether
+  // it missed one while it was trying
+  struct alignas(kCacheLine) Parking {
+    std::atomic<unsigned> pushers{0};
+    std::atomic<unsigned> poppers{0};
+    std::mutex lock;
+    std::condition_variable not_full;
+    std::condition_variable not_empty;
+    unsigned not_full_signals = 0;
+    unsigned not_empty_signals = 0;
+  };
+
+  Cell* cells_;
+  size_type mask_;
+  alignas(kCacheLine) std::atomic<size_type> enqueue_{0};
+  alignas(kCacheLine) std::atomic<size_type> dequeue_{0};
+  Parking parking_;
+
+  // helper methods
+  size_type claim(std::atomic<size_type>& index, size_type offset,
+                  size_type max, size_type* first);
+  template <typename... Args>
+  bool claim_and_build(Args&&... args);
+  void pushed(size_type n);
+  void popped(size_type n);
+  void wake(std::atomic<unsigned>& waiters, std::condition_variable& ready,
+            unsigned& signals, size_type n);
+  template <typename Try>
+  void wait(Try attempt, std::atomic<unsigned>& waiters,
+            std::condition_variable& ready, unsigned& signals);
+};
+
+}  // namespace s21
+
+#include "s21_mpmc_queue.tpp"
+
+#endif  // SRC_S21_CONTAINERSPLUS_S21_MPMC_QUEUE_H_
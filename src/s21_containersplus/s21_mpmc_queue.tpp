@@ -0,0 +1,233 @@
+#ifndef SRC_S21_CONTAINERSPLUS_S21_MPMC_QUEUE_TPP_
+#define SRC_S21_CONTAINERSPLUS_S21_MPMC_QUEUE_TPP_
+
+#include "s21_mpmc_queue.h"
+
+namespace s21 {
+
+// helper methods
+// Claims up to max cells from index on: cell pos + i is ready for a push
+// when its sequence is pos + i, and for a pop when it is pos + i + 1, so
+// offset is 0 or 1. Nobody else can claim past index until we move it, so
+// the run counted before the compare-and-swap is still ready after it.
+// Returns the number claimed, 0 if the queue is full or empty, and the
+// position of the first in *first.
+template <typename T>
+typename mpmc_queue<T>::size_type mpmc_queue<T>::claim(
+    std::atomic<size_type>& index, size_type offset, size_type max,
+    size_type* first) {
+  size_type pos = index.load(std::memory_order_relaxed);
+  for (;;) {
+    size_type n = 0;
+    while (n < max && n <= mask_ &&
+           cells_[(pos + n) & mask_].sequence.load(
+               std::memory_order_acquire) == pos + n + offset) {
+      ++n;
+    }
+    if (n == 0) {
+      size_type sequence =
+          cells_[pos & mask_].sequence.load(std::memory_order_acquire);
+      // behind: the cell is still busy from the lap before, so the queue
+      // is full or empty; ahead: another thread has claimed pos already
+      if (static_cast<std::ptrdiff_t>(sequence - (pos + offset)) < 0) {
+        return 0;
+      }
+      pos = index.load(std::memory_order_relaxed);
+    } else if (index.compare_exchange_weak(pos, pos + n,
+                                           std::memory_order_relaxed)) {
+      *first = pos;
+      return n;
+    }
+  }
+}
+
+template <typename T>
+template <typename... Args>
+bool mpmc_queue<T>::claim_and_build(Args&&... args) {
+  size_type pos;
+  if (claim(enqueue_, 0, 1, &pos) == 0) return false;
+  Cell& cell = cells_[pos & mask_];
+  new (cell.storage) T(std::forward<Args>(args)...);
+  cell.sequence.store(pos + 1, std::memory_order_release);
+  pushed(1);
+  return true;
+}
+
+template <typename T>
+void mpmc_queue<T>::pushed(size_type n) {
+  wake(parking_.poppers, parking_.not_empty, parking_.not_empty_signals, n);
+}
+
+template <typename T>
+void mpmc_queue<T>::popped(size_type n) {
+  wake(parking_.pushers, parking_.not_full, parking_.not_full_signals, n);
+}
+
+// Wakes threads parked on ready after n cells changed hands. The fence
+// pairs with the one in wait: either the parked thread sees the cells, or
+// we see it in waiters.
+template <typename T>
+void mpmc_queue<T>::wake(std::atomic<unsigned>& waiters,
+                         std::condition_variable& ready, unsigned& signals,
+                         size_type n) {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (waiters.load(std::memory_order_relaxed) == 0) return;
+  std::lock_guard<std::mutex> guard(parking_.lock);
+  ++signals;
+  if (n == 1) {
+    ready.notify_one();
+  } else {
+    ready.notify_all();
+  }
+}
+
+// Tries attempt a few times, then parks until a wake-up and tries again.
+// attempt runs without the lock, since a success wakes the other side.
+template <typename T>
+template <typename Try>
+void mpmc_queue<T>::wait(Try attempt, std::atomic<unsigned>& waiters,
+                         std::condition_variable& ready, unsigned& signals) {
+  for (unsigned spin = 0; spin < kSpins; ++spin) {
+    if (attempt()) return;
+    std::this_thread::yield();
+  }
+  std::unique_lock<std::mutex> lock(parking_.lock);
+  waiters.fetch_add(1, std::memory_order_relaxed);
+  for (;;) {
+    unsigned seen = signals;
+    lock.unlock();
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    bool done = attempt();
+    lock.lock();
+    if (done) break;
+    ready.wait(lock, [&signals, seen] { return signals != seen; });
+  }
+  waiters.fetch_sub(1, std::memory_order_relaxed);
+}
+
+// constructors
+template <typename T>
+mpmc_queue<T>::mpmc_queue(size_type capacity) {
+  size_type rounded = 2;
+  while (rounded < capacity) rounded *= 2;
+  cells_ = static_cast<Cell*>(::operator new(sizeof(Cell) * rounded));
+  for (size_type i = 0; i < rounded; ++i) {
+    new (&cells_[i].sequence) std::atomic<size_type>(i);
+  }
+  mask_ = rounded - 1;
+}
+
+// destructor
+template <typename T>
+mpmc_queue<T>::~mpmc_queue() {
+  size_type end = enqueue_.load(std::memory_order_acquire);
+  for (size_type pos = dequeue_.load(std::memory_order_acquire); pos != end;
+       ++pos) {
+    cells_[pos & mask_].value().~T();
+  }
+  ::operator delete(cells_);
+}
+
+// modifiers
+template <typename T>
+bool mpmc_queue<T>::try_push(const_reference value) {
+  return try_emplace(value);
+}
+
+template <typename T>
+bool mpmc_queue<T>::try_push(value_type&& value) {
+  return try_emplace(std::move(value));
+}
+
+template <typename T>
+template <typename... Args>
+bool mpmc_queue<T>::try_emplace(Args&&... args) {
+  if constexpr (std::is_nothrow_constructible_v<T, Args&&...>) {
+    return claim_and_build(std::forward<Args>(args)...);
+  } else {
+    value_type value(std::forward<Args>(args)...);
+    return claim_and_build(std::move(value));
+  }
+}
+
+template <typename T>
+bool mpmc_queue<T>::try_pop(reference value) {
+  size_type pos;
+  if (claim(dequeue_, 1, 1, &pos) == 0) return false;
+  Cell& cell = cells_[pos & mask_];
+  value = std::move(cell.value());
+  cell.value().~T();
+  cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+  popped(1);
+  return true;
+}
+
+template <typename T>
+void mpmc_queue<T>::push(const_reference value) {
+  wait([this, &value] { return try_push(value); }, parking_.pushers,
+       parking_.not_full, parking_.not_full_signals);
+}
+
+template <typename T>
+void mpmc_queue<T>::push(value_type&& value) {
+  wait([this, &value] { return try_push(std::move(value)); },
+       parking_.pushers, parking_.not_full, parking_.not_full_signals);
+}
+
+template <typename T>
+void mpmc_queue<T>::pop(reference value) {
+  wait([this, &value] { return try_pop(value); }, parking_.poppers,
+       parking_.not_empty, parking_.not_empty_signals);
+}
+
+// Elements whose copy may throw go one at a time, each copied before its
+// cell is claimed.
+template <typename T>
+template <typename ForwardIt>
+ForwardIt mpmc_queue<T>::try_push_many(ForwardIt first, ForwardIt last) {
+  using source = typename std::iterator_traits<ForwardIt>::reference;
+  if constexpr (!std::is_nothrow_constructible_v<T, source>) {
+    while (first != last && try_emplace(*first)) ++first;
+  } else if (first != last) {
+    size_type pos;
+    size_type n = claim(enqueue_, 0, std::distance(first, last), &pos);
+    for (size_type i = 0; i < n; ++i, ++first) {
+      Cell& cell = cells_[(pos + i) & mask_];
+      new (cell.storage) T(*first);
+      cell.sequence.store(pos + i + 1, std::memory_order_release);
+    }
+    if (n > 0) pushed(n);
+  }
+  return first;
+}
+
+template <typename T>
+template <typename OutputIt>
+OutputIt mpmc_queue<T>::try_pop_many(OutputIt out, size_type max) {
+  if (max == 0) return out;
+  size_type pos;
+  size_type n = claim(dequeue_, 1, max, &pos);
+  size_type i = 0;
+  try {
+    for (; i < n; ++i) {
+      Cell& cell = cells_[(pos + i) & mask_];
+      *out++ = std::move(cell.value());
+      cell.value().~T();
+      cell.sequence.store(pos + i + mask_ + 1, std::memory_order_release);
+    }
+  } catch (...) {
+    for (; i < n; ++i) {
+      Cell& cell = cells_[(pos + i) & mask_];
+      cell.value().~T();
+      cell.sequence.store(pos + i + mask_ + 1, std::memory_order_release);
+    }
+    popped(n);
+    throw;
+  }
+  if (n > 0) popped(n);
+  return out;
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_CONTAINERSPLUS_S21_MPMC_QUEUE_TPP_
@@ -6,19 +6,33 @@
 
 namespace s21 {
 
-template <typename Key>
+// Tree selects the backing store: AVLTree (the default), ArenaAVLTree,
+// BPlusTree or FlatTree, optionally behind a BloomTree filter.
+template <typename Key, typename Compare = std::less<Key>,
+          template <typename, typename, typename> class Tree = AVLTree>
 class multiset {
+ private:
+  using tree_type = Tree<Key, std::nullptr_t, Compare>;
+
  public:
   using key_type = Key;
   using value_type = Key;
+  using key_compare = Compare;
+  using value_compare = Compare;
   using reference = value_type&;
   using const_reference = const value_type&;
-  using iterator = typename set<Key>::iterator;
-  using const_iterator = typename set<Key>::const_iterator;
-  using size_type = typename AVLTree<Key, std::nullptr_t>::size_type;
+  using iterator = typename set<Key, Compare, Tree>::iterator;
+  using const_iterator = typename set<Key, Compare, Tree>::const_iterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+  using size_type = typename tree_type::size_type;
+  using node_type = typename tree_type::node_type;
 
   multiset() = default;
+  explicit multiset(const Compare& comp) : tree(comp) {}
   multiset(std::initializer_list<Key> const& elements);
+  template <typename InputIt>
+  multiset(InputIt first, InputIt last, const Compare& comp = Compare());
   multiset(const multiset& s) : tree(s.tree) {}
   multiset(multiset&& s) : tree(std::move(s.tree)) {}
   ~multiset() {}
@@ -27,20 +41,61 @@ class multiset {
   // iterators
   iterator begin() { return iterator(tree.begin()); }
   iterator end() { return iterator(tree.end()); }
-  const_iterator cbegin() { return Constiterator(tree.cbegin()); }
-  const_iterator cend() { return Constiterator(tree.cend()); }
+  const_iterator cbegin() { return const_iterator(tree.cbegin()); }
+  const_iterator cend() { return const_iterator(tree.cend()); }
+  reverse_iterator rbegin() { return reverse_iterator(end()); }
+  reverse_iterator rend() { return reverse_iterator(begin()); }
+  const_reverse_iterator crbegin() { return const_reverse_iterator(cend()); }
+  const_reverse_iterator crend() { return const_reverse_iterator(cbegin()); }
+
+  // element access, O(1): the smallest and the largest key
+  const_reference front() { return *begin(); }
+  const_reference back() { return *--end(); }
 
   // Capacity
   bool empty() const { return tree.empty(); }
   size_type size() const { return tree.size(); }
   size_type max_size() const { return tree.max_size(); }
+  MemoryStats memory_stats() const { return tree.memory_stats(); }
+  size_type memory_usage() const { return tree.memory_usage(); }
+  // ArenaAVLTree and FlatTree only: preallocates room for n elements;
+  // BloomTree sizes its filter for n keys
+  void reserve(size_type n) { tree.reserve(n); }
+  // BloomTree only: the estimated chance that looking up a missing key
+  // still searches the tree
+  double false_positive_rate() const { return tree.false_positive_rate(); }
 
   // Modifiers
   void clear() { tree.clear(); }
   iterator insert(const value_type& value);
-  void erase(iterator pos) { tree.erase(tree.find(*pos)); }
+  iterator insert(value_type&& value);
+  iterator insert(iterator hint, const value_type& value);
+  iterator insert(iterator hint, value_type&& value);
+  template <typename... Args>
+  iterator emplace(Args&&... args);
+  template <typename... Args>
+  iterator emplace_hint(iterator hint, Args&&... args);
+  void erase(iterator pos) { tree.erase(pos.it_); }
+  iterator erase(iterator first, iterator last) {
+    return iterator(tree.erase(first.it_, last.it_));
+  }
+  // extract(key) takes the first of the equal elements
+  node_type extract(iterator pos) { return tree.extract(pos.it_); }
+  node_type extract(const key_type& key) {
+    return tree.extract(tree.find(key));
+  }
+  iterator insert(node_type&& node);
   void swap(multiset& other) { tree.swap(other.tree); }
   void merge(multiset& other) { tree.merge(other.tree, true); }
+  // as in set; every copy of key goes to the returned part, and join
+  // accepts keys equal to our first or last one
+  multiset split(const key_type& key);
+  void join(multiset& other);
+  template <typename ForwardIt>
+  void assign_sorted(ForwardIt first, ForwardIt last);
+  // as in set, keeping every element
+  template <typename InputIt>
+  void assign_parallel(InputIt first, InputIt last, unsigned threads = 0);
 
   // Lookup
   iterator find(const key_type& key) { return iterator(tree.find(key)); }
@@ -49,13 +104,47 @@ class multiset {
   iterator upper_bound(const Key& key);
   std::pair<iterator, iterator> equal_range(const Key& key);
   size_type count(const Key& key);
+  // heterogeneous lookup, only with a transparent Compare such as
+  // std::less<>
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K& key) {
+    return iterator(tree.find(key));
+  }
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K& key) {
+    return tree.contains(key);
+  }
+  // find and contains for every key of [first, last), written to out in
+  // order; the lookups run in interleaved batches that overlap their cache
+  // misses, which pays off for many keys in a tree larger than the cache
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out) {
+    tree.find_many(first, last, [&out](typename tree_type::Iterator it) {
+      *out++ = iterator(it);
+    });
+    return out;
+  }
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt contains_many(ForwardIt first, ForwardIt last, OutputIt out) {
+    typename tree_type::Iterator none = tree.end();
+    tree.find_many(first, last, [&out, none](typename tree_type::Iterator it) {
+      *out++ = it != none;
+    });
+    return out;
+  }
+
+  // Observers
+  key_compare key_comp() const { return tree.key_comp(); }
+  value_compare value_comp() const { return tree.key_comp(); }
 
   // Part 3
   template <typename... Args>
   vector<std::pair<iterator, bool>> insert_many(Args&&... args);
 
  private:
-  AVLTree<Key, std::nullptr_t> tree;
+  tree_type tree;
 };
 
 }  // namespace s21
@@ -3,67 +3,165 @@
 
 namespace s21 {
 
-template <typename Key>
-multiset<Key>::multiset(std::initializer_list<Key> const& elements) {
-  for (const auto& elem : elements) {
-    tree.insert(std::make_pair(elem, nullptr), true);
-  }
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+multiset<Key, Compare, Tree>::multiset(
+    std::initializer_list<Key> const& elements) {
+  tree.assign(elements.begin(), elements.end(), true);
+}
+
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+template <typename InputIt>
+multiset<Key, Compare, Tree>::multiset(InputIt first, InputIt last,
+                                       const Compare& comp)
+    : tree(comp) {
+  tree.assign(first, last, true);
 }
 
-template <typename Key>
-multiset<Key>& multiset<Key>::operator=(multiset&& other) noexcept {
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+multiset<Key, Compare, Tree>& multiset<Key, Compare, Tree>::operator=(
+    multiset&& other) noexcept {
   if (this != &other) {
-    tree = other.tree;
+    tree = std::move(other.tree);
   }
   return *this;
 }
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::insert(
-    const value_type& value) {
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+template <typename ForwardIt>
+void multiset<Key, Compare, Tree>::assign_sorted(ForwardIt first,
+                                                 ForwardIt last) {
+  tree.assign_sorted(first, last, true);
+}
+
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+template <typename InputIt>
+void multiset<Key, Compare, Tree>::assign_parallel(InputIt first,
+                                                   InputIt last,
+                                                   unsigned threads) {
+  tree.assign_parallel(first, last, true, bulk::Keep::kFirst, threads);
+}
+
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+typename multiset<Key, Compare, Tree>::iterator
+multiset<Key, Compare, Tree>::insert(const value_type& value) {
   auto iter = tree.insert(std::make_pair(value, nullptr), true);
   return iterator(iter.first);
 }
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::lower_bound(const Key& key) {
-  auto iter = begin();
-  while (iter != end() && *iter < key) {
-    ++iter;
-  }
-  return iter;
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+typename multiset<Key, Compare, Tree>::iterator
+multiset<Key, Compare, Tree>::insert(value_type&& value) {
+  auto iter = tree.insert(std::make_pair(std::move(value), nullptr), true);
+  return iterator(iter.first);
 }
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::upper_bound(const Key& key) {
-  auto iter = lower_bound(key);
-  while (iter != end() && *iter == key) {
-    ++iter;
-  }
-  return iter;
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+typename multiset<Key, Compare, Tree>::iterator
+multiset<Key, Compare, Tree>::insert(iterator hint, const value_type& value) {
+  return iterator(
+      tree.insert(hint.it_, std::make_pair(value, nullptr), true).first);
+}
+
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+typename multiset<Key, Compare, Tree>::iterator
+multiset<Key, Compare, Tree>::insert(iterator hint, value_type&& value) {
+  return iterator(
+      tree.insert(hint.it_, std::make_pair(std::move(value), nullptr), true)
+          .first);
+}
+
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+template <typename... Args>
+typename multiset<Key, Compare, Tree>::iterator
+multiset<Key, Compare, Tree>::emplace(Args&&... args) {
+  auto iter = tree.emplace(
+      true, std::piecewise_construct,
+      std::forward_as_tuple(std::forward<Args>(args)...), std::tuple<>());
+  return iterator(iter.first);
+}
+
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+template <typename... Args>
+typename multiset<Key, Compare, Tree>::iterator
+multiset<Key, Compare, Tree>::emplace_hint(iterator hint, Args&&... args) {
+  return insert(hint, value_type(std::forward<Args>(args)...));
+}
+
+// Always succeeds, so the handle is left empty.
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+typename multiset<Key, Compare, Tree>::iterator
+multiset<Key, Compare, Tree>::insert(node_type&& node) {
+  return iterator(tree.insert(node, true).first);
+}
+
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+typename multiset<Key, Compare, Tree>::iterator
+multiset<Key, Compare, Tree>::lower_bound(const Key& key) {
+  return iterator(tree.lower_bound(key));
 }
 
-template <typename Key>
-std::pair<typename multiset<Key>::iterator, typename multiset<Key>::iterator>
-multiset<Key>::equal_range(const Key& key) {
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+typename multiset<Key, Compare, Tree>::iterator
+multiset<Key, Compare, Tree>::upper_bound(const Key& key) {
+  return iterator(tree.upper_bound(key));
+}
+
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+std::pair<typename multiset<Key, Compare, Tree>::iterator,
+          typename multiset<Key, Compare, Tree>::iterator>
+multiset<Key, Compare, Tree>::equal_range(const Key& key) {
   return std::make_pair(lower_bound(key), upper_bound(key));
 }
 
-template <typename Key>
-typename multiset<Key>::size_type multiset<Key>::count(const Key& key) {
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+typename multiset<Key, Compare, Tree>::size_type
+multiset<Key, Compare, Tree>::count(const Key& key) {
   size_type n = 0;
-  auto iter = lower_bound(key);
-  while (iter != end() && *iter == key) {
+  for (auto iter = lower_bound(key), last = upper_bound(key); iter != last;
+       ++iter) {
     ++n;
-    ++iter;
   }
   return n;
 }
 
-template <typename Key>
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+multiset<Key, Compare, Tree> multiset<Key, Compare, Tree>::split(
+    const key_type& key) {
+  multiset tail(key_comp());
+  tail.tree = tree.split(tree.lower_bound(key));
+  return tail;
+}
+
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
+void multiset<Key, Compare, Tree>::join(multiset& other) {
+  if (!tree.join(other.tree, true)) {
+    throw std::invalid_argument("join: key ranges overlap");
+  }
+}
+
+template <typename Key, typename Compare,
+          template <typename, typename, typename> class Tree>
 template <typename... Args>
-vector<std::pair<typename multiset<Key>::iterator, bool>>
-multiset<Key>::insert_many(Args&&... args) {
+vector<std::pair<typename multiset<Key, Compare, Tree>::iterator, bool>>
+multiset<Key, Compare, Tree>::insert_many(Args&&... args) {
   vector<std::pair<iterator, bool>> result;
   (result.push_back({insert(std::forward<Args>(args)), true}), ...);
   return result;
@@ -0,0 +1,96 @@
+#ifndef SRC_S21_CONTAINERSPLUS_S21_PRIORITY_QUEUE_H_
+#define SRC_S21_CONTAINERSPLUS_S21_PRIORITY_QUEUE_H_
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "../s21_containers/s21_instrument.h"
+#include "../s21_containers/s21_vector.h"
+
+namespace s21 {
+
+// Priority queue as an implicit d-ary heap in an s21::vector: the children
+// of slot i are slots i * Arity + 1 to i * Arity + Arity. As with
+// std::priority_queue, top() is the greatest element under Compare, so
+// std::greater gives a min-heap. A wider heap is shallower, so push
+// compares less, while pop compares more per level but walks fewer levels
+// whose children share a cache line; 4 is usually the best trade, 2 is the
+// classic binary heap.
+//
+// push and pop are O(log n) with no allocation beyond the vector's
+// doubling. Building from a range is O(n), and so is push_many when it
+// adds at least as many elements as the heap held.
+template <typename T, typename Compare = std::less<T>,
+          std::size_t Arity = 4>
+class priority_queue {
+  static_assert(Arity >= 2, "a heap needs at least two children per node");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using value_compare = Compare;
+  static constexpr size_type arity = Arity;
+
+  // constructors
+  priority_queue() = default;
+  explicit priority_queue(const Compare &comp) : comp(comp) {}
+  priority_queue(std::initializer_list<value_type> const &items,
+                 const Compare &comp = Compare());
+  template <typename InputIt>
+  priority_queue(InputIt first, InputIt last, const Compare &comp = Compare());
+  priority_queue(const priority_queue &other) = default;
+  priority_queue(priority_queue &&other) = default;
+
+  // destructor
+  ~priority_queue() = default;
+
+  // assignment
+  priority_queue &operator=(priority_queue &&other);
+
+  // element access
+  const_reference top() const;
+
+  // capacity
+  bool empty() const { return data_.empty(); }
+  size_type size() const { return data_.size(); }
+  void reserve(size_type n) { data_.reserve(n); }
+  MemoryStats memory_stats() const { return data_.memory_stats(); }
+  size_type memory_usage() const { return data_.memory_usage(); }
+
+  // modifiers
+  void push(const_reference value);
+  void push(value_type &&value);
+  // builds the element from args and moves it into the heap
+  template <typename... Args>
+  void emplace(Args &&...args);
+  // sifts each element up, or rebuilds the whole heap when the range is at
+  // least as long as the heap was
+  template <typename InputIt>
+  void push_many(InputIt first, InputIt last);
+  void pop();
+  // removes the top element and returns it, moved rather than copied
+  value_type pop_value();
+  void clear() { data_.clear(); }
+  void swap(priority_queue &other);
+
+ private:
+  vector<T> data_;
+  instrument::compare_t<Compare, instrument::family::priority_queue> comp;
+
+  // helper methods
+  void sift_up(size_type i);
+  void sift_down(size_type i);
+  void heapify();
+};
+
+}  // namespace s21
+
+#include "s21_priority_queue.tpp"
+
+#endif  // SRC_S21_CONTAINERSPLUS_S21_PRIORITY_QUEUE_H_
@@ -0,0 +1,177 @@
+#ifndef SRC_S21_CONTAINERSPLUS_S21_PRIORITY_QUEUE_TPP_
+#define SRC_S21_CONTAINERSPLUS_S21_PRIORITY_QUEUE_TPP_
+
+#include "s21_priority_queue.h"
+
+namespace s21 {
+
+// helper methods
+// Both sifts lift the element out and move the others past the hole, so
+// each level costs one move rather than a swap.
+template <typename T, typename Compare, std::size_t Arity>
+void priority_queue<T, Compare, Arity>::sift_up(size_type i) {
+  T *heap = data_.data();
+  value_type value = std::move(heap[i]);
+  while (i > 0) {
+    size_type parent = (i - 1) / Arity;
+    if (!comp(heap[parent], value)) break;
+    heap[i] = std::move(heap[parent]);
+    i = parent;
+  }
+  heap[i] = std::move(value);
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+void priority_queue<T, Compare, Arity>::sift_down(size_type i) {
+  T *heap = data_.data();
+  size_type n = data_.size();
+  value_type value = std::move(heap[i]);
+  for (;;) {
+    size_type first = i * Arity + 1;
+    if (first >= n) break;
+    size_type last = first + Arity < n ? first + Arity : n;
+    size_type best = first;
+    for (size_type child = first + 1; child < last; ++child) {
+      if (comp(heap[best], heap[child])) best = child;
+    }
+    if (!comp(value, heap[best])) break;
+    heap[i] = std::move(heap[best]);
+    i = best;
+  }
+  heap[i] = std::move(value);
+}
+
+// Floyd's construction: sift down every parent, last first.
+template <typename T, typename Compare, std::size_t Arity>
+void priority_queue<T, Compare, Arity>::heapify() {
+  size_type n = data_.size();
+  if (n < 2) return;
+  for (size_type i = (n - 2) / Arity + 1; i-- > 0;) sift_down(i);
+}
+
+// constructors
+template <typename T, typename Compare, std::size_t Arity>
+priority_queue<T, Compare, Arity>::priority_queue(
+    std::initializer_list<value_type> const &items, const Compare &comp)
+    : data_(items), comp(comp) {
+  heapify();
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+template <typename InputIt>
+priority_queue<T, Compare, Arity>::priority_queue(InputIt first,
+                                                  InputIt last,
+                                                  const Compare &comp)
+    : comp(comp) {
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+    data_.reserve(std::distance(first, last));
+  }
+  for (; first != last; ++first) data_.push_back(*first);
+  heapify();
+}
+
+// assignment
+template <typename T, typename Compare, std::size_t Arity>
+priority_queue<T, Compare, Arity> &priority_queue<T, Compare, Arity>::operator=(
+    priority_queue &&other) {
+  if (this != &other) {
+    data_ = std::move(other.data_);
+    comp = std::move(other.comp);
+  }
+  return *this;
+}
+
+// element access
+template <typename T, typename Compare, std::size_t Arity>
+typename priority_queue<T, Compare, Arity>::const_reference
+priority_queue<T, Compare, Arity>::top() const {
+  if (empty()) {
+    throw std::out_of_range("Top on empty priority_queue");
+  }
+  return data_.front();
+}
+
+// modifiers
+template <typename T, typename Compare, std::size_t Arity>
+void priority_queue<T, Compare, Arity>::push(const_reference value) {
+  // value may be top() or another element, so it is copied before the
+  // heap can grow out from under it
+  push(value_type(value));
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+void priority_queue<T, Compare, Arity>::push(value_type &&value) {
+  data_.push_back(std::move(value));
+  sift_up(data_.size() - 1);
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+template <typename... Args>
+void priority_queue<T, Compare, Arity>::emplace(Args &&...args) {
+  push(value_type(std::forward<Args>(args)...));
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+template <typename InputIt>
+void priority_queue<T, Compare, Arity>::push_many(InputIt first,
+                                                  InputIt last) {
+  size_type old_size = data_.size();
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+    data_.reserve(old_size + std::distance(first, last));
+  }
+  for (; first != last; ++first) data_.push_back(*first);
+  if (data_.size() - old_size >= old_size) {
+    heapify();
+  } else {
+    for (size_type i = old_size; i < data_.size(); ++i) sift_up(i);
+  }
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+void priority_queue<T, Compare, Arity>::pop() {
+  pop_value();
+}
+
+// The last element almost always belongs near the bottom again, so rather
+// than sift it down from the root, the hole left by the top walks down
+// along the greatest children to a leaf, without comparing against the
+// element, and the element is sifted up from there. That saves about one
+// comparison per level.
+template <typename T, typename Compare, std::size_t Arity>
+typename priority_queue<T, Compare, Arity>::value_type
+priority_queue<T, Compare, Arity>::pop_value() {
+  if (empty()) {
+    throw std::out_of_range("Pop on empty priority_queue");
+  }
+  T *heap = data_.data();
+  value_type top = std::move(heap[0]);
+  size_type n = data_.size() - 1;
+  size_type hole = 0;
+  for (size_type first = 1; first < n; first = hole * Arity + 1) {
+    size_type last = first + Arity < n ? first + Arity : n;
+    size_type best = first;
+    for (size_type child = first + 1; child < last; ++child) {
+      if (comp(heap[best], heap[child])) best = child;
+    }
+    heap[hole] = std::move(heap[best]);
+    hole = best;
+  }
+  if (hole != n) {
+    heap[hole] = std::move(heap[n]);
+    sift_up(hole);
+  }
+  data_.pop_back();
+  return top;
+}
+
+template <typename T, typename Compare, std::size_t Arity>
+void priority_queue<T, Compare, Arity>::swap(priority_queue &other) {
+  data_.swap(other.data_);
+  std::swap(comp, other.comp);
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_CONTAINERSPLUS_S21_PRIORITY_QUEUE_TPP_
@@ -0,0 +1,94 @@
+#ifndef SRC_S21_CONTAINERSPLUS_S21_SPSC_QUEUE_H_
+#define SRC_S21_CONTAINERSPLUS_S21_SPSC_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+
+// Bounded lock-free FIFO queue between exactly one producer thread and one
+// consumer thread. The producer calls push, emplace and push_many; the
+// consumer calls empty, front, pop, try_pop and pop_many.
+//
+// head and tail count every element ever popped and pushed, and an element
+// lives in slot index & mask. Each side keeps its own index with a copy of
+// the other side's index on its own cache line. That copy is refreshed only
+// when it makes the queue look full or empty, so in the steady state a push
+// or pop touches no line the other thread writes. The batch calls publish
+// their whole batch with one store.
+template <typename T>
+class spsc_queue {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = std::size_t;
+
+  // constructors
+  // room for capacity elements, rounded up to a power of two
+  explicit spsc_queue(size_type capacity);
+  spsc_queue(const spsc_queue&) = delete;
+  spsc_queue& operator=(const spsc_queue&) = delete;
+
+  // destructor
+  ~spsc_queue();
+
+  // capacity
+  size_type capacity() const { return mask_ + 1; }
+  // consumer side: true if nothing is ready to pop
+  bool empty();
+
+  // producer side; each returns false, leaving the queue and its argument
+  // as they were, if the queue is full
+  bool push(const_reference value);
+  bool push(value_type&& value);
+  template <typename... Args>
+  bool emplace(Args&&... args);
+  // pushes from the range until it ends or the queue fills; returns the
+  // first element that was not pushed
+  template <typename InputIt>
+  InputIt push_many(InputIt first, InputIt last);
+
+  // consumer side
+  // the oldest element; throws std::out_of_range if the queue is empty
+  reference front();
+  // removes the oldest element; throws std::out_of_range if it is empty
+  void pop();
+  // moves the oldest element into value; false if the queue was empty
+  bool try_pop(reference value);
+  // pops up to max elements into out, oldest first; returns the end of out
+  template <typename OutputIt>
+  OutputIt pop_many(OutputIt out, size_type max);
+
+ private:
+  static constexpr size_type kCacheLine = 64;
+
+  struct alignas(kCacheLine) Producer {
+    std::atomic<size_type> tail{0};
+    size_type cached_head = 0;
+  };
+  struct alignas(kCacheLine) Consumer {
+    std::atomic<size_type> head{0};
+    size_type cached_tail = 0;
+  };
+
+  T* slots_;
+  size_type mask_;
+  Producer producer_;
+  Consumer consumer_;
+
+  T* slot(size_type index) const { return slots_ + (index & mask_); }
+  // producer side: free slots, at most wanted unless fewer are free
+  size_type room(size_type tail, size_type wanted);
+  // consumer side: elements ready to pop
+  size_type ready(size_type head);
+};
+
+}  // namespace s21
+
+#include "s21_spsc_queue.tpp"
+
+#endif  // SRC_S21_CONTAINERSPLUS_S21_SPSC_QUEUE_H_
@@ -0,0 +1,151 @@
+#ifndef SRC_S21_CONTAINERSPLUS_S21_SPSC_QUEUE_TPP_
+#define SRC_S21_CONTAINERSPLUS_S21_SPSC_QUEUE_TPP_
+
+#include "s21_spsc_queue.h"
+
+namespace s21 {
+
+// helper methods
+template <typename T>
+typename spsc_queue<T>::size_type spsc_queue<T>::room(size_type tail,
+                                                      size_type wanted) {
+  size_type free = capacity() - (tail - producer_.cached_head);
+  if (free < wanted) {
+    producer_.cached_head = consumer_.head.load(std::memory_order_acquire);
+    free = capacity() - (tail - producer_.cached_head);
+  }
+  return free;
+}
+
+template <typename T>
+typename spsc_queue<T>::size_type spsc_queue<T>::ready(size_type head) {
+  if (consumer_.cached_tail == head) {
+    consumer_.cached_tail = producer_.tail.load(std::memory_order_acquire);
+  }
+  return consumer_.cached_tail - head;
+}
+
+// constructors
+template <typename T>
+spsc_queue<T>::spsc_queue(size_type capacity) {
+  size_type rounded = 1;
+  while (rounded < capacity) rounded *= 2;
+  slots_ = static_cast<T*>(::operator new(sizeof(T) * rounded));
+  mask_ = rounded - 1;
+}
+
+// destructor
+template <typename T>
+spsc_queue<T>::~spsc_queue() {
+  size_type tail = producer_.tail.load(std::memory_order_acquire);
+  for (size_type i = consumer_.head.load(std::memory_order_relaxed);
+       i != tail; ++i) {
+    slot(i)->~T();
+  }
+  ::operator delete(slots_);
+}
+
+// capacity
+template <typename T>
+bool spsc_queue<T>::empty() {
+  return ready(consumer_.head.load(std::memory_order_relaxed)) == 0;
+}
+
+// producer side
+template <typename T>
+bool spsc_queue<T>::push(const_reference value) {
+  return emplace(value);
+}
+
+template <typename T>
+bool spsc_queue<T>::push(value_type&& value) {
+  return emplace(std::move(value));
+}
+
+template <typename T>
+template <typename... Args>
+bool spsc_queue<T>::emplace(Args&&... args) {
+  size_type tail = producer_.tail.load(std::memory_order_relaxed);
+  if (room(tail, 1) == 0) return false;
+  new (slot(tail)) T(std::forward<Args>(args)...);
+  producer_.tail.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+// If constructing an element throws, the ones before it are still
+// published.
+template <typename T>
+template <typename InputIt>
+InputIt spsc_queue<T>::push_many(InputIt first, InputIt last) {
+  size_type tail = producer_.tail.load(std::memory_order_relaxed);
+  size_type end = tail + room(tail, capacity());
+  try {
+    for (; tail != end && first != last; ++first, ++tail) {
+      new (slot(tail)) T(*first);
+    }
+  } catch (...) {
+    producer_.tail.store(tail, std::memory_order_release);
+    throw;
+  }
+  producer_.tail.store(tail, std::memory_order_release);
+  return first;
+}
+
+// consumer side
+template <typename T>
+typename spsc_queue<T>::reference spsc_queue<T>::front() {
+  size_type head = consumer_.head.load(std::memory_order_relaxed);
+  if (ready(head) == 0) {
+    throw std::out_of_range("Front on empty spsc_queue");
+  }
+  return *slot(head);
+}
+
+template <typename T>
+void spsc_queue<T>::pop() {
+  size_type head = consumer_.head.load(std::memory_order_relaxed);
+  if (ready(head) == 0) {
+    throw std::out_of_range("Pop on empty spsc_queue");
+  }
+  slot(head)->~T();
+  consumer_.head.store(head + 1, std::memory_order_release);
+}
+
+template <typename T>
+bool spsc_queue<T>::try_pop(reference value) {
+  size_type head = consumer_.head.load(std::memory_order_relaxed);
+  if (ready(head) == 0) return false;
+  value = std::move(*slot(head));
+  slot(head)->~T();
+  consumer_.head.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+// If moving an element out throws, that element and the ones after it
+// stay in the queue.
+template <typename T>
+template <typename OutputIt>
+OutputIt spsc_queue<T>::pop_many(OutputIt out, size_type max) {
+  size_type head = consumer_.head.load(std::memory_order_relaxed);
+  size_type available = ready(head);
+  if (available < max) {
+    consumer_.cached_tail = producer_.tail.load(std::memory_order_acquire);
+    available = consumer_.cached_tail - head;
+  }
+  size_type end = head + (available < max ? available : max);
+  try {
+    for (; head != end; ++head) {
+      *out++ = std::move(*slot(head));
+      slot(head)->~T();
+    }
+  } catch (...) {
+    consumer_.head.store(head, std::memory_order_release);
+    throw;
+  }
+  consumer_.head.store(head, std::memory_order_release);
+  return out;
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_CONTAINERSPLUS_S21_SPSC_QUEUE_TPP_
@@ -0,0 +1,111 @@
+#ifndef SRC_S21_CONTAINERSPLUS_S21_STATIC_MAP_H_
+#define SRC_S21_CONTAINERSPLUS_S21_STATIC_MAP_H_
+
+#include "../s21_containers/s21_eytzinger.h"
+#include "../s21_containers/s21_map.h"
+
+namespace s21 {
+
+// The map counterpart of static_set: keys in Eytzinger order with the
+// values in a parallel array, built once from a range or an s21::map. The
+// set of keys is fixed, but the mapped values can still be written through
+// at() or an iterator. As with flat_map, an iterator yields a pair of
+// references rather than a reference to a stored pair.
+template <typename Key, typename Val, typename Compare = std::less<Key>>
+class static_map {
+ private:
+  using array_type = EytzingerArray<Key, Val, Compare>;
+  array_type array;
+
+ public:
+  using key_type = Key;
+  using mapped_type = Val;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using key_compare = Compare;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = typename array_type::iterator;
+  using const_iterator = typename array_type::const_iterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+  using size_type = typename array_type::size_type;
+
+  // constructors
+  static_map() = default;
+  explicit static_map(const Compare& comp) : array(comp) {}
+  static_map(std::initializer_list<value_type> const& items);
+  template <typename InputIt>
+  static_map(InputIt first, InputIt last, const Compare& comp = Compare());
+  // copies the elements of m, whatever tree it is backed by
+  template <template <typename, typename, typename> class Tree>
+  explicit static_map(map<Key, Val, Compare, Tree>& m);
+  static_map(const static_map& m) : array(m.array) {}
+  static_map(static_map&& m) : array(std::move(m.array)) {}
+
+  // destructor
+  ~static_map() = default;
+
+  // assignment
+  static_map& operator=(static_map&& m) noexcept;
+
+  // element access
+  Val& at(const Key& key);
+
+  // iterators
+  iterator begin() { return array.begin(); }
+  iterator end() { return array.end(); }
+  const_iterator cbegin() const { return array.cbegin(); }
+  const_iterator cend() const { return array.cend(); }
+  reverse_iterator rbegin() { return reverse_iterator(end()); }
+  reverse_iterator rend() { return reverse_iterator(begin()); }
+
+  // O(log n): the elements with the smallest and the largest key
+  typename iterator::reference front() { return *begin(); }
+  typename iterator::reference back() { return *--end(); }
+
+  // Capacity
+  bool empty() const { return array.empty(); }
+  size_type size() const { return array.size(); }
+  size_type max_size() const { return array.max_size(); }
+  MemoryStats memory_stats() const { return array.memory_stats(); }
+  size_type memory_usage() const { return array.memory_usage(); }
+
+  // Modifiers
+  void swap(static_map& other) { array.swap(other.array); }
+
+  // Lookup
+  iterator find(const key_type& key) { return array.find(key); }
+  bool contains(const key_type& key) const { return array.contains(key); }
+  size_type count(const key_type& key) const { return array.contains(key); }
+  iterator lower_bound(const key_type& key) { return array.lower_bound(key); }
+  iterator upper_bound(const key_type& key) { return array.upper_bound(key); }
+  std::pair<iterator, iterator> equal_range(const key_type& key) {
+    return std::make_pair(lower_bound(key), upper_bound(key));
+  }
+  // heterogeneous lookup, only with a transparent Compare such as
+  // std::less<>
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K& key) {
+    return array.find(key);
+  }
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K& key) const {
+    return array.contains(key);
+  }
+  // as in map: lookups of many keys at once, in interleaved batches
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out);
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt contains_many(ForwardIt first, ForwardIt last, OutputIt out);
+
+  // Observers
+  key_compare key_comp() const { return array.key_comp(); }
+};
+
+}  // namespace s21
+
+#include "s21_static_map.tpp"
+
+#endif  // SRC_S21_CONTAINERSPLUS_S21_STATIC_MAP_H_
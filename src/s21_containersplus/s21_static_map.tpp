@@ -0,0 +1,68 @@
+#ifndef SRC_S21_CONTAINERSPLUS_S21_STATIC_MAP_TPP_
+#define SRC_S21_CONTAINERSPLUS_S21_STATIC_MAP_TPP_
+
+#include "s21_static_map.h"
+
+namespace s21 {
+
+template <typename Key, typename Val, typename Compare>
+static_map<Key, Val, Compare>::static_map(
+    std::initializer_list<value_type> const& items) {
+  array.assign(items.begin(), items.end());
+}
+
+template <typename Key, typename Val, typename Compare>
+template <typename InputIt>
+static_map<Key, Val, Compare>::static_map(InputIt first, InputIt last,
+                                          const Compare& comp)
+    : array(comp) {
+  array.assign(first, last);
+}
+
+// The elements of a map come sorted, so they are laid out in a single pass.
+template <typename Key, typename Val, typename Compare>
+template <template <typename, typename, typename> class Tree>
+static_map<Key, Val, Compare>::static_map(map<Key, Val, Compare, Tree>& m)
+    : array(m.key_comp()) {
+  array.assign(m.begin(), m.end());
+}
+
+template <typename Key, typename Val, typename Compare>
+static_map<Key, Val, Compare>& static_map<Key, Val, Compare>::operator=(
+    static_map&& m) noexcept {
+  if (this != &m) {
+    array = std::move(m.array);
+  }
+  return *this;
+}
+
+template <typename Key, typename Val, typename Compare>
+Val& static_map<Key, Val, Compare>::at(const Key& key) {
+  iterator res = array.find(key);
+  if (res == end()) throw std::out_of_range("key not found");
+  return (*res).second;
+}
+
+template <typename Key, typename Val, typename Compare>
+template <typename ForwardIt, typename OutputIt>
+OutputIt static_map<Key, Val, Compare>::find_many(ForwardIt first,
+                                                  ForwardIt last,
+                                                  OutputIt out) {
+  array.find_many(first, last, [&out](iterator it) { *out++ = it; });
+  return out;
+}
+
+template <typename Key, typename Val, typename Compare>
+template <typename ForwardIt, typename OutputIt>
+OutputIt static_map<Key, Val, Compare>::contains_many(ForwardIt first,
+                                                      ForwardIt last,
+                                                      OutputIt out) {
+  iterator none = array.end();
+  array.find_many(first, last,
+                  [&out, none](iterator it) { *out++ = it != none; });
+  return out;
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_CONTAINERSPLUS_S21_STATIC_MAP_TPP_
@@ -0,0 +1,159 @@
+#ifndef SRC_S21_CONTAINERSPLUS_S21_STATIC_SET_H_
+#define SRC_S21_CONTAINERSPLUS_S21_STATIC_SET_H_
+
+#include "../s21_containers/s21_eytzinger.h"
+#include "../s21_containers/s21_set.h"
+
+namespace s21 {
+
+// Read-only set for lookup tables that are built once and then queried
+// many times. The keys are stored in Eytzinger order (see EytzingerArray),
+// which keeps lookups in cache far better than a tree or a sorted array
+// once the table outgrows L2. It is built from a range in any order, a
+// sorted one costing a single pass, or from an s21::set; the only way to
+// change it afterwards is to assign a new one. Iteration is in key order.
+template <typename Key, typename Compare = std::less<Key>>
+class static_set {
+ private:
+  using array_type = EytzingerArray<Key, std::nullptr_t, Compare>;
+  array_type array;
+
+ public:
+  class Iterator;
+  class ConstIterator;
+  using key_type = Key;
+  using value_type = Key;
+  using key_compare = Compare;
+  using value_compare = Compare;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+  using size_type = typename array_type::size_type;
+
+  class Iterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = Key;
+    using pointer = const Key*;
+    using reference = const Key&;
+    explicit Iterator(typename array_type::Iterator it) : it_(it) {}
+    Iterator() = default;
+    Iterator& operator++() {
+      ++it_;
+      return *this;
+    }
+    Iterator operator++(int) { return Iterator(it_++); }
+    Iterator& operator--() {
+      --it_;
+      return *this;
+    }
+    Iterator operator--(int) { return Iterator(it_--); }
+    bool operator!=(const Iterator& other) const { return it_ != other.it_; }
+    bool operator==(const Iterator& other) const { return it_ == other.it_; }
+    const_reference operator*() const { return (*it_).first; }
+
+   protected:
+    typename array_type::Iterator it_;
+    friend class static_set;
+  };
+
+  class ConstIterator : public Iterator {
+   public:
+    using Iterator::Iterator;
+    ConstIterator() : Iterator(typename array_type::ConstIterator()) {}
+    const_reference operator*() const { return Iterator::operator*(); };
+    ConstIterator& operator++() {
+      Iterator::operator++();
+      return *this;
+    }
+    ConstIterator& operator--() {
+      Iterator::operator--();
+      return *this;
+    }
+  };
+
+  // constructors
+  static_set() = default;
+  explicit static_set(const Compare& comp) : array(comp) {}
+  static_set(std::initializer_list<Key> const& items);
+  template <typename InputIt>
+  static_set(InputIt first, InputIt last, const Compare& comp = Compare());
+  // copies the keys of s, whatever tree it is backed by
+  template <template <typename, typename, typename> class Tree>
+  explicit static_set(set<Key, Compare, Tree>& s);
+  static_set(const static_set& s) : array(s.array) {}
+  static_set(static_set&& s) : array(std::move(s.array)) {}
+
+  // destructor
+  ~static_set() = default;
+
+  // assignment
+  static_set& operator=(static_set&& s) noexcept;
+
+  // iterators
+  iterator begin() { return Iterator(array.begin()); }
+  iterator end() { return Iterator(array.end()); }
+  const_iterator cbegin() const { return ConstIterator(array.cbegin()); }
+  const_iterator cend() const { return ConstIterator(array.cend()); }
+  reverse_iterator rbegin() { return reverse_iterator(end()); }
+  reverse_iterator rend() { return reverse_iterator(begin()); }
+
+  // element access, O(log n): the smallest and the largest key
+  const_reference front() { return *begin(); }
+  const_reference back() { return *--end(); }
+
+  // Capacity
+  bool empty() const { return array.empty(); }
+  size_type size() const { return array.size(); }
+  size_type max_size() const { return array.max_size(); }
+  MemoryStats memory_stats() const { return array.memory_stats(); }
+  size_type memory_usage() const { return array.memory_usage(); }
+
+  // Modifiers
+  void swap(static_set& other) { array.swap(other.array); }
+
+  // Lookup
+  iterator find(const key_type& key) { return Iterator(array.find(key)); }
+  bool contains(const key_type& key) const { return array.contains(key); }
+  size_type count(const key_type& key) const { return array.contains(key); }
+  iterator lower_bound(const key_type& key) {
+    return Iterator(array.lower_bound(key));
+  }
+  iterator upper_bound(const key_type& key) {
+    return Iterator(array.upper_bound(key));
+  }
+  std::pair<iterator, iterator> equal_range(const key_type& key) {
+    return std::make_pair(lower_bound(key), upper_bound(key));
+  }
+  // heterogeneous lookup, only with a transparent Compare such as
+  // std::less<>
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K& key) {
+    return Iterator(array.find(key));
+  }
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K& key) const {
+    return array.contains(key);
+  }
+  // as in set: lookups of many keys at once, in interleaved batches
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt find_many(ForwardIt first, ForwardIt last, OutputIt out);
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt contains_many(ForwardIt first, ForwardIt last, OutputIt out);
+
+  // Observers
+  key_compare key_comp() const { return array.key_comp(); }
+  value_compare value_comp() const { return array.key_comp(); }
+};
+
+}  // namespace s21
+
+#include "s21_static_set.tpp"
+
+#endif  // SRC_S21_CONTAINERSPLUS_S21_STATIC_SET_H_
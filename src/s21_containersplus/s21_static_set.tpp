@@ -0,0 +1,62 @@
+#ifndef SRC_S21_CONTAINERSPLUS_S21_STATIC_SET_TPP_
+#define SRC_S21_CONTAINERSPLUS_S21_STATIC_SET_TPP_
+
+#include "s21_static_set.h"
+
+namespace s21 {
+
+template <typename Key, typename Compare>
+static_set<Key, Compare>::static_set(std::initializer_list<Key> const& items) {
+  array.assign(items.begin(), items.end());
+}
+
+template <typename Key, typename Compare>
+template <typename InputIt>
+static_set<Key, Compare>::static_set(InputIt first, InputIt last,
+                                     const Compare& comp)
+    : array(comp) {
+  array.assign(first, last);
+}
+
+// The keys of a set come sorted, so they are laid out in a single pass.
+template <typename Key, typename Compare>
+template <template <typename, typename, typename> class Tree>
+static_set<Key, Compare>::static_set(set<Key, Compare, Tree>& s)
+    : array(s.key_comp()) {
+  array.assign(s.begin(), s.end());
+}
+
+template <typename Key, typename Compare>
+static_set<Key, Compare>& static_set<Key, Compare>::operator=(
+    static_set&& s) noexcept {
+  if (this != &s) {
+    array = std::move(s.array);
+  }
+  return *this;
+}
+
+template <typename Key, typename Compare>
+template <typename ForwardIt, typename OutputIt>
+OutputIt static_set<Key, Compare>::find_many(ForwardIt first, ForwardIt last,
+                                             OutputIt out) {
+  array.find_many(first, last, [&out](typename array_type::Iterator it) {
+    *out++ = Iterator(it);
+  });
+  return out;
+}
+
+template <typename Key, typename Compare>
+template <typename ForwardIt, typename OutputIt>
+OutputIt static_set<Key, Compare>::contains_many(ForwardIt first,
+                                                 ForwardIt last,
+                                                 OutputIt out) {
+  typename array_type::Iterator none = array.end();
+  array.find_many(first, last, [&out, none](typename array_type::Iterator it) {
+    *out++ = it != none;
+  });
+  return out;
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_CONTAINERSPLUS_S21_STATIC_SET_TPP_
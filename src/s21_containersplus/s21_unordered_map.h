@@ -0,0 +1,112 @@
+#ifndef SRC_S21_CONTAINERSPLUS_S21_UNORDERED_MAP_H_
+#define SRC_S21_CONTAINERSPLUS_S21_UNORDERED_MAP_H_
+
+#include "../s21_containers/s21_hash_table.h"
+
+namespace s21 {
+
+// Hash map with the interface of s21::map minus everything that needs an
+// order: no reverse iteration, bounds, split or join. Lookups are O(1)
+// expected; see HashTable for the layout. Iterators are forward only, and
+// any insert that grows the table or any erase invalidates them.
+template <typename Key, typename Val, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class unordered_map {
+ private:
+  using table_type = HashTable<Key, Val, Hash, KeyEqual>;
+  table_type table;
+
+ public:
+  using key_type = Key;
+  using mapped_type = Val;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = typename table_type::iterator;
+  using const_iterator = typename table_type::const_iterator;
+  using size_type = typename table_type::size_type;
+
+  // constructors
+  unordered_map() = default;
+  explicit unordered_map(size_type bucket_count, const Hash& hash = Hash(),
+                         const KeyEqual& equal = KeyEqual());
+  unordered_map(std::initializer_list<value_type> const& items);
+  template <typename InputIt>
+  unordered_map(InputIt first, InputIt last);
+  unordered_map(const unordered_map& m) : table(m.table) {}
+  unordered_map(unordered_map&& m) : table(std::move(m.table)) {}
+
+  // destructor
+  ~unordered_map() = default;
+
+  // assignment
+  unordered_map& operator=(unordered_map&& m) noexcept;
+
+  // element access
+  Val& at(const Key& key);
+  Val& operator[](const Key& key);
+  Val& operator[](Key&& key);
+
+  // iterators
+  iterator begin() { return table.begin(); }
+  iterator end() { return table.end(); }
+  const_iterator cbegin() { return table.cbegin(); }
+  const_iterator cend() { return table.cend(); }
+
+  // Capacity
+  bool empty() const { return table.empty(); }
+  size_type size() const { return table.size(); }
+  size_type max_size() const { return table.max_size(); }
+  MemoryStats memory_stats() const { return table.memory_stats(); }
+  size_type memory_usage() const { return table.memory_usage(); }
+  // makes room for n elements, so that inserting them does not rehash
+  void reserve(size_type n) { table.reserve(n); }
+
+  // Hash policy: a bucket is a slot
+  size_type bucket_count() const { return table.capacity(); }
+  float load_factor() const { return table.load_factor(); }
+  float max_load_factor() const { return table.max_load_factor(); }
+  void max_load_factor(float ml) { table.max_load_factor(ml); }
+  void rehash(size_type n) { table.rehash(n); }
+
+  // Modifiers
+  void clear() { table.clear(); }
+  std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(value_type&& value);
+  std::pair<iterator, bool> insert(const Key& key, const Val& obj);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  // the mapped value is built from args only when key is not there yet
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args);
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(const Key& key, M&& obj);
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(Key&& key, M&& obj);
+  void erase(iterator pos) { table.erase(pos); }
+  size_type erase(const key_type& key) { return table.erase(key); }
+  void swap(unordered_map& other) { table.swap(other.table); }
+  void merge(unordered_map& other) { table.merge(other.table); }
+
+  // Lookup
+  bool contains(const key_type& key) const { return table.contains(key); }
+  iterator find(const key_type& key) { return table.find(key); }
+
+  // Observers
+  hasher hash_function() const { return table.hash_function(); }
+  key_equal key_eq() const { return table.key_eq(); }
+
+  // part 3
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args&&... args);
+};
+
+}  // namespace s21
+
+#include "s21_unordered_map.tpp"
+
+#endif  // SRC_S21_CONTAINERSPLUS_S21_UNORDERED_MAP_H_
@@ -0,0 +1,139 @@
+#ifndef SRC_S21_CONTAINERSPLUS_S21_UNORDERED_MAP_TPP_
+#define SRC_S21_CONTAINERSPLUS_S21_UNORDERED_MAP_TPP_
+
+#include "s21_unordered_map.h"
+
+namespace s21 {
+
+template <typename Key, typename Val, typename Hash, typename KeyEqual>
+unordered_map<Key, Val, Hash, KeyEqual>::unordered_map(
+    size_type bucket_count, const Hash& hash, const KeyEqual& equal)
+    : table(hash, equal) {
+  table.rehash(bucket_count);
+}
+
+template <typename Key, typename Val, typename Hash, typename KeyEqual>
+unordered_map<Key, Val, Hash, KeyEqual>::unordered_map(
+    std::initializer_list<value_type> const& items) {
+  table.reserve(items.size());
+  for (const value_type& item : items) insert(item);
+}
+
+template <typename Key, typename Val, typename Hash, typename KeyEqual>
+template <typename InputIt>
+unordered_map<Key, Val, Hash, KeyEqual>::unordered_map(InputIt first,
+                                                       InputIt last) {
+  for (; first != last; ++first) insert(*first);
+}
+
+template <typename Key, typename Val, typename Hash, typename KeyEqual>
+unordered_map<Key, Val, Hash, KeyEqual>&
+unordered_map<Key, Val, Hash, KeyEqual>::operator=(unordered_map&& m) noexcept {
+  if (this != &m) {
+    table = std::move(m.table);
+  }
+  return *this;
+}
+
+template <typename Key, typename Val, typename Hash, typename KeyEqual>
+Val& unordered_map<Key, Val, Hash, KeyEqual>::at(const Key& key) {
+  auto res = table.find(key);
+  if (res == end()) throw std::out_of_range("key not found");
+  return (*res).second;
+}
+
+template <typename Key, typename Val, typename Hash, typename KeyEqual>
+Val& unordered_map<Key, Val, Hash, KeyEqual>::operator[](const Key& key) {
+  return (*table.try_emplace(key).first).second;
+}
+
+template <typename Key, typename Val, typename Hash, typename KeyEqual>
+Val& unordered_map<Key, Val, Hash, KeyEqual>::operator[](Key&& key) {
+  return (*table.try_emplace(std::move(key)).first).second;
+}
+
+template <typename Key, typename Val, typename Hash, typename KeyEqual>
+std::pair<typename unordered_map<Key, Val, Hash, KeyEqual>::iterator, bool>
+unordered_map<Key, Val, Hash, KeyEqual>::insert(const value_type& value) {
+  return table.try_emplace(value.first, value.second);
+}
+
+// The key is const, so only the mapped value can be moved.
+template <typename Key, typename Val, typename Hash, typename KeyEqual>
+std::pair<typename unordered_map<Key, Val, Hash, KeyEqual>::iterator, bool>
+unordered_map<Key, Val, Hash, KeyEqual>::insert(value_type&& value) {
+  return table.try_emplace(value.first, std::move(value.second));
+}
+
+template <typename Key, typename Val, typename Hash, typename KeyEqual>
+std::pair<typename unordered_map<Key, Val, Hash, KeyEqual>::iterator, bool>
+unordered_map<Key, Val, Hash, KeyEqual>::insert(const Key& key,
+                                                const Val& obj) {
+  return table.try_emplace(key, obj);
+}
+
+template <typename Key, typename Val, typename Hash, typename KeyEqual>
+template <typename... Args>
+std::pair<typename unordered_map<Key, Val, Hash, KeyEqual>::iterator, bool>
+unordered_map<Key, Val, Hash, KeyEqual>::emplace(Args&&... args) {
+  return table.emplace(std::forward<Args>(args)...);
+}
+
+template <typename Key, typename Val, typename Hash, typename KeyEqual>
+template <typename... Args>
+std::pair<typename unordered_map<Key, Val, Hash, KeyEqual>::iterator, bool>
+unordered_map<Key, Val, Hash, KeyEqual>::try_emplace(const Key& key,
+                                                     Args&&... args) {
+  return table.try_emplace(key, std::forward<Args>(args)...);
+}
+
+template <typename Key, typename Val, typename Hash, typename KeyEqual>
+template <typename... Args>
+std::pair<typename unordered_map<Key, Val, Hash, KeyEqual>::iterator, bool>
+unordered_map<Key, Val, Hash, KeyEqual>::try_emplace(Key&& key,
+                                                     Args&&... args) {
+  return table.try_emplace(std::move(key), std::forward<Args>(args)...);
+}
+
+// obj is consumed by exactly one of the two branches: try_emplace only
+// touches it when it creates the element.
+template <typename Key, typename Val, typename Hash, typename KeyEqual>
+template <typename M>
+std::pair<typename unordered_map<Key, Val, Hash, KeyEqual>::iterator, bool>
+unordered_map<Key, Val, Hash, KeyEqual>::insert_or_assign(const Key& key,
+                                                          M&& obj) {
+  auto res = table.try_emplace(key, std::forward<M>(obj));
+  if (!res.second) {
+    (*res.first).second = std::forward<M>(obj);
+  }
+  return res;
+}
+
+template <typename Key, typename Val, typename Hash, typename KeyEqual>
+template <typename M>
+std::pair<typename unordered_map<Key, Val, Hash, KeyEqual>::iterator, bool>
+unordered_map<Key, Val, Hash, KeyEqual>::insert_or_assign(Key&& key,
+                                                          M&& obj) {
+  auto res = table.try_emplace(std::move(key), std::forward<M>(obj));
+  if (!res.second) {
+    (*res.first).second = std::forward<M>(obj);
+  }
+  return res;
+}
+
+// Room for every argument is made up front, so no insert rehashes and the
+// returned iterators all stay valid.
+template <typename Key, typename Val, typename Hash, typename KeyEqual>
+template <typename... Args>
+vector<std::pair<typename unordered_map<Key, Val, Hash, KeyEqual>::iterator,
+                 bool>>
+unordered_map<Key, Val, Hash, KeyEqual>::insert_many(Args&&... args) {
+  table.reserve(size() + sizeof...(Args));
+  vector<std::pair<iterator, bool>> result;
+  (result.push_back(insert(std::forward<Args>(args))), ...);
+  return result;
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_CONTAINERSPLUS_S21_UNORDERED_MAP_TPP_
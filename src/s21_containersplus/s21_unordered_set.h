@@ -0,0 +1,132 @@
+#ifndef SRC_S21_CONTAINERSPLUS_S21_UNORDERED_SET_H_
+#define SRC_S21_CONTAINERSPLUS_S21_UNORDERED_SET_H_
+
+#include "../s21_containers/s21_hash_table.h"
+
+namespace s21 {
+
+// Hash set with the interface of s21::set minus everything that needs an
+// order. Lookups are O(1) expected; see HashTable for the layout. Iterators
+// are forward only, and any insert that grows the table or any erase
+// invalidates them.
+template <typename Key, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class unordered_set {
+ private:
+  using table_type = HashTable<Key, std::nullptr_t, Hash, KeyEqual>;
+  table_type table;
+
+ public:
+  class Iterator;
+  class ConstIterator;
+  using key_type = Key;
+  using value_type = Key;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+  using size_type = typename table_type::size_type;
+
+  class Iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = Key;
+    using pointer = const Key*;
+    using reference = const Key&;
+    explicit Iterator(typename table_type::Iterator it) : it_(it) {}
+    Iterator() = default;
+    Iterator& operator++() {
+      ++it_;
+      return *this;
+    }
+    Iterator operator++(int) { return Iterator(it_++); }
+    bool operator!=(const Iterator& other) const { return it_ != other.it_; }
+    bool operator==(const Iterator& other) const { return it_ == other.it_; }
+    const_reference operator*() const { return (*it_).first; }
+
+   protected:
+    typename table_type::Iterator it_;
+    friend class unordered_set;
+  };
+
+  class ConstIterator : public Iterator {
+   public:
+    using Iterator::Iterator;
+    ConstIterator() : Iterator(typename table_type::ConstIterator()) {}
+    const_reference operator*() const { return Iterator::operator*(); };
+    ConstIterator& operator++() {
+      Iterator::operator++();
+      return *this;
+    }
+  };
+
+  // constructors
+  unordered_set() = default;
+  explicit unordered_set(size_type bucket_count, const Hash& hash = Hash(),
+                         const KeyEqual& equal = KeyEqual());
+  unordered_set(std::initializer_list<Key> const& items);
+  template <typename InputIt>
+  unordered_set(InputIt first, InputIt last);
+  unordered_set(const unordered_set& s) : table(s.table) {}
+  unordered_set(unordered_set&& s) : table(std::move(s.table)) {}
+
+  // destructor
+  ~unordered_set() = default;
+
+  // assignment
+  unordered_set& operator=(unordered_set&& s) noexcept;
+
+  // iterators
+  iterator begin() { return Iterator(table.begin()); }
+  iterator end() { return Iterator(table.end()); }
+  const_iterator cbegin() { return ConstIterator(table.cbegin()); }
+  const_iterator cend() { return ConstIterator(table.cend()); }
+
+  // Capacity
+  bool empty() const { return table.empty(); }
+  size_type size() const { return table.size(); }
+  size_type max_size() const { return table.max_size(); }
+  MemoryStats memory_stats() const { return table.memory_stats(); }
+  size_type memory_usage() const { return table.memory_usage(); }
+  // makes room for n elements, so that inserting them does not rehash
+  void reserve(size_type n) { table.reserve(n); }
+
+  // Hash policy: a bucket is a slot
+  size_type bucket_count() const { return table.capacity(); }
+  float load_factor() const { return table.load_factor(); }
+  float max_load_factor() const { return table.max_load_factor(); }
+  void max_load_factor(float ml) { table.max_load_factor(ml); }
+  void rehash(size_type n) { table.rehash(n); }
+
+  // Modifiers
+  void clear() { table.clear(); }
+  std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(value_type&& value);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args);
+  void erase(iterator pos) { table.erase(pos.it_); }
+  size_type erase(const key_type& key) { return table.erase(key); }
+  void swap(unordered_set& other) { table.swap(other.table); }
+  void merge(unordered_set& other) { table.merge(other.table); }
+
+  // Lookup
+  iterator find(const key_type& key) { return Iterator(table.find(key)); }
+  bool contains(const key_type& key) const { return table.contains(key); }
+
+  // Observers
+  hasher hash_function() const { return table.hash_function(); }
+  key_equal key_eq() const { return table.key_eq(); }
+
+  // part 3
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args&&... args);
+};
+
+}  // namespace s21
+
+#include "s21_unordered_set.tpp"
+
+#endif  // SRC_S21_CONTAINERSPLUS_S21_UNORDERED_SET_H_
@@ -0,0 +1,74 @@
+#ifndef SRC_S21_CONTAINERSPLUS_S21_UNORDERED_SET_TPP_
+#define SRC_S21_CONTAINERSPLUS_S21_UNORDERED_SET_TPP_
+
+#include "s21_unordered_set.h"
+
+namespace s21 {
+
+template <typename Key, typename Hash, typename KeyEqual>
+unordered_set<Key, Hash, KeyEqual>::unordered_set(size_type bucket_count,
+                                                  const Hash& hash,
+                                                  const KeyEqual& equal)
+    : table(hash, equal) {
+  table.rehash(bucket_count);
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+unordered_set<Key, Hash, KeyEqual>::unordered_set(
+    std::initializer_list<Key> const& items) {
+  table.reserve(items.size());
+  for (const Key& item : items) insert(item);
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+template <typename InputIt>
+unordered_set<Key, Hash, KeyEqual>::unordered_set(InputIt first,
+                                                  InputIt last) {
+  for (; first != last; ++first) insert(*first);
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+unordered_set<Key, Hash, KeyEqual>&
+unordered_set<Key, Hash, KeyEqual>::operator=(unordered_set&& s) noexcept {
+  if (this != &s) {
+    table = std::move(s.table);
+  }
+  return *this;
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+std::pair<typename unordered_set<Key, Hash, KeyEqual>::iterator, bool>
+unordered_set<Key, Hash, KeyEqual>::insert(const value_type& value) {
+  auto iter = table.try_emplace(value);
+  return std::make_pair(Iterator(iter.first), iter.second);
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+std::pair<typename unordered_set<Key, Hash, KeyEqual>::iterator, bool>
+unordered_set<Key, Hash, KeyEqual>::insert(value_type&& value) {
+  auto iter = table.try_emplace(std::move(value));
+  return std::make_pair(Iterator(iter.first), iter.second);
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+template <typename... Args>
+std::pair<typename unordered_set<Key, Hash, KeyEqual>::iterator, bool>
+unordered_set<Key, Hash, KeyEqual>::emplace(Args&&... args) {
+  return insert(value_type(std::forward<Args>(args)...));
+}
+
+// Room for every argument is made up front, so no insert rehashes and the
+// returned iterators all stay valid.
+template <typename Key, typename Hash, typename KeyEqual>
+template <typename... Args>
+vector<std::pair<typename unordered_set<Key, Hash, KeyEqual>::iterator, bool>>
+unordered_set<Key, Hash, KeyEqual>::insert_many(Args&&... args) {
+  table.reserve(size() + sizeof...(Args));
+  vector<std::pair<iterator, bool>> result;
+  (result.push_back(insert(std::forward<Args>(args))), ...);
+  return result;
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_CONTAINERSPLUS_S21_UNORDERED_SET_TPP_
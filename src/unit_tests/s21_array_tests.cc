@@ -235,6 +235,15 @@ TEST(TestArray, MaxSize) {
   EXPECT_EQ(arr.max_size(), 5);
 }
 
+TEST(TestArray, MemoryStats) {
+  s21::array<int, 5> arr;
+  s21::MemoryStats stats = arr.memory_stats();
+
+  EXPECT_EQ(stats.payload, 5 * sizeof(int));
+  EXPECT_EQ(stats.allocations, 0U);
+  EXPECT_EQ(arr.memory_usage(), sizeof(arr));
+}
+
 //////////////////////////////// operations
 
 TEST(TestArray, Fill) {
@@ -0,0 +1,86 @@
+#include <memory>
+#include <string>
+
+#include "s21_gtests.h"
+
+TEST(CircularBuffer, Push_Pop_Both_Ends) {
+  s21::circular_buffer<std::string> buf = {"a", "b", "c"};
+  EXPECT_EQ(buf.size(), size_t(3));
+  EXPECT_EQ(buf.capacity(), size_t(8));
+  buf.push_back("d");
+  buf.emplace_back(2, 'e');
+  EXPECT_EQ(buf.front(), "a");
+  EXPECT_EQ(buf.back(), "ee");
+  buf.pop_front();
+  buf.pop_back();
+  EXPECT_EQ(buf.front(), "b");
+  EXPECT_EQ(buf.back(), "d");
+  EXPECT_EQ(buf[1], "c");
+  EXPECT_THROW(buf.at(3), std::out_of_range);
+  buf.clear();
+  EXPECT_TRUE(buf.empty());
+  EXPECT_THROW(buf.front(), std::out_of_range);
+  EXPECT_EQ(buf.capacity(), size_t(8));
+}
+
+TEST(CircularBuffer, Wraps_And_Grows) {
+  s21::circular_buffer<int> buf;
+  for (int i = 0; i < 6; ++i) buf.push_back(i);
+  for (int i = 0; i < 5; ++i) buf.pop_front();
+  // the live range now runs past the end of the block and back to slot 0
+  for (int i = 6; i < 12; ++i) buf.push_back(i);
+  EXPECT_EQ(buf.capacity(), size_t(8));
+  for (int i = 12; i < 20; ++i) buf.push_back(i);
+  EXPECT_EQ(buf.capacity(), size_t(16));
+  ASSERT_EQ(buf.size(), size_t(15));
+  for (int i = 0; i < 15; ++i) {
+    EXPECT_EQ(buf[i], i + 5);
+  }
+}
+
+TEST(CircularBuffer, Copy_Move_Swap) {
+  s21::circular_buffer<int> buf = {1, 2, 3};
+  buf.pop_front();
+  buf.insert_many_back(4, 5);
+  s21::circular_buffer<int> copy(buf);
+  s21::circular_buffer<int> moved(std::move(buf));
+  EXPECT_TRUE(buf.empty());
+  EXPECT_EQ(buf.capacity(), size_t(0));
+  ASSERT_EQ(copy.size(), size_t(4));
+  for (size_t i = 0; i < copy.size(); ++i) {
+    EXPECT_EQ(copy[i], moved[i]);
+  }
+  s21::circular_buffer<int> other = {9};
+  other.swap(copy);
+  EXPECT_EQ(other.front(), 2);
+  EXPECT_EQ(copy.front(), 9);
+  copy = std::move(other);
+  EXPECT_EQ(copy.back(), 5);
+}
+
+TEST(CircularBuffer, Self_Reference_On_Growth) {
+  s21::circular_buffer<std::string> buf;
+  for (int i = 0; i < 8; ++i) buf.push_back(std::string(20, 'a' + i));
+  buf.push_back(buf.front());
+  EXPECT_EQ(buf.back(), std::string(20, 'a'));
+}
+
+TEST(CircularBuffer, Insert_Many_Self_Reference) {
+  s21::circular_buffer<std::string> buf;
+  for (int i = 0; i < 8; ++i) buf.push_back(std::string(40, 'a' + i));
+  buf.insert_many_back(buf.front(), buf.back());
+  ASSERT_EQ(buf.size(), size_t(10));
+  EXPECT_EQ(buf[8], std::string(40, 'a'));
+  EXPECT_EQ(buf[9], std::string(40, 'h'));
+}
+
+TEST(CircularBuffer, Memory_Stats) {
+  s21::circular_buffer<std::unique_ptr<int>> buf;
+  EXPECT_EQ(buf.memory_stats().allocations, size_t(0));
+  EXPECT_EQ(buf.memory_usage(), sizeof(buf));
+  buf.emplace_back(new int(1));
+  s21::MemoryStats stats = buf.memory_stats();
+  EXPECT_EQ(stats.payload, sizeof(std::unique_ptr<int>));
+  EXPECT_EQ(stats.total(), sizeof(buf) + 8 * sizeof(std::unique_ptr<int>));
+  EXPECT_EQ(stats.allocations, size_t(1));
+}
@@ -0,0 +1,86 @@
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "s21_gtests.h"
+
+TEST(concurrent_stack, Single_Thread) {
+  s21::concurrent_stack<std::string> st;
+  EXPECT_TRUE(st.empty());
+  std::string value;
+  EXPECT_FALSE(st.try_pop(value));
+
+  st.push("a");
+  std::string b = "b";
+  st.push(b);
+  st.emplace(3, 'c');
+  EXPECT_FALSE(st.empty());
+  ASSERT_TRUE(st.try_pop(value));
+  EXPECT_EQ(value, "ccc");
+  ASSERT_TRUE(st.try_pop(value));
+  EXPECT_EQ(value, "b");
+  ASSERT_TRUE(st.try_pop(value));
+  EXPECT_EQ(value, "a");
+  EXPECT_FALSE(st.try_pop(value));
+  EXPECT_TRUE(st.empty());
+}
+
+TEST(concurrent_stack, Batches) {
+  s21::concurrent_stack<int> st = {1, 2, 3};
+  std::vector<int> more = {4, 5, 6, 7};
+  st.push_many(more.begin(), more.end());
+  st.push_many(more.end(), more.end());
+
+  std::vector<int> out;
+  st.pop_many(std::back_inserter(out), 2);
+  EXPECT_EQ(out, (std::vector<int>{7, 6}));
+  st.pop_all(std::back_inserter(out));
+  EXPECT_EQ(out, (std::vector<int>{7, 6, 5, 4, 3, 2, 1}));
+  EXPECT_TRUE(st.empty());
+  out.clear();
+  st.pop_many(std::back_inserter(out), 5);
+  EXPECT_TRUE(out.empty());
+}
+
+TEST(concurrent_stack, Move_Only) {
+  s21::concurrent_stack<std::unique_ptr<int>> st;
+  st.push(std::make_unique<int>(1));
+  st.emplace(new int(2));
+  std::unique_ptr<int> top;
+  ASSERT_TRUE(st.try_pop(top));
+  EXPECT_EQ(*top, 2);
+  // the destructor frees what is left
+}
+
+TEST(concurrent_stack, Threads) {
+  const int kThreads = 4;
+  const int kPerThread = 20000;
+  s21::concurrent_stack<int> st;
+  std::vector<std::vector<int>> popped(kThreads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&st, &popped, t] {
+      for (int i = 0; i < kPerThread; ++i) {
+        st.push(t * kPerThread + i);
+        int value;
+        if (i % 3 != 0 && st.try_pop(value)) popped[t].push_back(value);
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+
+  std::vector<int> all;
+  st.pop_all(std::back_inserter(all));
+  for (const auto &part : popped) {
+    all.insert(all.end(), part.begin(), part.end());
+  }
+  std::sort(all.begin(), all.end());
+  ASSERT_EQ(all.size(), size_t(kThreads * kPerThread));
+  for (int i = 0; i < kThreads * kPerThread; ++i) {
+    ASSERT_EQ(all[i], i);
+  }
+}
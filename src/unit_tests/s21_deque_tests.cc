@@ -0,0 +1,167 @@
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "s21_gtests.h"
+
+TEST(Deque, Against_Std_Deque) {
+  s21::deque<int> ours;
+  std::deque<int> theirs;
+  std::mt19937 gen(5);
+  for (int step = 0; step < 40000; ++step) {
+    int action = gen() % 12;
+    int value = gen() % 1000;
+    if (action < 3) {
+      ours.push_back(value);
+      theirs.push_back(value);
+    } else if (action < 6) {
+      ours.push_front(value);
+      theirs.push_front(value);
+    } else if (action < 8 && !theirs.empty()) {
+      ours.pop_back();
+      theirs.pop_back();
+    } else if (action < 10 && !theirs.empty()) {
+      ours.pop_front();
+      theirs.pop_front();
+    } else if (action == 10) {
+      size_t at = gen() % (theirs.size() + 1);
+      ours.insert(ours.begin() + at, value);
+      theirs.insert(theirs.begin() + at, value);
+    } else if (!theirs.empty()) {
+      size_t at = gen() % theirs.size();
+      ours.erase(ours.begin() + at);
+      theirs.erase(theirs.begin() + at);
+    }
+    ASSERT_EQ(ours.size(), theirs.size());
+    if (!theirs.empty()) {
+      ASSERT_EQ(ours.front(), theirs.front());
+      ASSERT_EQ(ours.back(), theirs.back());
+      size_t at = gen() % theirs.size();
+      ASSERT_EQ(ours[at], theirs[at]);
+    }
+  }
+  ASSERT_TRUE(std::equal(ours.begin(), ours.end(), theirs.begin(),
+                         theirs.end()));
+}
+
+TEST(Deque, Elements_Stay_Put) {
+  s21::deque<int> d;
+  d.push_back(0);
+  int *first = &d.front();
+  for (int i = 1; i < 100000; ++i) {
+    if (i % 2) {
+      d.push_back(i);
+    } else {
+      d.push_front(i);
+    }
+  }
+  EXPECT_EQ(*first, 0);
+  EXPECT_EQ(first, &d[49999]);
+}
+
+TEST(Deque, As_A_Queue_Reuses_Blocks) {
+  s21::deque<long> d;
+  for (long i = 0; i < 1000; ++i) d.push_back(i);
+  size_t warm = d.memory_stats().allocations;
+  // the window slides far past where it started without new blocks
+  for (long i = 1000; i < 200000; ++i) {
+    d.push_back(i);
+    d.pop_front();
+  }
+  EXPECT_LE(d.memory_stats().allocations, warm + 1);
+  EXPECT_EQ(d.front(), 199000);
+  EXPECT_EQ(d.back(), 199999);
+}
+
+TEST(Deque, Iterators) {
+  s21::deque<int> d = {5, 3, 9, 1, 7};
+  std::sort(d.begin(), d.end());
+  EXPECT_EQ(std::vector<int>(d.begin(), d.end()),
+            (std::vector<int>{1, 3, 5, 7, 9}));
+  const s21::deque<int> &view = d;
+  s21::deque<int>::const_iterator it = d.begin();
+  EXPECT_EQ(it, view.cbegin());
+  EXPECT_EQ(view.end() - view.begin(), 5);
+  EXPECT_EQ(*(view.end() - 1), 9);
+  EXPECT_EQ(it[2], 5);
+  EXPECT_TRUE(view.begin() < view.end());
+  std::vector<int> reversed(std::make_reverse_iterator(d.end()),
+                            std::make_reverse_iterator(d.begin()));
+  EXPECT_EQ(reversed, (std::vector<int>{9, 7, 5, 3, 1}));
+}
+
+TEST(Deque, Access_And_Errors) {
+  s21::deque<std::string> d(3);
+  EXPECT_EQ(d.size(), size_t(3));
+  EXPECT_EQ(d[2], "");
+  d.at(1) = "mid";
+  d.emplace_front(2, 'a');
+  d.emplace_back("z");
+  EXPECT_EQ(d.front(), "aa");
+  EXPECT_EQ(d[2], "mid");
+  EXPECT_THROW(d.at(5), std::out_of_range);
+  EXPECT_THROW(d.insert(d.begin() + 6, "x"), std::out_of_range);
+  EXPECT_THROW(d.erase(d.end()), std::out_of_range);
+  d.clear();
+  EXPECT_TRUE(d.empty());
+  EXPECT_THROW(d.front(), std::out_of_range);
+  EXPECT_THROW(d.back(), std::out_of_range);
+  d.pop_back();
+  d.pop_front();
+  EXPECT_TRUE(d.empty());
+}
+
+TEST(Deque, Copy_Move_Swap) {
+  s21::deque<int> d;
+  for (int i = 0; i < 3000; ++i) d.push_front(i);
+  s21::deque<int> copy(d);
+  s21::deque<int> moved(std::move(d));
+  EXPECT_TRUE(d.empty());
+  ASSERT_EQ(copy.size(), size_t(3000));
+  EXPECT_TRUE(std::equal(copy.begin(), copy.end(), moved.begin()));
+  s21::deque<int> other = {1, 2};
+  other.swap(copy);
+  EXPECT_EQ(copy.size(), size_t(2));
+  EXPECT_EQ(other.front(), 2999);
+  copy = std::move(other);
+  EXPECT_EQ(copy.back(), 0);
+  d.push_back(4);
+  EXPECT_EQ(d.front(), 4);
+}
+
+TEST(Deque, Part_3) {
+  s21::deque<int> d = {4};
+  d.insert_many_back(5, 6);
+  d.insert_many_front(1, 2, 3);
+  EXPECT_EQ(std::vector<int>(d.begin(), d.end()),
+            (std::vector<int>{1, 2, 3, 4, 5, 6}));
+}
+
+TEST(Deque, Move_Only) {
+  s21::deque<std::unique_ptr<int>> d;
+  d.push_back(std::make_unique<int>(2));
+  d.push_front(std::make_unique<int>(1));
+  d.insert(d.begin() + 1, std::make_unique<int>(5));
+  d.erase(d.begin() + 1);
+  EXPECT_EQ(*d.front(), 1);
+  EXPECT_EQ(*d.back(), 2);
+}
+
+TEST(Deque, Memory_Stats) {
+  s21::deque<int> d;
+  EXPECT_EQ(d.memory_usage(), sizeof(d));
+  EXPECT_EQ(d.memory_stats().allocations, size_t(0));
+  d.push_back(1);
+  s21::MemoryStats stats = d.memory_stats();
+  EXPECT_EQ(stats.payload, sizeof(int));
+  // the map and one block
+  EXPECT_EQ(stats.allocations, size_t(2));
+  d.pop_back();
+  // the emptied block stays as the spare until shrink_to_fit
+  EXPECT_EQ(d.memory_stats().allocations, size_t(2));
+  d.shrink_to_fit();
+  EXPECT_EQ(d.memory_stats().allocations, size_t(1));
+}
@@ -0,0 +1,123 @@
+#include <iterator>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "s21_gtests.h"
+
+template <typename Key, typename Val>
+bool is_equal_flat(s21::flat_map<Key, Val> &mymap,
+                   std::map<Key, Val> &stdmap) {
+  if (mymap.size() != stdmap.size()) return false;
+  auto it = mymap.begin();
+  for (const auto &kv : stdmap) {
+    if ((*it).first != kv.first || (*it).second != kv.second) return false;
+    ++it;
+  }
+  return it == mymap.end();
+}
+
+//**********************CONSTRUCTORS**********************
+TEST(flat_map, Constructors) {
+  s21::flat_map<int, std::string> my{{3, "c"}, {1, "a"}, {2, "b"}, {1, "x"}};
+  std::map<int, std::string> std{{3, "c"}, {1, "a"}, {2, "b"}, {1, "x"}};
+  EXPECT_TRUE(is_equal_flat(my, std));
+
+  s21::flat_map<int, std::string> copy(my);
+  EXPECT_TRUE(is_equal_flat(copy, std));
+  s21::flat_map<int, std::string> moved(std::move(copy));
+  EXPECT_TRUE(is_equal_flat(moved, std));
+  EXPECT_TRUE(copy.empty());
+
+  std::vector<std::pair<int, std::string>> items;
+  for (int i = 0; i < 1000; ++i) {
+    items.emplace_back(i * 7 % 101, std::to_string(i));
+  }
+  s21::flat_map<int, std::string> ranged(items.begin(), items.end());
+  std::map<int, std::string> std_ranged(items.begin(), items.end());
+  EXPECT_TRUE(is_equal_flat(ranged, std_ranged));
+}
+
+//**********************ELEMENT ACCESS**********************
+TEST(flat_map, Accessors) {
+  s21::flat_map<std::string, int> my;
+  my["b"] = 2;
+  my["a"] = 1;
+  ++my["a"];
+  EXPECT_EQ(my.at("a"), 2);
+  EXPECT_EQ(my.at("b"), 2);
+  EXPECT_THROW(my.at("c"), std::out_of_range);
+  (*my.find("b")).second = 5;
+  EXPECT_EQ(my["b"], 5);
+  EXPECT_EQ(my.front().first, "a");
+  EXPECT_EQ(my.back().second, 5);
+  EXPECT_EQ(my.size(), 2U);
+}
+
+//**********************MODIFIERS**********************
+TEST(flat_map, Insert) {
+  s21::flat_map<int, std::string> my;
+  std::map<int, std::string> std;
+  for (int i = 0; i < 4000; ++i) {
+    int key = i * 7919 % 2003;
+    auto res = my.insert({key, std::to_string(i)});
+    EXPECT_EQ(res.second, std.insert({key, std::to_string(i)}).second);
+    EXPECT_EQ((*res.first).first, key);
+  }
+  EXPECT_TRUE(is_equal_flat(my, std));
+  EXPECT_FALSE(my.insert(5, "five").second);
+  auto hinted = my.insert(my.end(), {5000, "end"});
+  EXPECT_TRUE(hinted == --my.end());
+  EXPECT_TRUE(my.try_emplace(-1, 3, 'z').second);
+  EXPECT_EQ(my.at(-1), "zzz");
+  EXPECT_FALSE(my.try_emplace(-1, "other").second);
+  EXPECT_FALSE(my.insert_or_assign(-1, "new").second);
+  EXPECT_EQ(my.at(-1), "new");
+  EXPECT_TRUE(my.emplace(6000, "last").second);
+  EXPECT_EQ(my.back().second, "last");
+}
+
+TEST(flat_map, Erase) {
+  s21::flat_map<int, int> my{{1, 1}, {2, 2}, {3, 3}, {4, 4}, {5, 5}};
+  std::map<int, int> std{{1, 1}, {2, 2}, {3, 3}, {4, 4}, {5, 5}};
+  my.erase(my.find(4));
+  std.erase(4);
+  EXPECT_TRUE(is_equal_flat(my, std));
+  auto next = my.erase(my.begin(), my.find(3));
+  std.erase(std.begin(), std.find(3));
+  EXPECT_EQ((*next).first, 3);
+  EXPECT_TRUE(is_equal_flat(my, std));
+  my.clear();
+  EXPECT_TRUE(my.empty());
+}
+
+TEST(flat_map, Merge_Split_Join) {
+  s21::flat_map<int, char> my1{{1, 'a'}, {4, 'd'}, {5, 'e'}};
+  s21::flat_map<int, char> my2{{2, 'b'}, {4, 'x'}, {9, 'i'}};
+  std::map<int, char> std1{{1, 'a'}, {4, 'd'}, {5, 'e'}};
+  std::map<int, char> std2{{2, 'b'}, {4, 'x'}, {9, 'i'}};
+  my1.merge(my2);
+  std1.merge(std2);
+  EXPECT_TRUE(is_equal_flat(my1, std1));
+  EXPECT_TRUE(is_equal_flat(my2, std2));
+
+  auto tail = my1.split(4);
+  EXPECT_EQ(my1.size(), 2U);
+  EXPECT_EQ(tail.size(), 3U);
+  EXPECT_EQ(tail.at(4), 'd');
+  tail.join(my1);
+  EXPECT_TRUE(is_equal_flat(tail, std1));
+}
+
+TEST(flat_map, Swap_With_Map) {
+  // the same call sites compile against either container
+  auto fill = [](auto &m) {
+    for (int i = 0; i < 50; ++i) m.insert_or_assign(i % 10, i);
+    return m.size();
+  };
+  s21::map<int, int> tree;
+  s21::flat_map<int, int> flat;
+  EXPECT_EQ(fill(tree), fill(flat));
+  EXPECT_EQ(tree.at(3), flat.at(3));
+}
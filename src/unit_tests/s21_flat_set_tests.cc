@@ -0,0 +1,207 @@
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "s21_gtests.h"
+
+template <typename Key, typename Compare>
+bool is_equal_flat(s21::flat_set<Key, Compare> &myset,
+                   std::set<Key, Compare> &stdset) {
+  return myset.size() == stdset.size() &&
+         std::equal(stdset.begin(), stdset.end(), myset.begin()) &&
+         std::equal(stdset.rbegin(), stdset.rend(), myset.rbegin());
+}
+
+//**********************CONSTRUCTORS**********************
+TEST(flat_set, Constructors) {
+  s21::flat_set<int> empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_TRUE(empty.begin() == empty.end());
+
+  s21::flat_set<int> my = {5, 1, 4, 1, 3, 5, 2};
+  std::set<int> std = {5, 1, 4, 1, 3, 5, 2};
+  EXPECT_TRUE(is_equal_flat(my, std));
+
+  s21::flat_set<int> copy(my);
+  EXPECT_TRUE(is_equal_flat(copy, std));
+  s21::flat_set<int> moved(std::move(copy));
+  EXPECT_TRUE(is_equal_flat(moved, std));
+  EXPECT_TRUE(copy.empty());
+}
+
+TEST(flat_set, Range_Constructor) {
+  std::vector<int> keys;
+  for (int i = 0; i < 3000; ++i) keys.push_back(i * 7919 % 1009);
+  s21::flat_set<int> my(keys.begin(), keys.end());
+  std::set<int> std(keys.begin(), keys.end());
+  EXPECT_TRUE(is_equal_flat(my, std));
+
+  std::sort(keys.begin(), keys.end());
+  s21::flat_set<int> sorted;
+  sorted.assign_sorted(keys.begin(), keys.end());
+  EXPECT_TRUE(is_equal_flat(sorted, std));
+}
+
+//**********************MODIFIERS**********************
+TEST(flat_set, Insert_Find) {
+  s21::flat_set<int> my;
+  std::set<int> std;
+  my.reserve(100);
+  for (int i = 0; i < 5000; ++i) {
+    int key = i * 7919 % 3001;
+    auto res = my.insert(key);
+    EXPECT_EQ(res.second, std.insert(key).second);
+    EXPECT_EQ(*res.first, key);
+  }
+  EXPECT_TRUE(is_equal_flat(my, std));
+  for (int key = -10; key < 3010; ++key) {
+    EXPECT_EQ(my.contains(key), std.count(key) == 1);
+    auto it = my.find(key);
+    if (std.count(key)) {
+      EXPECT_EQ(*it, key);
+    } else {
+      EXPECT_TRUE(it == my.end());
+    }
+  }
+  EXPECT_EQ(my.front(), 0);
+  EXPECT_EQ(my.back(), 3000);
+  EXPECT_THROW(*my.end(), std::out_of_range);
+}
+
+TEST(flat_set, Insert_Hint) {
+  s21::flat_set<int> my;
+  for (int i = 0; i < 100; ++i) {
+    my.insert(my.end(), i);
+  }
+  my.insert(my.begin(), 50);
+  my.insert(my.find(60), -1);
+  my.emplace_hint(my.begin(), -2);
+  EXPECT_EQ(my.size(), 102U);
+  EXPECT_TRUE(std::is_sorted(my.begin(), my.end()));
+  EXPECT_EQ(my.front(), -2);
+}
+
+TEST(flat_set, Emplace) {
+  s21::flat_set<std::string> my;
+  EXPECT_TRUE(my.emplace(3, 'a').second);
+  EXPECT_FALSE(my.emplace("aaa").second);
+  EXPECT_TRUE(my.emplace("b").second);
+  EXPECT_EQ(my.size(), 2U);
+  EXPECT_EQ(my.front(), "aaa");
+}
+
+TEST(flat_set, Erase) {
+  s21::flat_set<int> my = {1, 2, 3, 4, 5, 6, 7, 8};
+  std::set<int> std = {1, 2, 3, 4, 5, 6, 7, 8};
+  my.erase(my.find(1));
+  std.erase(1);
+  auto next = my.erase(my.find(3), my.find(6));
+  std.erase(std.find(3), std.find(6));
+  EXPECT_EQ(*next, 6);
+  EXPECT_TRUE(is_equal_flat(my, std));
+  my.erase(my.find(7), my.end());
+  std.erase(7);
+  std.erase(8);
+  EXPECT_TRUE(is_equal_flat(my, std));
+}
+
+TEST(flat_set, Merge) {
+  s21::flat_set<int> my1 = {2, 4, 6};
+  s21::flat_set<int> my2 = {1, 2, 3, 6, 9};
+  std::set<int> std1 = {2, 4, 6};
+  std::set<int> std2 = {1, 2, 3, 6, 9};
+  my1.merge(my2);
+  std1.merge(std2);
+  EXPECT_TRUE(is_equal_flat(my1, std1));
+  EXPECT_TRUE(is_equal_flat(my2, std2));
+}
+
+TEST(flat_set, Split_Join) {
+  s21::flat_set<int> low;
+  for (int i = 0; i < 100; ++i) low.insert(i);
+  auto high = low.split(40);
+  EXPECT_EQ(low.size(), 40U);
+  EXPECT_EQ(high.size(), 60U);
+  EXPECT_EQ(high.front(), 40);
+  s21::flat_set<int> overlap = {10, 1000};
+  EXPECT_THROW(high.join(overlap), std::invalid_argument);
+  high.join(low);
+  EXPECT_TRUE(low.empty());
+  EXPECT_EQ(high.size(), 100U);
+  EXPECT_EQ(high.front(), 0);
+  EXPECT_TRUE(std::is_sorted(high.begin(), high.end()));
+}
+
+TEST(flat_set, Node_Handle) {
+  s21::flat_set<std::string> my = {"a", "b"};
+  auto node = my.extract("a");
+  EXPECT_FALSE(node.empty());
+  EXPECT_EQ(my.size(), 1U);
+  node.value() = "c";
+  auto res = my.insert(std::move(node));
+  EXPECT_TRUE(res.inserted);
+  EXPECT_EQ(*res.position, "c");
+  EXPECT_TRUE(my.extract("z").empty());
+}
+
+//**********************LOOKUP**********************
+TEST(flat_set, Transparent_Lookup) {
+  s21::flat_set<std::string, std::less<>> my = {"pear", "apple", "fig"};
+  std::string_view key = "fig";
+  EXPECT_TRUE(my.contains(key));
+  EXPECT_EQ(*my.find(key), "fig");
+  EXPECT_FALSE(my.contains(std::string_view("plum")));
+}
+
+TEST(flat_set, Multiset_Backend) {
+  s21::multiset<int, std::less<int>, s21::FlatTree> my = {3, 1, 3, 2, 3};
+  std::multiset<int> std = {3, 1, 3, 2, 3};
+  EXPECT_EQ(my.size(), std.size());
+  EXPECT_TRUE(std::equal(std.begin(), std.end(), my.begin()));
+  EXPECT_EQ(my.count(3), 3U);
+  my.insert(2);
+  std.insert(2);
+  auto range = my.equal_range(2);
+  EXPECT_EQ(std::distance(range.first, range.second), 2);
+  EXPECT_TRUE(std::equal(std.begin(), std.end(), my.begin()));
+}
+
+// lower and upper bounds through the packed scan, for unsigned keys that
+// need their sign bits flipped, for both orders and for floating point
+template <typename Key, typename Compare>
+void expect_packed_bounds(Key step, Key shift) {
+  s21::multiset<Key, Compare, s21::FlatTree> my;
+  std::multiset<Key, Compare> std;
+  auto make = [step, shift](int i) {
+    return static_cast<Key>(static_cast<Key>(i) * step - shift);
+  };
+  for (int i = 0; i < 700; ++i) {
+    my.insert(make(i * 7919 % 401));
+    std.insert(make(i * 7919 % 401));
+  }
+  for (int i = -5; i < 410; ++i) {
+    Key key = make(i);
+    EXPECT_EQ(std::distance(my.begin(), my.lower_bound(key)),
+              std::distance(std.begin(), std.lower_bound(key)));
+    EXPECT_EQ(std::distance(my.begin(), my.upper_bound(key)),
+              std::distance(std.begin(), std.upper_bound(key)));
+    EXPECT_EQ(my.find(key) == my.end(), std.find(key) == std.end());
+  }
+}
+
+TEST(flat_set, Packed_Scan_Bounds) {
+  expect_packed_bounds<uint8_t, std::less<uint8_t>>(1, 100);
+  expect_packed_bounds<uint8_t, std::greater<uint8_t>>(1, 100);
+  expect_packed_bounds<int16_t, std::less<int16_t>>(163, 30000);
+  expect_packed_bounds<uint16_t, std::greater<uint16_t>>(163, 0);
+  expect_packed_bounds<int, std::greater<int>>(-7, 0);
+  expect_packed_bounds<uint32_t, std::less<uint32_t>>(0x00A00000u, 0);
+  expect_packed_bounds<float, std::less<float>>(0.5f, 100.0f);
+  expect_packed_bounds<double, std::greater<double>>(0.25, 50.0);
+  expect_packed_bounds<long long, std::less<long long>>(1LL << 40, 0);
+}
@@ -0,0 +1,152 @@
+#include <functional>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "s21_gtests.h"
+
+namespace {
+
+// random pushes, updates, erases and pops against a handle -> value map
+template <std::size_t Arity>
+void check_against_map(unsigned seed) {
+  s21::indexed_priority_queue<int, std::less<int>, Arity> ours;
+  std::map<size_t, int> live;
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> value(-500, 500);
+  auto greatest = [&live] {
+    int best = live.begin()->second;
+    for (const auto &entry : live) best = std::max(best, entry.second);
+    return best;
+  };
+  for (int step = 0; step < 4000; ++step) {
+    int action = gen() % 10;
+    if (action < 4 || live.empty()) {
+      int v = value(gen);
+      size_t handle = ours.push(v);
+      ASSERT_EQ(live.count(handle), size_t(0));
+      live[handle] = v;
+    } else {
+      auto it = live.begin();
+      std::advance(it, gen() % live.size());
+      if (action < 7) {
+        int v = value(gen);
+        ours.update(it->first, v);
+        it->second = v;
+      } else if (action < 9) {
+        ours.erase(it->first);
+        EXPECT_FALSE(ours.contains(it->first));
+        live.erase(it);
+      } else {
+        ASSERT_EQ(ours.top(), greatest());
+        size_t handle = ours.top_handle();
+        ASSERT_EQ(live[handle], ours.top());
+        ASSERT_EQ(ours.pop_value(), live[handle]);
+        live.erase(handle);
+      }
+    }
+    ASSERT_EQ(ours.size(), live.size());
+    if (!live.empty()) {
+      ASSERT_EQ(ours.top(), greatest());
+    }
+  }
+  for (const auto &entry : live) {
+    ASSERT_EQ(ours.value(entry.first), entry.second);
+  }
+}
+
+}  // namespace
+
+TEST(IndexedPriorityQueue, Against_Map) {
+  check_against_map<2>(1);
+  check_against_map<4>(2);
+  check_against_map<5>(3);
+}
+
+TEST(IndexedPriorityQueue, Dijkstra) {
+  // edges as (from, to, weight)
+  std::vector<std::vector<std::pair<int, int>>> graph(6);
+  int edges[][3] = {{0, 1, 7}, {0, 2, 9}, {0, 5, 14}, {1, 2, 10},
+                    {1, 3, 15}, {2, 3, 11}, {2, 5, 2},  {3, 4, 6},
+                    {4, 5, 9}};
+  for (auto &e : edges) {
+    graph[e[0]].push_back({e[1], e[2]});
+    graph[e[1]].push_back({e[0], e[2]});
+  }
+  const int kInf = 1 << 30;
+  std::vector<int> dist(6, kInf);
+  s21::indexed_priority_queue<int, std::greater<int>> frontier;
+  // pushing in vertex order makes each handle equal its vertex
+  for (int v = 0; v < 6; ++v) {
+    ASSERT_EQ(frontier.push(v == 0 ? 0 : kInf), size_t(v));
+  }
+  while (!frontier.empty()) {
+    int u = frontier.top_handle();
+    dist[u] = frontier.pop_value();
+    for (auto [v, w] : graph[u]) {
+      if (frontier.contains(v) && dist[u] + w < frontier.value(v)) {
+        frontier.update(v, dist[u] + w);
+      }
+    }
+  }
+  EXPECT_EQ(dist, (std::vector<int>{0, 7, 9, 20, 20, 11}));
+}
+
+TEST(IndexedPriorityQueue, Handles) {
+  s21::indexed_priority_queue<std::string> q;
+  size_t a = q.push("apple");
+  size_t b = q.emplace(3, 'z');
+  size_t c = q.push(std::string("mango"));
+  EXPECT_EQ(q.top(), "zzz");
+  EXPECT_EQ(q.top_handle(), b);
+  q.update(a, "zzzz");
+  EXPECT_EQ(q.top_handle(), a);
+  q.erase(a);
+  EXPECT_THROW(q.erase(a), std::out_of_range);
+  EXPECT_THROW(q.update(a, "x"), std::out_of_range);
+  EXPECT_THROW(q.value(100), std::out_of_range);
+  EXPECT_FALSE(q.contains(a));
+  // the freed handle goes to the next push
+  EXPECT_EQ(q.push("kiwi"), a);
+  EXPECT_EQ(q.value(c), "mango");
+  EXPECT_EQ(q.pop_value(), "zzz");
+  EXPECT_EQ(q.pop_value(), "mango");
+  EXPECT_EQ(q.pop_value(), "kiwi");
+  EXPECT_THROW(q.top(), std::out_of_range);
+  EXPECT_THROW(q.top_handle(), std::out_of_range);
+  EXPECT_THROW(q.pop(), std::out_of_range);
+}
+
+TEST(IndexedPriorityQueue, Copy_Move_Swap) {
+  s21::indexed_priority_queue<int> q;
+  size_t low = q.push(1);
+  q.push(5);
+  s21::indexed_priority_queue<int> copy(q);
+  copy.update(low, 10);
+  EXPECT_EQ(copy.top(), 10);
+  EXPECT_EQ(q.top(), 5);
+
+  s21::indexed_priority_queue<int> other;
+  other.swap(q);
+  EXPECT_TRUE(q.empty());
+  EXPECT_EQ(other.value(low), 1);
+  q = std::move(copy);
+  EXPECT_EQ(q.top_handle(), low);
+  q.clear();
+  EXPECT_TRUE(q.empty());
+  EXPECT_EQ(q.push(3), size_t(0));
+}
+
+TEST(IndexedPriorityQueue, Memory_Stats) {
+  s21::indexed_priority_queue<double> q;
+  EXPECT_EQ(q.memory_usage(), sizeof(q));
+  EXPECT_EQ(q.memory_stats().allocations, size_t(0));
+  q.push(1.5);
+  q.push(2.5);
+  s21::MemoryStats stats = q.memory_stats();
+  EXPECT_EQ(stats.payload, 2 * sizeof(double));
+  EXPECT_EQ(stats.allocations, size_t(2));
+  EXPECT_GT(stats.overhead, sizeof(q));
+}
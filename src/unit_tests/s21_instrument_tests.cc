@@ -0,0 +1,102 @@
+#include <string>
+
+#include "s21_gtests.h"
+
+// Built by `make test` the hooks compile away and no family ever records
+// anything; `make instrument` builds the same tests with S21_INSTRUMENT.
+namespace instrument = s21::instrument;
+using Event = s21::instrument::Event;
+
+std::uint64_t instrument_count(const char *family, Event event) {
+  const instrument::Counters *counters = instrument::find(family);
+  return counters ? counters->get(event) : 0;
+}
+
+TEST(instrument, Vector) {
+  instrument::reset();
+  {
+    s21::vector<int> v;
+    for (int i = 0; i < 100; ++i) v.push_back(i);
+    v.insert(v.begin(), -1);
+    v.erase(v.begin() + 10);
+  }
+  if (!instrument::kEnabled) {
+    EXPECT_EQ(instrument::find("vector"), nullptr);
+    return;
+  }
+  // capacities 1, 2, 4, ..., 128
+  EXPECT_EQ(instrument_count("vector", Event::kAllocation), 8U);
+  EXPECT_EQ(instrument_count("vector", Event::kReallocation), 7U);
+  EXPECT_EQ(instrument_count("vector", Event::kDeallocation), 8U);
+  // 127 by growing, 100 by the insert and 90 by the erase
+  EXPECT_EQ(instrument_count("vector", Event::kMove), 127U + 100 + 90);
+}
+
+TEST(instrument, List) {
+  instrument::reset();
+  {
+    s21::list<int> l;
+    for (int i = 0; i < 10; ++i) l.push_back(i);
+    l.pop_front();
+    l.pop_back();
+    if (instrument::kEnabled) {
+      EXPECT_EQ(instrument_count("list", Event::kAllocation), 11U);
+      EXPECT_EQ(instrument_count("list", Event::kDeallocation), 2U);
+    }
+  }
+  EXPECT_EQ(instrument_count("list", Event::kAllocation),
+            instrument_count("list", Event::kDeallocation));
+}
+
+TEST(instrument, Trees) {
+  instrument::reset();
+  {
+    s21::set<int> avl;
+    s21::set<int, std::less<int>, s21::ArenaAVLTree> arena;
+    s21::set<int, std::less<int>, s21::BPlusTree> bplus;
+    for (int i = 0; i < 1000; ++i) {
+      avl.insert(i);
+      arena.insert(i);
+      bplus.insert(i);
+    }
+    if (instrument::kEnabled) {
+      EXPECT_EQ(instrument_count("AVLTree", Event::kAllocation), 1000U);
+      EXPECT_GT(instrument_count("AVLTree", Event::kRotation), 900U);
+      EXPECT_GE(instrument_count("AVLTree", Event::kRebalance),
+                instrument_count("AVLTree", Event::kRotation));
+      EXPECT_GT(instrument_count("AVLTree", Event::kComparison), 1000U * 8);
+      EXPECT_GT(instrument_count("ArenaAVLTree", Event::kRotation), 900U);
+      EXPECT_GT(instrument_count("ArenaAVLTree", Event::kReallocation), 0U);
+      EXPECT_GT(instrument_count("BPlusTree", Event::kAllocation), 1000U / 64);
+      EXPECT_GT(instrument_count("BPlusTree", Event::kComparison), 1000U);
+    }
+    for (int i = 0; i < 1000; i += 2) bplus.erase(bplus.find(i));
+  }
+  for (const char *family : {"AVLTree", "ArenaAVLTree", "BPlusTree"}) {
+    EXPECT_EQ(instrument_count(family, Event::kAllocation),
+              instrument_count(family, Event::kDeallocation));
+  }
+  EXPECT_TRUE(s21::set<int>().key_comp()(1, 2));
+}
+
+TEST(instrument, Dump) {
+  instrument::reset();
+  if (!instrument::kEnabled) {
+    EXPECT_EQ(instrument::to_text(), "");
+    EXPECT_EQ(instrument::to_json(), "{}");
+    return;
+  }
+  { s21::list<int> l = {1, 2}; }
+  std::string text = instrument::to_text();
+  EXPECT_NE(text.find("list: allocations=3 deallocations=3 reallocations=0 "
+                      "moves=0 comparisons=0 rotations=0 rebalances=0\n"),
+            std::string::npos);
+  EXPECT_LT(text.find("AVLTree:"), text.find("list:"));
+  std::string json = instrument::to_json();
+  EXPECT_EQ(json.front(), '{');
+  EXPECT_EQ(json.back(), '}');
+  EXPECT_NE(json.find("\"list\": {\"allocations\": 3, \"deallocations\": 3, "
+                      "\"reallocations\": 0, \"moves\": 0, \"comparisons\": 0, "
+                      "\"rotations\": 0, \"rebalances\": 0}"),
+            std::string::npos);
+}
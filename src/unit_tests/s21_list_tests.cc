@@ -204,6 +204,19 @@ TEST(List, Capacity_max_size) {
   EXPECT_EQ(s21_lc.max_size(), std_lc.max_size());
 }
 
+TEST(List, Capacity_memory_stats) {
+  s21::list<int> s21_l;
+  EXPECT_EQ(s21_l.memory_stats().payload, 0U);
+  EXPECT_EQ(s21_l.memory_stats().allocations, 1U);
+
+  for (int i = 0; i < 10; ++i) s21_l.push_back(i);
+  s21::MemoryStats stats = s21_l.memory_stats();
+  EXPECT_EQ(stats.payload, 10 * sizeof(int));
+  EXPECT_EQ(stats.allocations, 11U);
+  EXPECT_GT(stats.overhead, 11 * 2 * sizeof(void *));
+  EXPECT_EQ(s21_l.memory_usage(), stats.total());
+}
+
 TEST(List, Clear) {
   s21::list<std::string> s21_l = {"zhyzha", "ploho", "sebya vedet!"};
   std::list<std::string> std_l = {"zhyzha", "ploho", "sebya vedet!"};
@@ -1,7 +1,30 @@
+#include <algorithm>
+#include <functional>
+#include <iterator>
 #include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include "s21_gtests.h"
 
+// counts copies so the tests can check which calls only move
+struct Tracked {
+  static int copies;
+  int value;
+  explicit Tracked(int v = 0) : value(v) {}
+  Tracked(const Tracked &other) : value(other.value) { ++copies; }
+  Tracked(Tracked &&other) = default;
+  Tracked &operator=(const Tracked &other) {
+    value = other.value;
+    ++copies;
+    return *this;
+  }
+  Tracked &operator=(Tracked &&other) = default;
+};
+int Tracked::copies = 0;
+
 template <typename Key, typename Val>
 void print_maps(s21::map<Key, Val> &mymap, std::map<Key, Val> &stdmap) {
   std::cout << "\n\tTEST_MAP:PRINT\n\n";
@@ -94,6 +117,70 @@ TEST(map, Move_Constructor) {
   EXPECT_TRUE(is_equal_maps(m3, m4));
 }
 
+TEST(map, Range_Constructor) {
+  std::vector<std::pair<int, std::string>> runs{
+      {3, "three"}, {1, "one"}, {2, "two"}, {1, "uno"}, {5, "five"}};
+  s21::map<int, std::string> my1(runs.begin(), runs.end());
+  std::map<int, std::string> std1(runs.begin(), runs.end());
+  EXPECT_TRUE(is_equal_maps(my1, std1));
+
+  std::map<int, int> std2;
+  for (int i = 0; i < 500; ++i) std2[i * 7 % 500] = i;
+  s21::map<int, int> my2(std2.begin(), std2.end());
+  EXPECT_TRUE(is_equal_maps(my2, std2));
+}
+
+TEST(map, Assign_Sorted) {
+  std::vector<std::pair<int, char>> sorted{
+      {1, 'a'}, {2, 'b'}, {2, 'x'}, {3, 'c'}, {4, 'd'}};
+  s21::map<int, char> my1{{9, 'z'}};
+  my1.assign_sorted(sorted.begin(), sorted.end());
+  std::map<int, char> std1(sorted.begin(), sorted.end());
+  EXPECT_TRUE(is_equal_maps(my1, std1));
+  EXPECT_EQ(my1.at(2), 'b');
+}
+
+template <template <typename, typename, typename> class Tree>
+void expect_assign_parallel() {
+  std::vector<std::pair<int, int>> items;
+  for (int i = 0; i < 100000; ++i) items.emplace_back(i * 7919 % 40009, i);
+  std::map<int, int> first;
+  std::map<int, int> last;
+  for (const auto &item : items) {
+    first.insert(item);
+    last[item.first] = item.second;
+  }
+  auto same = [](const std::pair<const int, int> &a, const auto &b) {
+    return a.first == b.first && a.second == b.second;
+  };
+  s21::map<int, int, std::less<int>, Tree> my{{-1, 0}};
+  my.assign_parallel(items.begin(), items.end(), s21::bulk::Keep::kFirst, 4);
+  EXPECT_EQ(my.size(), first.size());
+  EXPECT_TRUE(std::equal(first.begin(), first.end(), my.begin(), same));
+  my.assign_parallel(items.begin(), items.end(), s21::bulk::Keep::kLast, 3);
+  EXPECT_EQ(my.size(), last.size());
+  EXPECT_TRUE(std::equal(last.begin(), last.end(), my.begin(), same));
+  my.insert(-5, 5);
+  EXPECT_EQ(my.at(-5), 5);
+  EXPECT_EQ(my.size(), last.size() + 1);
+}
+
+TEST(map, Assign_Parallel) {
+  expect_assign_parallel<s21::AVLTree>();
+  expect_assign_parallel<s21::ArenaAVLTree>();
+  expect_assign_parallel<s21::BPlusTree>();
+  expect_assign_parallel<s21::FlatTree>();
+  expect_assign_parallel<s21::BloomTree>();
+
+  std::vector<std::pair<int, char>> few{{2, 'b'}, {1, 'a'}, {2, 'x'}};
+  s21::map<int, char> my;
+  my.assign_parallel(few.begin(), few.end(), s21::bulk::Keep::kLast);
+  EXPECT_EQ(my.size(), 2U);
+  EXPECT_EQ(my.at(2), 'x');
+  my.assign_parallel(few.end(), few.end());
+  EXPECT_TRUE(my.empty());
+}
+
 // //**********************CAPACITY**********************
 
 TEST(map, Empty) {
@@ -124,6 +211,27 @@ TEST(map, Max_size) {
   // EXPECT_EQ(s21_sc.max_size(), std_sc.max_size());
 }
 
+template <template <typename, typename, typename> class Tree>
+void expect_map_memory_stats() {
+  s21::map<int, double, std::less<int>, Tree> my;
+  EXPECT_EQ(my.memory_stats().payload, 0U);
+  for (int i = 0; i < 1000; ++i) my.insert(i * 7 % 1000, i);
+  s21::MemoryStats stats = my.memory_stats();
+  EXPECT_EQ(stats.payload, 1000 * (sizeof(int) + sizeof(double)));
+  EXPECT_GT(stats.allocations, 0U);
+  EXPECT_EQ(my.memory_usage(), stats.total());
+  for (int i = 0; i < 1000; i += 4) my.erase(my.find(i));
+  EXPECT_EQ(my.memory_stats().payload, 750 * (sizeof(int) + sizeof(double)));
+}
+
+TEST(map, Memory_Stats) {
+  expect_map_memory_stats<s21::AVLTree>();
+  expect_map_memory_stats<s21::ArenaAVLTree>();
+  expect_map_memory_stats<s21::BPlusTree>();
+  expect_map_memory_stats<s21::FlatTree>();
+  expect_map_memory_stats<s21::BloomTree>();
+}
+
 // //**********************Iterator**********************
 TEST(map, Iterators) {
   s21::map<int, char> s1 = {{1, 'a'}, {2, 'b'}, {3, 'c'}, {4, 'd'}, {5, 'e'}};
@@ -139,6 +247,29 @@ TEST(map, Iterators) {
   EXPECT_EQ((*it1).second, (*it2).second);
 }
 
+TEST(map, Reverse_Iterator) {
+  s21::map<int, int> my;
+  for (int i = 0; i < 100; ++i) {
+    my.insert(i, i * i);
+  }
+  // the latest three entries
+  auto rit = my.rbegin();
+  EXPECT_EQ((*rit++).first, 99);
+  EXPECT_EQ((*rit++).first, 98);
+  EXPECT_EQ((*rit).second, 97 * 97);
+  EXPECT_EQ(my.front().first, 0);
+  EXPECT_EQ(my.back().second, 99 * 99);
+  my.erase(--my.end());
+  EXPECT_EQ(my.back().first, 98);
+  EXPECT_EQ(my.size(), 99U);
+
+  s21::map<int, int, std::less<int>, s21::BPlusTree> tree(my.begin(),
+                                                          my.end());
+  EXPECT_EQ((*tree.rbegin()).first, 98);
+  EXPECT_EQ(tree.back().first, 98);
+  EXPECT_EQ((*--tree.end()).second, 98 * 98);
+}
+
 //**********************MODIFIERS**********************
 TEST(map, Insert) {
   std::map<int, std::string> std1;
@@ -262,6 +393,53 @@ TEST(map, Merge) {
   EXPECT_TRUE(is_equal_maps(my4, std4));
 }
 
+TEST(map, Erase_Range) {
+  s21::map<int, int> my{{1, 1}, {2, 2}, {3, 3}, {4, 4}, {5, 5}};
+  std::map<int, int> std{{1, 1}, {2, 2}, {3, 3}, {4, 4}, {5, 5}};
+  auto next = my.erase(my.find(2), my.find(4));
+  std.erase(std.find(2), std.find(4));
+  EXPECT_TRUE(is_equal_maps(my, std));
+  EXPECT_EQ((*next).first, 4);
+  my.erase(my.begin(), my.end());
+  EXPECT_TRUE(my.empty());
+}
+
+template <template <typename, typename, typename> class Tree>
+void expect_reshard() {
+  // three range shards of one map, joined back in a different order
+  s21::map<int, std::string, std::less<int>, Tree> shard;
+  for (int i = 0; i < 600; ++i) {
+    shard.emplace(i, std::to_string(i));
+  }
+  auto upper = shard.split(400);
+  auto middle = shard.split(200);
+  EXPECT_EQ(shard.size(), 200U);
+  EXPECT_EQ(middle.size(), 200U);
+  EXPECT_EQ(upper.size(), 200U);
+  EXPECT_EQ((*middle.begin()).second, "200");
+  EXPECT_EQ(middle.at(399), "399");
+  EXPECT_THROW(middle.at(400), std::out_of_range);
+  middle.join(upper);
+  middle.join(shard);
+  EXPECT_TRUE(shard.empty());
+  EXPECT_TRUE(upper.empty());
+  int expected = 0;
+  for (auto it = middle.begin(); it != middle.end(); ++it, ++expected) {
+    EXPECT_EQ((*it).first, expected);
+    EXPECT_EQ((*it).second, std::to_string(expected));
+  }
+  EXPECT_EQ(expected, 600);
+  s21::map<int, std::string, std::less<int>, Tree> overlap{{599, "x"}};
+  EXPECT_THROW(middle.join(overlap), std::invalid_argument);
+  EXPECT_EQ(middle.at(599), "599");
+}
+
+TEST(map, Split_Join) {
+  expect_reshard<s21::AVLTree>();
+  expect_reshard<s21::ArenaAVLTree>();
+  expect_reshard<s21::BPlusTree>();
+}
+
 // //**********************LOOKUP**********************
 
 TEST(map, Contains) {
@@ -348,4 +526,265 @@ TEST(map, Insert_many) {
                  std::make_pair(1, "one"), std::make_pair(-24, "ne dva"),
                  std::make_pair(88, "ne dva"));
   EXPECT_TRUE(is_equal_maps(s2, s1));
-}
\ No newline at end of file
+}
+
+TEST(map, Insert_Hint) {
+  s21::map<int, int> my;
+  std::map<int, int> std;
+  auto hint = my.end();
+  for (int i = 0; i < 1000; ++i) {
+    hint = my.insert(hint, {i, -i});
+    std.insert({i, -i});
+    EXPECT_EQ((*hint).first, i);
+  }
+  auto emplaced = my.emplace_hint(my.begin(), 500, 7);
+  EXPECT_EQ((*emplaced).second, -500);
+  my.emplace_hint(my.begin(), -3, 3);
+  std.insert({-3, 3});
+  EXPECT_EQ(my.size(), std.size());
+  auto it = my.begin();
+  for (const auto &kv : std) {
+    EXPECT_EQ((*it).first, kv.first);
+    EXPECT_EQ((*it).second, kv.second);
+    ++it;
+  }
+
+  s21::map<int, int, std::less<int>, s21::BPlusTree> tree;
+  for (int i = 999; i >= 0; --i) {
+    tree.insert(tree.begin(), {i, -i});
+  }
+  tree.emplace_hint(tree.end(), -3, 3);
+  EXPECT_EQ(tree.size(), std.size());
+  EXPECT_EQ(tree.at(-3), 3);
+  EXPECT_EQ(tree.at(999), -999);
+}
+
+TEST(map, Node_Handle) {
+  s21::map<int, std::string> from{{1, "one"}, {2, "two"}, {3, "three"}};
+  s21::map<int, std::string> to{{3, "drei"}};
+  auto node = from.extract(1);
+  EXPECT_EQ(node.key(), 1);
+  EXPECT_EQ(node.mapped(), "one");
+  node.key() = 10;
+  auto result = to.insert(std::move(node));
+  EXPECT_TRUE(result.inserted);
+  EXPECT_EQ((*result.position).second, "one");
+  EXPECT_EQ(to.at(10), "one");
+
+  result = to.insert(from.extract(from.find(3)));
+  EXPECT_FALSE(result.inserted);
+  EXPECT_EQ(result.node.mapped(), "three");
+  EXPECT_EQ(to.at(3), "drei");
+  EXPECT_FALSE(to.insert(s21::map<int, std::string>::node_type()).inserted);
+  EXPECT_EQ(from.size(), 1U);
+  EXPECT_EQ(to.size(), 2U);
+
+  s21::map<int, std::string, std::less<int>, s21::BPlusTree> tree;
+  s21::map<int, std::string, std::less<int>, s21::ArenaAVLTree> arena;
+  for (int i = 0; i < 100; ++i) {
+    tree.insert(i, std::to_string(i));
+  }
+  while (!tree.empty()) {
+    arena.insert(tree.extract(tree.begin()));
+  }
+  EXPECT_EQ(arena.size(), 100U);
+  EXPECT_EQ(arena.at(42), "42");
+  arena.extract(arena.find(42));
+  EXPECT_FALSE(arena.contains(42));
+}
+
+TEST(map, Emplace) {
+  s21::map<int, Tracked> my;
+  Tracked::copies = 0;
+  EXPECT_TRUE(my.try_emplace(1, 10).second);
+  EXPECT_FALSE(my.try_emplace(1, 11).second);
+  EXPECT_TRUE(my.emplace(2, 20).second);
+  EXPECT_FALSE(my.emplace(2, 21).second);
+  my[3].value = 30;
+  my[3].value += 1;
+  my.insert_or_assign(1, Tracked(12));
+  my.insert_or_assign(4, Tracked(40));
+  my.insert({5, Tracked(50)});
+  my.insert(my.end(), {6, Tracked(60)});
+  my.emplace_hint(my.end(), 7, 70);
+  EXPECT_EQ(Tracked::copies, 0);
+  EXPECT_EQ(my.size(), 7U);
+  EXPECT_EQ(my.at(1).value, 12);
+  EXPECT_EQ(my.at(2).value, 20);
+  EXPECT_EQ(my.at(3).value, 31);
+  EXPECT_EQ(my.at(7).value, 70);
+
+  const Tracked obj(13);
+  my.insert_or_assign(1, obj);
+  EXPECT_EQ(Tracked::copies, 1);
+  EXPECT_EQ(my.at(1).value, 13);
+}
+
+TEST(map, Move_Only_Values) {
+  s21::map<int, std::unique_ptr<int>> my;
+  EXPECT_TRUE(my.try_emplace(1, std::make_unique<int>(10)).second);
+  auto value = std::make_unique<int>(20);
+  EXPECT_FALSE(my.try_emplace(1, std::move(value)).second);
+  // left alone, since the key was already there
+  EXPECT_TRUE(value);
+  EXPECT_TRUE(my.emplace(2, std::move(value)).second);
+  my.insert({3, std::make_unique<int>(30)});
+  my.insert_or_assign(3, std::make_unique<int>(31));
+  my[4] = std::make_unique<int>(40);
+  EXPECT_EQ(*my.at(1), 10);
+  EXPECT_EQ(*my.at(2), 20);
+  EXPECT_EQ(*my.at(3), 31);
+  EXPECT_EQ(*my.at(4), 40);
+
+  s21::map<int, std::unique_ptr<int>, std::less<int>, s21::BPlusTree> tree;
+  s21::map<int, std::unique_ptr<int>, std::less<int>, s21::ArenaAVLTree>
+      arena;
+  for (int i = 0; i < 100; ++i) {
+    tree.try_emplace(i, std::make_unique<int>(i));
+    arena[i] = std::make_unique<int>(-i);
+  }
+  arena.insert(tree.extract(50));
+  EXPECT_EQ(*arena.at(50), -50);
+  EXPECT_EQ(*tree.at(51), 51);
+  EXPECT_FALSE(tree.contains(50));
+}
+
+//**********************BACKENDS**********************
+TEST(map, BPlusTree_Backend) {
+  s21::map<int, std::string, std::less<int>, s21::BPlusTree> my;
+  std::map<int, std::string> std;
+  for (int i = 0; i < 3000; ++i) {
+    my[i * 31 % 1000] += "x";
+    std[i * 31 % 1000] += "x";
+  }
+  my.insert_or_assign(7, "seven");
+  std.insert_or_assign(7, "seven");
+  for (int i = 0; i < 1000; i += 2) {
+    my.erase(my.find(i));
+    std.erase(i);
+  }
+  EXPECT_EQ(my.size(), std.size());
+  auto it = my.begin();
+  for (const auto &kv : std) {
+    EXPECT_EQ((*it).first, kv.first);
+    EXPECT_EQ((*it).second, kv.second);
+    ++it;
+  }
+  EXPECT_EQ(my.at(7), "seven");
+  EXPECT_ANY_THROW(my.at(8));
+  EXPECT_FALSE(my.insert(9, "nine").second);
+}
+
+TEST(map, ArenaAVLTree_Backend) {
+  s21::map<int, std::string, std::less<int>, s21::ArenaAVLTree> my;
+  std::map<int, std::string> std;
+  my.reserve(10);
+  for (int i = 0; i < 3000; ++i) {
+    my[i * 31 % 1000] += "x";
+    std[i * 31 % 1000] += "x";
+  }
+  my.insert_or_assign(7, "seven");
+  std.insert_or_assign(7, "seven");
+  for (int i = 0; i < 1000; i += 2) {
+    my.erase(my.find(i));
+    std.erase(i);
+  }
+  s21::map<int, std::string, std::less<int>, s21::ArenaAVLTree> copy(my);
+  EXPECT_EQ(copy.size(), std.size());
+  auto it = copy.begin();
+  for (const auto &kv : std) {
+    EXPECT_EQ((*it).first, kv.first);
+    EXPECT_EQ((*it).second, kv.second);
+    ++it;
+  }
+  EXPECT_EQ(my.at(7), "seven");
+  EXPECT_ANY_THROW(my.at(8));
+  EXPECT_FALSE(my.insert(9, "nine").second);
+  EXPECT_TRUE(my.insert(8, "eight").second);
+  EXPECT_EQ(copy.size() + 1, my.size());
+}
+
+//**********************COMPARATORS**********************
+TEST(map, BloomTree_Backend) {
+  s21::map<std::string, int, std::less<std::string>, s21::BloomTree> my;
+  std::map<std::string, int> std;
+  for (int i = 0; i < 2000; ++i) {
+    my[std::to_string(i * 7)] = i;
+    std[std::to_string(i * 7)] = i;
+  }
+  for (int i = 0; i < 14000; ++i) {
+    std::string key = std::to_string(i);
+    EXPECT_EQ(my.contains(key), std.count(key) == 1);
+    if (std.count(key)) {
+      EXPECT_EQ(my.at(key), std[key]);
+    } else {
+      EXPECT_THROW(my.at(key), std::out_of_range);
+    }
+  }
+  auto tail = my.split("5");
+  EXPECT_TRUE(tail.contains("7"));
+  EXPECT_FALSE(my.contains("7"));
+  EXPECT_TRUE(my.contains("14"));
+  my.join(tail);
+  EXPECT_EQ(my.size(), std.size());
+  EXPECT_TRUE(std::equal(std.begin(), std.end(), my.begin(),
+                         [](const auto &a, const auto &b) {
+                           return a.first == b.first && a.second == b.second;
+                         }));
+  EXPECT_LT(my.false_positive_rate(), 0.05);
+}
+
+template <template <typename, typename, typename> class Tree>
+void expect_map_find_many() {
+  s21::map<int, int, std::less<int>, Tree> my;
+  for (int i = 0; i < 2000; i += 2) my.insert(i, -i);
+  std::vector<int> keys;
+  for (int i = 0; i < 700; ++i) keys.push_back((i * 37) % 2100 - 50);
+  std::vector<typename s21::map<int, int, std::less<int>, Tree>::iterator>
+      found;
+  std::vector<bool> present;
+  auto out = my.find_many(keys.begin(), keys.end(), std::back_inserter(found));
+  *out = my.end();
+  my.contains_many(keys.begin(), keys.end(), std::back_inserter(present));
+  ASSERT_EQ(found.size(), keys.size() + 1);
+  ASSERT_EQ(present.size(), keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    EXPECT_EQ(present[i], my.contains(keys[i]));
+    EXPECT_TRUE(found[i] == my.find(keys[i]));
+    if (present[i]) {
+      EXPECT_EQ((*found[i]).second, -keys[i]);
+    }
+  }
+}
+
+TEST(map, Find_Many) {
+  expect_map_find_many<s21::AVLTree>();
+  expect_map_find_many<s21::ArenaAVLTree>();
+  expect_map_find_many<s21::BPlusTree>();
+  expect_map_find_many<s21::FlatTree>();
+  expect_map_find_many<s21::BloomTree>();
+}
+
+TEST(map, Custom_Compare) {
+  s21::map<int, char, std::greater<int>> my{{1, 'a'}, {3, 'c'}, {2, 'b'}};
+  std::map<int, char, std::greater<int>> std{{1, 'a'}, {3, 'c'}, {2, 'b'}};
+  auto it = my.begin();
+  for (const auto &kv : std) {
+    EXPECT_EQ((*it).first, kv.first);
+    ++it;
+  }
+  EXPECT_EQ(my.at(2), 'b');
+  EXPECT_FALSE(my.key_comp()(1, 2));
+}
+
+TEST(map, Transparent_Lookup) {
+  s21::map<std::string, int, std::less<>> my{{"one", 1}, {"two", 2}};
+  std::string_view key = "two";
+  EXPECT_EQ((*my.find(key)).second, 2);
+  EXPECT_TRUE(my.contains("one"));
+  EXPECT_FALSE(my.contains(std::string_view("three")));
+
+  s21::map<std::string, int, std::less<>, s21::BPlusTree> tree{{"one", 1}};
+  EXPECT_EQ((*tree.find(std::string_view("one"))).second, 1);
+  EXPECT_TRUE(tree.find("two") == tree.end());
+}
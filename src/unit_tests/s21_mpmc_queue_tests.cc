@@ -0,0 +1,136 @@
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "s21_gtests.h"
+
+TEST(mpmc_queue, Single_Thread) {
+  s21::mpmc_queue<std::string> q(3);
+  EXPECT_EQ(q.capacity(), size_t(4));
+  std::string value;
+  EXPECT_FALSE(q.try_pop(value));
+
+  EXPECT_TRUE(q.try_push("a"));
+  std::string b = "b";
+  EXPECT_TRUE(q.try_push(b));
+  EXPECT_TRUE(q.try_emplace(2, 'c'));
+  q.push(std::string("d"));
+  std::string e = "e";
+  EXPECT_FALSE(q.try_push(std::move(e)));
+  EXPECT_EQ(e, "e");
+
+  ASSERT_TRUE(q.try_pop(value));
+  EXPECT_EQ(value, "a");
+  q.pop(value);
+  EXPECT_EQ(value, "b");
+  EXPECT_TRUE(q.try_push(std::move(e)));
+  // the destructor frees the three that are left
+}
+
+TEST(mpmc_queue, Capacity_Rounding) {
+  s21::mpmc_queue<int> tiny(0);
+  EXPECT_EQ(tiny.capacity(), size_t(2));
+  s21::mpmc_queue<int> exact(16);
+  EXPECT_EQ(exact.capacity(), size_t(16));
+}
+
+TEST(mpmc_queue, Batches) {
+  s21::mpmc_queue<int> q(4);
+  std::vector<int> in = {1, 2, 3, 4, 5, 6};
+  auto rest = q.try_push_many(in.begin(), in.end());
+  EXPECT_EQ(rest, in.begin() + 4);
+
+  std::vector<int> out;
+  q.try_pop_many(std::back_inserter(out), 3);
+  EXPECT_EQ(out, (std::vector<int>{1, 2, 3}));
+  rest = q.try_push_many(rest, in.end());
+  EXPECT_EQ(rest, in.end());
+  q.try_pop_many(std::back_inserter(out), 10);
+  EXPECT_EQ(out, in);
+  q.try_pop_many(std::back_inserter(out), 10);
+  EXPECT_EQ(out.size(), in.size());
+
+  // strings may throw on copy, so they go one at a time
+  s21::mpmc_queue<std::string> strings(2);
+  std::vector<std::string> words = {"x", "y", "z"};
+  EXPECT_EQ(strings.try_push_many(words.begin(), words.end()),
+            words.begin() + 2);
+  std::vector<std::string> got;
+  strings.try_pop_many(std::back_inserter(got), 5);
+  EXPECT_EQ(got, (std::vector<std::string>{"x", "y"}));
+}
+
+TEST(mpmc_queue, Move_Only) {
+  s21::mpmc_queue<std::unique_ptr<int>> q(2);
+  EXPECT_TRUE(q.try_push(std::make_unique<int>(1)));
+  EXPECT_TRUE(q.try_emplace(new int(2)));
+  std::unique_ptr<int> first;
+  q.pop(first);
+  EXPECT_EQ(*first, 1);
+}
+
+// Producers push disjoint ranges, half of them in batches, through a queue
+// small enough to be full and empty often; consumers block in pop. Every
+// value has to come out exactly once, and each producer's values in order.
+TEST(mpmc_queue, Threads) {
+  const int kProducers = 3;
+  const int kConsumers = 3;
+  const int kPerProducer = 30000;
+  s21::mpmc_queue<int> q(8);
+  std::vector<std::vector<int>> got(kConsumers);
+  std::vector<std::thread> threads;
+  for (int p = 0; p < kProducers; ++p) {
+    threads.emplace_back([&q, p] {
+      int next = p * kPerProducer;
+      int end = next + kPerProducer;
+      std::vector<int> batch(5);
+      while (next < end) {
+        if (p % 2 == 0) {
+          q.push(next++);
+          continue;
+        }
+        int n = std::min<int>(batch.size(), end - next);
+        for (int i = 0; i < n; ++i) batch[i] = next + i;
+        auto rest = q.try_push_many(batch.begin(), batch.begin() + n);
+        next += rest - batch.begin();
+        if (rest == batch.begin()) std::this_thread::yield();
+      }
+    });
+  }
+  std::atomic<int> left(kProducers * kPerProducer);
+  for (int c = 0; c < kConsumers; ++c) {
+    threads.emplace_back([&q, &got, &left, c] {
+      // each consumer takes a fixed share, so pop never waits forever
+      int share = kProducers * kPerProducer / kConsumers;
+      for (int i = 0; i < share; ++i) {
+        int value;
+        q.pop(value);
+        got[c].push_back(value);
+        left.fetch_sub(1);
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  EXPECT_EQ(left.load(), 0);
+
+  std::vector<int> all;
+  for (const auto &part : got) {
+    // a consumer sees each producer's values in the order they were pushed
+    std::vector<int> last(kProducers, -1);
+    for (int value : part) {
+      int p = value / kPerProducer;
+      EXPECT_LT(last[p], value);
+      last[p] = value;
+    }
+    all.insert(all.end(), part.begin(), part.end());
+  }
+  std::sort(all.begin(), all.end());
+  ASSERT_EQ(all.size(), size_t(kProducers * kPerProducer));
+  for (int i = 0; i < kProducers * kPerProducer; ++i) {
+    ASSERT_EQ(all[i], i);
+  }
+}
@@ -1,4 +1,11 @@
+#include <algorithm>
+#include <functional>
+#include <iterator>
 #include <set>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include "s21_gtests.h"
 
@@ -92,6 +99,40 @@ TEST(multiset, Move_Constructor) {
   EXPECT_EQ(s4.empty(), true);
 }
 
+TEST(multiset, Range_Constructor) {
+  std::vector<int> runs{1, 4, 4, 9, 16, 15, 10, 4, 2, 7, 7, 11, 0};
+  s21::multiset<int> my1(runs.begin(), runs.end());
+  std::multiset<int> std1(runs.begin(), runs.end());
+  EXPECT_TRUE(is_equal_multi(my1, std1));
+
+  std::istringstream input("5 3 9 3 1");
+  s21::multiset<int> my2((std::istream_iterator<int>(input)),
+                         std::istream_iterator<int>());
+  std::multiset<int> std2{5, 3, 9, 3, 1};
+  EXPECT_TRUE(is_equal_multi(my2, std2));
+}
+
+TEST(multiset, Assign_Sorted) {
+  std::vector<int> keys;
+  for (int i = 0; i < 1000; ++i) keys.push_back(i / 3);
+  s21::multiset<int> my1;
+  my1.assign_sorted(keys.begin(), keys.end());
+  std::multiset<int> std1(keys.begin(), keys.end());
+  EXPECT_TRUE(is_equal_multi(my1, std1));
+  my1.insert(100);
+  std1.insert(100);
+  EXPECT_TRUE(is_equal_multi(my1, std1));
+}
+
+TEST(multiset, Assign_Parallel) {
+  std::vector<int> keys;
+  for (int i = 0; i < 100000; ++i) keys.push_back(i * 7919 % 3001);
+  s21::multiset<int> my{5};
+  my.assign_parallel(keys.begin(), keys.end(), 3);
+  std::multiset<int> std1(keys.begin(), keys.end());
+  EXPECT_TRUE(is_equal_multi(my, std1));
+}
+
 //**********************CAPACITY**********************
 
 TEST(multiset, Empty) {
@@ -122,6 +163,19 @@ TEST(multiset, Max_size) {
   // EXPECT_EQ(s21_sc.max_size(), std_sc.max_size());
 }
 
+TEST(multiset, Memory_Stats) {
+  s21::multiset<int> s21_s;
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 100; ++i) s21_s.insert(i);
+  }
+  s21::MemoryStats stats = s21_s.memory_stats();
+  EXPECT_EQ(stats.payload, 300 * sizeof(int));
+  EXPECT_EQ(stats.allocations, 300U);
+  EXPECT_EQ(s21_s.memory_usage(), stats.total());
+  s21_s.clear();
+  EXPECT_EQ(s21_s.memory_usage(), sizeof(s21_s));
+}
+
 //**********************Iterator**********************
 TEST(multiset, Iterators) {
   s21::multiset<int> s1 = {1, 2, 3, 4, 5, 6};
@@ -138,6 +192,16 @@ TEST(multiset, Iterators) {
   EXPECT_EQ(*it1, *it2);
 }
 
+TEST(multiset, Reverse_Iterator) {
+  s21::multiset<int> my{4, 2, 4, 8, 2};
+  std::multiset<int> std{4, 2, 4, 8, 2};
+  EXPECT_TRUE(std::equal(std.rbegin(), std.rend(), my.rbegin()));
+  EXPECT_TRUE(std::equal(std.crbegin(), std.crend(), my.crbegin()));
+  EXPECT_EQ(std::distance(my.crbegin(), my.crend()), 5);
+  EXPECT_EQ(my.front(), 2);
+  EXPECT_EQ(my.back(), 8);
+}
+
 //**********************MODIFIERS**********************
 TEST(multiset, Insert) {
   std::multiset<int> std1;
@@ -242,6 +306,120 @@ TEST(multiset, Merge) {
   EXPECT_TRUE(is_equal_multi(my2, std2));
 }
 
+TEST(multiset, Erase_Range) {
+  s21::multiset<int> my = {1, 2, 2, 2, 3, 3, 4};
+  std::multiset<int> std = {1, 2, 2, 2, 3, 3, 4};
+  auto range = my.equal_range(2);
+  auto next = my.erase(range.first, range.second);
+  std.erase(2);
+  EXPECT_TRUE(is_equal_multi(my, std));
+  EXPECT_EQ(*next, 3);
+  // from the second copy of 3 on
+  my.erase(std::next(my.begin(), 2), my.end());
+  std.erase(std::next(std.begin(), 2), std.end());
+  EXPECT_TRUE(is_equal_multi(my, std));
+}
+
+TEST(multiset, Split_Join) {
+  s21::multiset<int> low = {1, 2, 2, 3, 3, 3, 4};
+  auto high = low.split(3);
+  EXPECT_EQ(low.size(), 3U);
+  EXPECT_EQ(high.size(), 4U);
+  EXPECT_EQ(low.count(3), 0U);
+  EXPECT_EQ(high.count(3), 3U);
+  // equal keys may meet at the seam
+  s21::multiset<int> tie = {2, 4};
+  EXPECT_THROW(high.join(tie), std::invalid_argument);
+  tie.erase(tie.find(4));
+  low.join(tie);
+  EXPECT_EQ(low.count(2), 3U);
+  high.join(low);
+  std::multiset<int> std = {1, 2, 2, 2, 3, 3, 3, 4};
+  EXPECT_TRUE(is_equal_multi(high, std));
+  EXPECT_TRUE(low.empty());
+
+  s21::multiset<int, std::less<int>, s21::BPlusTree> leaves;
+  s21::multiset<int, std::less<int>, s21::ArenaAVLTree> arena;
+  for (int i = 0; i < 500; ++i) {
+    leaves.insert(i / 2);
+    arena.insert(i / 2);
+  }
+  auto leaves_high = leaves.split(100);
+  auto arena_high = arena.split(100);
+  EXPECT_EQ(leaves.size(), 200U);
+  EXPECT_EQ(arena.size(), 200U);
+  EXPECT_EQ(leaves_high.count(100), 2U);
+  EXPECT_EQ(arena_high.count(100), 2U);
+  leaves_high.join(leaves);
+  arena_high.join(arena);
+  EXPECT_EQ(leaves_high.size(), 500U);
+  EXPECT_EQ(arena_high.size(), 500U);
+  EXPECT_EQ(*leaves_high.begin(), 0);
+  EXPECT_EQ(*arena_high.begin(), 0);
+}
+
+TEST(multiset, Insert_Hint) {
+  s21::multiset<int> my;
+  std::multiset<int> std;
+  for (int i = 0; i < 500; ++i) {
+    my.insert(my.end(), i / 3);
+    std.insert(std.end(), i / 3);
+  }
+  my.insert(my.find(7), 7);
+  std.insert(7);
+  my.emplace_hint(my.begin(), 400);
+  std.insert(400);
+  EXPECT_EQ(my.count(7), 4U);
+  EXPECT_EQ(my.size(), std.size());
+  EXPECT_TRUE(std::equal(std.begin(), std.end(), my.begin()));
+
+  s21::multiset<int, std::less<int>, s21::BPlusTree> tree;
+  for (int i = 0; i < 500; ++i) {
+    tree.insert(tree.end(), i / 3);
+  }
+  tree.insert(tree.find(7), 7);
+  tree.emplace_hint(tree.begin(), 400);
+  EXPECT_EQ(tree.count(7), 4U);
+  EXPECT_TRUE(std::equal(std.begin(), std.end(), tree.begin()));
+}
+
+TEST(multiset, Node_Handle) {
+  s21::multiset<int> from{1, 2, 2, 3};
+  s21::multiset<int> to{2};
+  auto node = from.extract(2);
+  EXPECT_EQ(node.value(), 2);
+  EXPECT_EQ(from.count(2), 1U);
+  auto it = to.insert(std::move(node));
+  EXPECT_TRUE(node.empty());
+  EXPECT_EQ(*it, 2);
+  EXPECT_EQ(to.count(2), 2U);
+  to.insert(from.extract(from.begin()));
+  EXPECT_EQ(*to.begin(), 1);
+  EXPECT_EQ(from.size(), 2U);
+  EXPECT_EQ(to.size(), 3U);
+
+  s21::multiset<int, std::less<int>, s21::BPlusTree> tree{4, 4};
+  tree.insert(tree.extract(4));
+  EXPECT_EQ(tree.count(4), 2U);
+}
+
+TEST(multiset, Emplace) {
+  s21::multiset<std::string> my;
+  EXPECT_EQ(*my.emplace(2, 'x'), "xx");
+  EXPECT_EQ(*my.emplace("xx"), "xx");
+  std::string key = "yy";
+  my.insert(std::move(key));
+  my.insert(my.begin(), std::string("aa"));
+  EXPECT_EQ(my.size(), 4U);
+  EXPECT_EQ(my.count("xx"), 2U);
+  EXPECT_EQ(*my.begin(), "aa");
+
+  s21::multiset<std::string, std::less<std::string>, s21::ArenaAVLTree> arena;
+  arena.emplace(3, 'z');
+  arena.emplace(3, 'z');
+  EXPECT_EQ(arena.count("zzz"), 2U);
+}
+
 //**********************LOOKUP**********************
 TEST(multiset, Find) {
   std::multiset<int> stdmultiset = {2, 4, 6, 8, 10, 12, 14, 16, 16, 22, 44, 66};
@@ -297,4 +475,83 @@ TEST(multiset, Insert_many) {
   s1.insert({7, 11, 23, 96, 3, 12, 1, -24, 88});
   s2.insert_many(7, 11, 23, 96, 3, 12, 1, -24, 88);
   EXPECT_TRUE(is_equal_multi(s2, s1));
-}
\ No newline at end of file
+}
+
+//**********************BACKENDS**********************
+TEST(multiset, BPlusTree_Backend) {
+  s21::multiset<int, std::less<int>, s21::BPlusTree> my;
+  std::multiset<int> std;
+  for (int i = 0; i < 4000; ++i) {
+    my.insert(i % 97);
+    std.insert(i % 97);
+  }
+  for (int i = 0; i < 2000; ++i) {
+    my.erase(my.find(i % 50));
+    std.erase(std.find(i % 50));
+  }
+  EXPECT_EQ(my.size(), std.size());
+  EXPECT_TRUE(std::equal(std.begin(), std.end(), my.begin()));
+  EXPECT_EQ(my.count(60), std.count(60));
+  EXPECT_EQ(my.count(10), std.count(10));
+  EXPECT_EQ(*my.upper_bound(60), *std.upper_bound(60));
+}
+
+TEST(multiset, ArenaAVLTree_Backend) {
+  s21::multiset<int, std::less<int>, s21::ArenaAVLTree> my;
+  std::multiset<int> std;
+  my.reserve(4000);
+  for (int i = 0; i < 4000; ++i) {
+    my.insert(i % 97);
+    std.insert(i % 97);
+  }
+  for (int i = 0; i < 2000; ++i) {
+    my.erase(my.find(i % 50));
+    std.erase(std.find(i % 50));
+  }
+  EXPECT_EQ(my.size(), std.size());
+  EXPECT_TRUE(std::equal(std.begin(), std.end(), my.begin()));
+  EXPECT_EQ(my.count(60), std.count(60));
+  EXPECT_EQ(my.count(10), std.count(10));
+  EXPECT_EQ(*my.upper_bound(60), *std.upper_bound(60));
+}
+
+TEST(multiset, Find_Many) {
+  s21::multiset<int> my;
+  s21::multiset<int, std::less<int>, s21::BPlusTree> tree;
+  for (int i = 0; i < 3000; ++i) {
+    my.insert(i % 400 * 2);
+    tree.insert(i % 400 * 2);
+  }
+  std::vector<int> keys;
+  for (int i = 820; i >= -10; --i) keys.push_back(i);
+  std::vector<s21::multiset<int>::iterator> found;
+  std::vector<bool> present;
+  my.find_many(keys.begin(), keys.end(), std::back_inserter(found));
+  tree.contains_many(keys.begin(), keys.end(), std::back_inserter(present));
+  ASSERT_EQ(found.size(), keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    EXPECT_TRUE(found[i] == my.find(keys[i]));
+    EXPECT_TRUE(found[i] == my.lower_bound(keys[i]) || found[i] == my.end());
+    EXPECT_EQ(present[i], keys[i] >= 0 && keys[i] < 800 && keys[i] % 2 == 0);
+  }
+}
+
+//**********************COMPARATORS**********************
+TEST(multiset, Custom_Compare) {
+  s21::multiset<int, std::greater<int>> my{4, 1, 4, 8, 1, 4};
+  std::multiset<int, std::greater<int>> std{4, 1, 4, 8, 1, 4};
+  EXPECT_TRUE(std::equal(std.begin(), std.end(), my.begin()));
+  EXPECT_EQ(my.count(4), 3U);
+  EXPECT_EQ(*my.lower_bound(5), 4);
+  EXPECT_EQ(*my.upper_bound(4), 1);
+  auto range = my.equal_range(1);
+  EXPECT_EQ(*range.first, 1);
+  EXPECT_TRUE(range.second == my.end());
+}
+
+TEST(multiset, Transparent_Lookup) {
+  s21::multiset<std::string, std::less<>> my{"b", "a", "b"};
+  EXPECT_EQ(*my.find(std::string_view("b")), "b");
+  EXPECT_TRUE(my.contains("a"));
+  EXPECT_FALSE(my.contains("c"));
+}
@@ -0,0 +1,138 @@
+#include <functional>
+#include <memory>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "s21_gtests.h"
+
+namespace {
+
+// random pushes, pops and batches, checked step by step against
+// std::priority_queue
+template <std::size_t Arity>
+void check_against_std(unsigned seed) {
+  s21::priority_queue<int, std::less<int>, Arity> ours;
+  std::priority_queue<int> theirs;
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> value(-1000, 1000);
+  for (int step = 0; step < 5000; ++step) {
+    int action = gen() % 10;
+    if (action < 5) {
+      int v = value(gen);
+      ours.push(v);
+      theirs.push(v);
+    } else if (action < 9 && !theirs.empty()) {
+      ASSERT_EQ(ours.top(), theirs.top());
+      ASSERT_EQ(ours.pop_value(), theirs.top());
+      theirs.pop();
+    } else {
+      std::vector<int> batch(gen() % 40);
+      for (int &v : batch) {
+        v = value(gen);
+        theirs.push(v);
+      }
+      ours.push_many(batch.begin(), batch.end());
+    }
+    ASSERT_EQ(ours.size(), theirs.size());
+  }
+  while (!theirs.empty()) {
+    ASSERT_EQ(ours.top(), theirs.top());
+    ours.pop();
+    theirs.pop();
+  }
+  EXPECT_TRUE(ours.empty());
+}
+
+}  // namespace
+
+TEST(PriorityQueue, Against_Std) {
+  check_against_std<2>(1);
+  check_against_std<3>(2);
+  check_against_std<4>(3);
+  check_against_std<8>(4);
+}
+
+TEST(PriorityQueue, Heapify) {
+  std::vector<int> values;
+  for (int i = 0; i < 1000; ++i) values.push_back((i * 7919) % 1000);
+  s21::priority_queue<int> from_range(values.begin(), values.end());
+  EXPECT_EQ(from_range.size(), size_t(1000));
+  for (int expected = 999; expected >= 0; --expected) {
+    ASSERT_EQ(from_range.pop_value(), expected);
+  }
+
+  s21::priority_queue<int> from_list = {3, 1, 4, 1, 5, 9, 2, 6};
+  EXPECT_EQ(from_list.top(), 9);
+}
+
+TEST(PriorityQueue, Min_Heap) {
+  s21::priority_queue<std::string, std::greater<std::string>, 2> q = {
+      "pear", "apple", "fig"};
+  q.emplace(3, 'a');
+  EXPECT_EQ(q.pop_value(), "aaa");
+  EXPECT_EQ(q.pop_value(), "apple");
+  EXPECT_EQ(q.top(), "fig");
+}
+
+TEST(PriorityQueue, Move_Only) {
+  auto by_value = [](const std::unique_ptr<int> &a,
+                     const std::unique_ptr<int> &b) { return *a < *b; };
+  s21::priority_queue<std::unique_ptr<int>, decltype(by_value)> q(by_value);
+  for (int i : {4, 8, 1, 6}) q.push(std::make_unique<int>(i));
+  q.emplace(new int(7));
+  EXPECT_EQ(*q.pop_value(), 8);
+  EXPECT_EQ(*q.pop_value(), 7);
+  EXPECT_EQ(*q.top(), 6);
+}
+
+TEST(PriorityQueue, Push_Many_Rebuilds) {
+  s21::priority_queue<int> q = {5};
+  std::vector<int> more = {1, 9, 3, 7};
+  q.push_many(more.begin(), more.end());  // rebuilds: 4 new >= 1 old
+  std::vector<int> few = {8};
+  q.push_many(few.begin(), few.end());  // sifts up
+  std::vector<int> out;
+  while (!q.empty()) out.push_back(q.pop_value());
+  EXPECT_EQ(out, (std::vector<int>{9, 8, 7, 5, 3, 1}));
+}
+
+// pushing an element of the queue itself onto a full queue copies it
+// before the heap grows
+TEST(PriorityQueue, Push_Self_Reference) {
+  s21::priority_queue<std::string> q;
+  q.reserve(8);
+  for (char c = 'a'; c < 'i'; ++c) q.push(std::string(40, c));
+  q.push(q.top());
+  EXPECT_EQ(q.size(), 9U);
+  EXPECT_EQ(q.pop_value(), std::string(40, 'h'));
+  EXPECT_EQ(q.pop_value(), std::string(40, 'h'));
+  EXPECT_EQ(q.top(), std::string(40, 'g'));
+}
+
+TEST(PriorityQueue, Empty_Copy_Swap) {
+  s21::priority_queue<int> q;
+  EXPECT_THROW(q.top(), std::out_of_range);
+  EXPECT_THROW(q.pop(), std::out_of_range);
+  EXPECT_THROW(q.pop_value(), std::out_of_range);
+
+  s21::priority_queue<int> other = {2, 3};
+  s21::priority_queue<int> copy(other);
+  q.swap(other);
+  EXPECT_EQ(q.top(), 3);
+  EXPECT_TRUE(other.empty());
+  other = std::move(copy);
+  EXPECT_EQ(other.size(), size_t(2));
+  other.clear();
+  EXPECT_TRUE(other.empty());
+}
+
+TEST(PriorityQueue, Memory_Stats) {
+  s21::priority_queue<int> q;
+  q.reserve(16);
+  q.push(1);
+  EXPECT_EQ(q.memory_stats().payload, sizeof(int));
+  EXPECT_EQ(q.memory_stats().allocations, size_t(1));
+  EXPECT_GE(q.memory_usage(), 16 * sizeof(int));
+}
@@ -1,4 +1,9 @@
+#include <iterator>
+#include <memory>
 #include <queue>
+#include <sstream>
+#include <string>
+#include <vector>
 
 #include "s21_gtests.h"
 
@@ -161,6 +166,15 @@ TEST(Queue, Size) {
   EXPECT_EQ(our_queue_empty.size(), std_queue_empty.size());
 }
 
+TEST(Queue, Memory_Stats) {
+  s21::queue<int> our_queue_int = {1, 2, 3};
+  s21::circular_buffer<int> our_buffer_int = {1, 2, 3};
+  EXPECT_EQ(our_queue_int.memory_usage(), our_buffer_int.memory_usage());
+  EXPECT_EQ(our_queue_int.memory_stats().payload, 3 * sizeof(int));
+  our_queue_int.pop();
+  EXPECT_EQ(our_queue_int.memory_stats().payload, 2 * sizeof(int));
+}
+
 TEST(Queue, Swap) {
   s21::queue<int> our_queue_int = {1, 2, 3};
   std::queue<int> std_queue_int;
@@ -221,4 +235,83 @@ TEST(Queue, Insert_many_back) {
   for (int i = 1; i < 11; ++i, qu3.pop()) {
     EXPECT_EQ(i, qu3.front());
   }
-}
\ No newline at end of file
+}
+
+TEST(Queue, Emplace_Move_Only) {
+  s21::queue<std::unique_ptr<int>> q;
+  q.push(std::make_unique<int>(1));
+  q.emplace(new int(2));
+  EXPECT_EQ(*q.front(), 1);
+  EXPECT_EQ(*q.back(), 2);
+  std::vector<std::unique_ptr<int>> out;
+  q.pop_many(std::back_inserter(out), 5);
+  ASSERT_EQ(out.size(), size_t(2));
+  EXPECT_EQ(*out[0], 1);
+  EXPECT_EQ(*out[1], 2);
+  EXPECT_TRUE(q.empty());
+}
+
+TEST(Queue, Batches) {
+  s21::queue<int> q = {1, 2};
+  std::vector<int> more = {3, 4, 5, 6};
+  q.push_many(more.begin(), more.end());
+  std::istringstream in("7 8");
+  q.push_many(std::istream_iterator<int>(in), std::istream_iterator<int>());
+  EXPECT_EQ(q.size(), size_t(8));
+  EXPECT_EQ(q.back(), 8);
+
+  std::vector<int> out;
+  q.pop_many(std::back_inserter(out), 3);
+  EXPECT_EQ(out, (std::vector<int>{1, 2, 3}));
+  q.pop_many(std::back_inserter(out), 100);
+  EXPECT_EQ(out, (std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8}));
+  EXPECT_TRUE(q.empty());
+}
+
+TEST(Queue, Against_Std_Queue) {
+  s21::queue<int> ours;
+  std::queue<int> theirs;
+  // pushes outpace pops, so the buffer wraps around and grows while wrapped
+  for (int i = 0; i < 100000; ++i) {
+    ours.push(i);
+    theirs.push(i);
+    if (i % 3 == 1) {
+      ours.pop();
+      theirs.pop();
+    }
+    if (i % 997 == 0) {
+      ASSERT_EQ(ours.front(), theirs.front());
+      ASSERT_EQ(ours.back(), theirs.back());
+    }
+  }
+  ASSERT_EQ(ours.size(), theirs.size());
+  while (!theirs.empty()) {
+    ASSERT_EQ(ours.front(), theirs.front());
+    ours.pop();
+    theirs.pop();
+  }
+  EXPECT_TRUE(ours.empty());
+  EXPECT_THROW(ours.pop(), std::out_of_range);
+}
+
+TEST(Queue, Other_Containers) {
+  s21::queue<int, s21::deque<int>> on_deque;
+  s21::queue<int, s21::list<int>> on_list = {1, 2};
+  std::vector<int> values = {1, 2, 3, 4, 5};
+  on_deque.push_many(values.begin(), values.end());
+  on_deque.emplace(6);
+  on_list.push(3);
+  std::vector<int> out;
+  on_deque.pop_many(std::back_inserter(out), 4);
+  EXPECT_EQ(out, (std::vector<int>{1, 2, 3, 4}));
+  EXPECT_EQ(on_deque.front(), 5);
+  EXPECT_EQ(on_deque.back(), 6);
+  on_list.pop();
+  EXPECT_EQ(on_list.front(), 2);
+  EXPECT_EQ(on_list.back(), 3);
+
+  s21::deque<int> start = {7, 8};
+  s21::queue<int, s21::deque<int>> from_container(std::move(start));
+  EXPECT_EQ(from_container.size(), size_t(2));
+  EXPECT_EQ(from_container.front(), 7);
+}
@@ -1,4 +1,13 @@
+#include <algorithm>
+#include <cctype>
+#include <functional>
+#include <iterator>
+#include <memory>
 #include <set>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include "s21_gtests.h"
 
@@ -90,6 +99,81 @@ TEST(Set, Move_Constructor) {
   EXPECT_EQ(s4.empty(), true);
 }
 
+TEST(Set, Range_Constructor) {
+  std::vector<int> sorted{1, 2, 2, 3, 5, 8, 13, 21};
+  s21::set<int> my1(sorted.begin(), sorted.end());
+  std::set<int> std1(sorted.begin(), sorted.end());
+  EXPECT_TRUE(is_equal_sets(my1, std1));
+
+  std::vector<int> runs{1, 4, 9, 16, 15, 10, 3, 2, 7, 7, 11, 0};
+  s21::set<int> my2(runs.begin(), runs.end());
+  std::set<int> std2(runs.begin(), runs.end());
+  EXPECT_TRUE(is_equal_sets(my2, std2));
+
+  std::istringstream input("5 3 9 3 1");
+  s21::set<int> my3((std::istream_iterator<int>(input)),
+                    std::istream_iterator<int>());
+  std::set<int> std3{5, 3, 9, 3, 1};
+  EXPECT_TRUE(is_equal_sets(my3, std3));
+
+  std::vector<int> empty;
+  s21::set<int> my4(empty.begin(), empty.end());
+  EXPECT_TRUE(my4.empty());
+}
+
+TEST(Set, Assign_Sorted) {
+  std::vector<int> keys;
+  for (int i = 0; i < 1000; ++i) keys.push_back(i / 2);
+  s21::set<int> my1{-1, 2000};
+  my1.assign_sorted(keys.begin(), keys.end());
+  std::set<int> std1(keys.begin(), keys.end());
+  EXPECT_TRUE(is_equal_sets(my1, std1));
+  my1.insert(1000);
+  my1.erase(my1.find(250));
+  std1.insert(1000);
+  std1.erase(250);
+  EXPECT_TRUE(is_equal_sets(my1, std1));
+
+  std::vector<std::string> unsorted{"pear", "apple", "fig", "apple"};
+  s21::set<std::string> my2;
+  my2.assign_sorted(unsorted.begin(), unsorted.end());
+  std::set<std::string> std2(unsorted.begin(), unsorted.end());
+  EXPECT_TRUE(is_equal_sets(my2, std2));
+}
+
+TEST(Set, Assign_Parallel) {
+  std::vector<int> keys;
+  for (int i = 0; i < 120000; ++i) keys.push_back(i * 7919 % 65521);
+  std::set<int> std(keys.begin(), keys.end());
+  s21::set<int> my;
+  my.assign_parallel(keys.begin(), keys.end(), s21::bulk::Keep::kFirst, 5);
+  EXPECT_TRUE(is_equal_sets(my, std));
+  s21::set<int, std::less<int>, s21::BPlusTree> tree;
+  tree.assign_parallel(keys.begin(), keys.end());
+  EXPECT_TRUE(std::equal(std.begin(), std.end(), tree.begin(), tree.end()));
+
+  // equivalent keys are told apart by their second member
+  using Item = std::pair<int, int>;
+  auto by_first = [](const Item &a, const Item &b) {
+    return a.first < b.first;
+  };
+  std::vector<Item> items;
+  for (int i = 0; i < 50000; ++i) items.emplace_back(i % 1000, i);
+  s21::set<Item, decltype(by_first)> first(by_first);
+  s21::set<Item, decltype(by_first)> last(by_first);
+  first.assign_parallel(items.begin(), items.end(), s21::bulk::Keep::kFirst,
+                        4);
+  last.assign_parallel(items.begin(), items.end(), s21::bulk::Keep::kLast, 4);
+  ASSERT_EQ(first.size(), 1000U);
+  ASSERT_EQ(last.size(), 1000U);
+  int key = 0;
+  for (auto it = first.begin(), jt = last.begin(); it != first.end();
+       ++it, ++jt, ++key) {
+    EXPECT_EQ(*it, Item(key, key));
+    EXPECT_EQ(*jt, Item(key, 49000 + key));
+  }
+}
+
 //**********************CAPACITY**********************
 
 TEST(Set, Empty) {
@@ -120,6 +204,46 @@ TEST(Set, Max_size) {
   // EXPECT_EQ(s21_sc.max_size(), std_sc.max_size());
 }
 
+template <template <typename, typename, typename> class Tree>
+void expect_set_memory_stats() {
+  s21::set<int, std::less<int>, Tree> my;
+  EXPECT_EQ(my.memory_stats().payload, 0U);
+  for (int i = 0; i < 1000; ++i) my.insert(i * 7 % 1000);
+  s21::MemoryStats stats = my.memory_stats();
+  EXPECT_EQ(stats.payload, 1000 * sizeof(int));
+  EXPECT_GT(stats.overhead, sizeof(my));
+  EXPECT_GT(stats.allocations, 0U);
+  EXPECT_EQ(my.memory_usage(), stats.total());
+  for (int i = 0; i < 1000; i += 2) my.erase(my.find(i));
+  EXPECT_EQ(my.memory_stats().payload, 500 * sizeof(int));
+  my.clear();
+  EXPECT_EQ(my.memory_stats().payload, 0U);
+}
+
+TEST(Set, Memory_Stats) {
+  expect_set_memory_stats<s21::AVLTree>();
+  expect_set_memory_stats<s21::ArenaAVLTree>();
+  expect_set_memory_stats<s21::BPlusTree>();
+  expect_set_memory_stats<s21::FlatTree>();
+  expect_set_memory_stats<s21::BloomTree>();
+
+  // node-based trees give every node back as the elements go
+  s21::set<int> avl;
+  s21::set<int, std::less<int>, s21::BPlusTree> bplus;
+  for (int i = 0; i < 5000; ++i) {
+    avl.insert(i * 31 % 5000);
+    bplus.insert(i * 31 % 5000);
+  }
+  EXPECT_EQ(avl.memory_stats().allocations, 5000U);
+  EXPECT_GT(bplus.memory_stats().allocations, 5000U / 64);
+  EXPECT_LT(bplus.memory_usage(), avl.memory_usage());
+  while (!avl.empty()) avl.erase(avl.begin());
+  while (!bplus.empty()) bplus.erase(bplus.begin());
+  EXPECT_EQ(avl.memory_usage(), sizeof(avl));
+  EXPECT_EQ(bplus.memory_usage(), sizeof(bplus));
+  EXPECT_EQ(bplus.memory_stats().allocations, 0U);
+}
+
 //**********************Iterator**********************
 TEST(Set, Iterators) {
   s21::set<int> s1 = {1, 2, 3, 4, 5, 6};
@@ -136,6 +260,39 @@ TEST(Set, Iterators) {
   EXPECT_EQ(*it1, *it2);
 }
 
+TEST(Set, Reverse_Iterator) {
+  s21::set<int> my{5, 1, 9, 3, 7};
+  std::set<int> std{5, 1, 9, 3, 7};
+  EXPECT_TRUE(std::equal(std.rbegin(), std.rend(), my.rbegin()));
+  EXPECT_EQ(my.front(), 1);
+  EXPECT_EQ(my.back(), 9);
+  auto it = my.end();
+  EXPECT_EQ(*--it, 9);
+  EXPECT_EQ(*it--, 9);
+  EXPECT_EQ(*it, 7);
+  my.insert(11);
+  my.erase(my.begin());
+  EXPECT_EQ(my.front(), 3);
+  EXPECT_EQ(my.back(), 11);
+  EXPECT_EQ(std::distance(my.begin(), my.end()), 5);
+
+  s21::set<int> empty;
+  EXPECT_TRUE(empty.begin() == empty.end());
+  EXPECT_TRUE(empty.rbegin() == empty.rend());
+
+  s21::set<int, std::less<int>, s21::BPlusTree> tree;
+  for (int i = 0; i < 1000; ++i) {
+    tree.insert(i);
+  }
+  int expected = 999;
+  for (auto rit = tree.rbegin(); rit != tree.rend(); ++rit) {
+    EXPECT_EQ(*rit, expected--);
+  }
+  EXPECT_EQ(expected, -1);
+  EXPECT_EQ(tree.front(), 0);
+  EXPECT_EQ(tree.back(), 999);
+}
+
 //**********************MODIFIERS**********************
 TEST(Set, Insert) {
   std::set<int> std1;
@@ -243,6 +400,189 @@ TEST(Set, Merge) {
   EXPECT_TRUE(is_equal_sets(my2, std2));
 }
 
+TEST(Set, Erase_Range) {
+  s21::set<int> my = {1, 2, 3, 4, 5, 6, 7, 8};
+  std::set<int> std = {1, 2, 3, 4, 5, 6, 7, 8};
+  auto next = my.erase(my.find(3), my.find(6));
+  std.erase(std.find(3), std.find(6));
+  EXPECT_TRUE(is_equal_sets(my, std));
+  EXPECT_EQ(*next, 6);
+  EXPECT_TRUE(my.erase(my.begin(), my.begin()) == my.begin());
+  EXPECT_TRUE(my.erase(my.find(7), my.end()) == my.end());
+  std.erase(7);
+  std.erase(8);
+  EXPECT_TRUE(is_equal_sets(my, std));
+  my.erase(my.begin(), my.end());
+  EXPECT_TRUE(my.empty());
+  EXPECT_TRUE(my.begin() == my.end());
+}
+
+template <template <typename, typename, typename> class Tree>
+void expect_split_join() {
+  s21::set<int, std::less<int>, Tree> low;
+  std::vector<int> keys;
+  for (int i = 0; i < 1000; ++i) {
+    low.insert(i * 2);
+    keys.push_back(i * 2);
+  }
+  auto high = low.split(701);
+  EXPECT_EQ(low.size(), 351U);
+  EXPECT_EQ(high.size(), 649U);
+  EXPECT_EQ(low.back(), 700);
+  EXPECT_EQ(high.front(), 702);
+  auto all = low.split(-1);
+  EXPECT_TRUE(low.empty());
+  EXPECT_EQ(all.size(), 351U);
+  EXPECT_TRUE(all.split(5000).empty());
+  low.swap(all);
+
+  s21::set<int, std::less<int>, Tree> overlap = {700, 5000};
+  EXPECT_THROW(low.join(overlap), std::invalid_argument);
+  EXPECT_EQ(overlap.size(), 2U);
+  high.join(low);
+  EXPECT_TRUE(low.empty());
+  EXPECT_EQ(high.size(), keys.size());
+  EXPECT_TRUE(std::equal(keys.begin(), keys.end(), high.begin()));
+  EXPECT_TRUE(std::equal(keys.rbegin(), keys.rend(), high.rbegin()));
+  s21::set<int, std::less<int>, Tree> above = {5000, 6000};
+  high.join(above);
+  EXPECT_EQ(high.back(), 6000);
+  EXPECT_EQ(high.size(), keys.size() + 2);
+}
+
+TEST(Set, Split_Join) {
+  expect_split_join<s21::AVLTree>();
+  expect_split_join<s21::ArenaAVLTree>();
+  expect_split_join<s21::BPlusTree>();
+  expect_split_join<s21::BloomTree>();
+}
+
+// AVLTree reads both sizes off its subtree sizes, so they have to survive
+// the rotations of inserts, erases, range erases and earlier splits
+TEST(Set, Split_Uneven_Sizes) {
+  s21::set<int> my;
+  std::set<int> std;
+  for (int i = 0; i < 3000; ++i) {
+    int key = i * 7919 % 4001;
+    my.insert(key);
+    std.insert(key);
+  }
+  for (int i = 0; i < 4001; i += 3) {
+    if (std.erase(i)) my.erase(my.find(i));
+  }
+  my.erase(my.find(*std.lower_bound(1000)), my.find(*std.lower_bound(1100)));
+  std.erase(std.lower_bound(1000), std.lower_bound(1100));
+  for (int cut : {3990, 17, 2500, 0, 1}) {
+    auto tail = my.split(cut);
+    size_t below = std::distance(std.begin(), std.lower_bound(cut));
+    EXPECT_EQ(my.size(), below);
+    EXPECT_EQ(tail.size(), std.size() - below);
+    EXPECT_EQ(static_cast<size_t>(std::distance(tail.begin(), tail.end())),
+              tail.size());
+    tail.insert(5000);
+    tail.erase(tail.find(5000));
+    EXPECT_EQ(tail.size(), std.size() - below);
+    my.join(tail);
+    EXPECT_EQ(my.size(), std.size());
+  }
+  EXPECT_TRUE(std::equal(std.begin(), std.end(), my.begin()));
+}
+
+TEST(Set, Insert_Hint) {
+  s21::set<int> my;
+  std::set<int> std;
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(*my.insert(my.end(), i * 2), i * 2);
+    std.insert(std.end(), i * 2);
+  }
+  auto last = my.find(0);
+  for (int i = 1; i < 1000; i += 2) {
+    last = my.insert(last, i);
+    std.insert(i);
+    EXPECT_EQ(*last, i);
+  }
+  // a wrong hint still inserts in the right place
+  EXPECT_EQ(*my.insert(my.begin(), 5000), 5000);
+  std.insert(5000);
+  EXPECT_EQ(*my.emplace_hint(my.end(), -1), -1);
+  std.insert(-1);
+  size_t size = my.size();
+  EXPECT_EQ(*my.insert(my.find(10), 10), 10);
+  EXPECT_EQ(*my.insert(my.end(), 10), 10);
+  EXPECT_EQ(my.size(), size);
+  EXPECT_EQ(my.size(), std.size());
+  EXPECT_TRUE(std::equal(std.begin(), std.end(), my.begin()));
+
+  s21::set<int, std::less<int>, s21::BPlusTree> tree;
+  for (int i = 0; i < 1000; ++i) {
+    tree.insert(tree.end(), i * 2);
+  }
+  auto hint = tree.find(0);
+  for (int i = 1; i < 1000; i += 2) {
+    hint = tree.insert(hint, i);
+  }
+  tree.insert(tree.begin(), 5000);
+  tree.emplace_hint(tree.end(), -1);
+  tree.insert(tree.find(10), 10);
+  EXPECT_EQ(tree.size(), std.size());
+  EXPECT_TRUE(std::equal(std.begin(), std.end(), tree.begin()));
+}
+
+TEST(Set, Node_Handle) {
+  s21::set<int> from{1, 2, 3, 4};
+  s21::set<int> to{3};
+  const int *address = &*from.find(2);
+  auto node = from.extract(2);
+  EXPECT_FALSE(node.empty());
+  EXPECT_EQ(node.value(), 2);
+  EXPECT_FALSE(from.contains(2));
+  auto result = to.insert(std::move(node));
+  EXPECT_TRUE(result.inserted);
+  EXPECT_TRUE(result.node.empty());
+  EXPECT_EQ(*result.position, 2);
+  // the node itself moved over
+  EXPECT_EQ(&*to.find(2), address);
+
+  result = to.insert(from.extract(from.find(3)));
+  EXPECT_FALSE(result.inserted);
+  EXPECT_EQ(result.node.value(), 3);
+  EXPECT_EQ(*result.position, 3);
+  result.node.value() = 5;
+  EXPECT_TRUE(to.insert(std::move(result.node)).inserted);
+  EXPECT_TRUE(from.extract(42).empty());
+  EXPECT_EQ(from.size(), 2U);
+  EXPECT_EQ(to.size(), 3U);
+  EXPECT_EQ(*to.begin(), 2);
+  EXPECT_EQ(to.back(), 5);
+
+  s21::set<int, std::less<int>, s21::BPlusTree> tree{1, 2, 3};
+  s21::set<int, std::less<int>, s21::ArenaAVLTree> arena;
+  EXPECT_TRUE(arena.insert(tree.extract(tree.begin())).inserted);
+  EXPECT_TRUE(arena.insert(tree.extract(3)).inserted);
+  EXPECT_EQ(tree.size(), 1U);
+  EXPECT_EQ(*tree.begin(), 2);
+  EXPECT_EQ(arena.size(), 2U);
+  EXPECT_EQ(arena.back(), 3);
+}
+
+TEST(Set, Emplace) {
+  s21::set<std::string> my;
+  auto result = my.emplace(3, 'a');
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ(*result.first, "aaa");
+  EXPECT_FALSE(my.emplace("aaa").second);
+  std::string key = "bbb";
+  EXPECT_TRUE(my.insert(std::move(key)).second);
+  my.insert(my.end(), std::string("ccc"));
+  EXPECT_EQ(my.size(), 3U);
+  EXPECT_EQ(my.back(), "ccc");
+
+  s21::set<std::unique_ptr<int>> owners;
+  owners.insert(std::make_unique<int>(1));
+  owners.emplace(new int(2));
+  EXPECT_EQ(owners.size(), 2U);
+}
+
 //**********************LOOKUP**********************
 TEST(Set, Find) {
   std::set<int> stdset = {2, 4, 6, 8, 10, 12, 14, 16, 16, 22, 44, 66};
@@ -262,6 +602,38 @@ TEST(Set, Contains) {
   EXPECT_FALSE(my1.contains(5));
 }
 
+template <template <typename, typename, typename> class Tree>
+void expect_set_find_many() {
+  s21::set<int, std::less<int>, Tree> my;
+  for (int i = 0; i < 3000; i += 3) my.insert(i);
+  std::vector<int> keys;
+  for (int i = 3100; i >= -50; i -= 7) keys.push_back(i);
+  std::vector<typename s21::set<int, std::less<int>, Tree>::iterator> found;
+  std::vector<bool> present;
+  my.find_many(keys.begin(), keys.end(), std::back_inserter(found));
+  my.contains_many(keys.begin(), keys.end(), std::back_inserter(present));
+  ASSERT_EQ(found.size(), keys.size());
+  ASSERT_EQ(present.size(), keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    EXPECT_TRUE(found[i] == my.find(keys[i]));
+    EXPECT_EQ(present[i], my.contains(keys[i]));
+  }
+  s21::set<int, std::less<int>, Tree> empty;
+  present.clear();
+  empty.contains_many(keys.begin(), keys.begin() + 20,
+                      std::back_inserter(present));
+  EXPECT_EQ(std::count(present.begin(), present.end(), true), 0);
+  EXPECT_EQ(present.size(), 20U);
+}
+
+TEST(Set, Find_Many) {
+  expect_set_find_many<s21::AVLTree>();
+  expect_set_find_many<s21::ArenaAVLTree>();
+  expect_set_find_many<s21::BPlusTree>();
+  expect_set_find_many<s21::FlatTree>();
+  expect_set_find_many<s21::BloomTree>();
+}
+
 //**********************PART3**********************
 TEST(Set, Insert_many) {
   std::set<int> s1;
@@ -298,4 +670,211 @@ TEST(Set, Insert_many) {
   s1.insert({7, 11, 23, 96, 3, 12, 1, -24, 88});
   s2.insert_many(7, 11, 23, 96, 3, 12, 1, -24, 88);
   EXPECT_TRUE(is_equal_sets(s2, s1));
-}
\ No newline at end of file
+}
+
+//**********************BACKENDS**********************
+TEST(Set, BPlusTree_Backend) {
+  s21::set<int, std::less<int>, s21::BPlusTree> my;
+  std::set<int> std;
+  for (int i = 0; i < 5000; ++i) {
+    int key = i * 7919 % 3001;
+    EXPECT_EQ(my.insert(key).second, std.insert(key).second);
+  }
+  for (int i = 0; i < 3001; i += 3) {
+    my.erase(my.find(i));
+    std.erase(i);
+  }
+  EXPECT_EQ(my.size(), std.size());
+  EXPECT_TRUE(std::equal(std.begin(), std.end(), my.begin()));
+  EXPECT_FALSE(my.contains(3));
+  EXPECT_TRUE(my.contains(4));
+
+  s21::set<int, std::less<int>, s21::BPlusTree> copy(my);
+  s21::set<int, std::less<int>, s21::BPlusTree> other{-5, 4, 5000};
+  copy.merge(other);
+  std::set<int> std_copy(std);
+  std_copy.insert({-5, 5000});
+  EXPECT_EQ(copy.size(), std_copy.size());
+  EXPECT_TRUE(std::equal(std_copy.begin(), std_copy.end(), copy.begin()));
+  EXPECT_EQ(other.size(), 1U);
+  EXPECT_EQ(*other.begin(), 4);
+  EXPECT_EQ(my.size(), std.size());
+}
+
+TEST(Set, ArenaAVLTree_Backend) {
+  s21::set<int, std::less<int>, s21::ArenaAVLTree> my;
+  std::set<int> std;
+  my.reserve(100);
+  for (int i = 0; i < 5000; ++i) {
+    int key = i * 7919 % 3001;
+    EXPECT_EQ(my.insert(key).second, std.insert(key).second);
+  }
+  for (int i = 0; i < 3001; i += 3) {
+    my.erase(my.find(i));
+    std.erase(i);
+  }
+  // freed slots are reused before the arena grows
+  for (int i = 0; i < 3001; i += 6) {
+    my.insert(i);
+    std.insert(i);
+  }
+  EXPECT_EQ(my.size(), std.size());
+  EXPECT_TRUE(std::equal(std.begin(), std.end(), my.begin()));
+  EXPECT_TRUE(std::equal(std.rbegin(), std.rend(), my.rbegin()));
+  EXPECT_FALSE(my.contains(3));
+  EXPECT_TRUE(my.contains(6));
+
+  s21::set<int, std::less<int>, s21::ArenaAVLTree> copy(my);
+  s21::set<int, std::less<int>, s21::ArenaAVLTree> other{-5, 4, 5000};
+  copy.merge(other);
+  std::set<int> std_copy(std);
+  std_copy.insert({-5, 5000});
+  EXPECT_EQ(copy.size(), std_copy.size());
+  EXPECT_TRUE(std::equal(std_copy.begin(), std_copy.end(), copy.begin()));
+  EXPECT_EQ(other.size(), 1U);
+  EXPECT_EQ(*other.begin(), 4);
+  EXPECT_TRUE(std::equal(std.begin(), std.end(), my.begin()));
+  my.clear();
+  EXPECT_TRUE(my.empty());
+  EXPECT_TRUE(my.begin() == my.end());
+}
+
+TEST(Set, BloomTree_Backend) {
+  s21::set<int, std::less<int>, s21::BloomTree> my;
+  std::set<int> std;
+  my.reserve(1000);
+  for (int i = 0; i < 5000; ++i) {
+    int key = i * 7919 % 3001 * 2;
+    EXPECT_EQ(my.insert(key).second, std.insert(key).second);
+  }
+  for (int i = 0; i < 6002; ++i) {
+    if (i % 3 && std.erase(i)) my.erase(my.find(i));
+  }
+  // the erases outnumber the keys left, so the filter has been rebuilt
+  for (int i = -10; i < 6010; ++i) {
+    EXPECT_EQ(my.contains(i), std.count(i) == 1);
+    EXPECT_EQ(my.find(i) != my.end(), std.count(i) == 1);
+  }
+  EXPECT_GT(my.false_positive_rate(), 0.0);
+  EXPECT_LT(my.false_positive_rate(), 0.05);
+
+  s21::set<int, std::less<int>, s21::BloomTree> copy(my);
+  s21::set<int, std::less<int>, s21::BloomTree> other{-5, 6, 7000};
+  copy.merge(other);
+  EXPECT_TRUE(copy.contains(-5));
+  EXPECT_TRUE(copy.contains(7000));
+  EXPECT_EQ(other.size(), 1U);
+  EXPECT_TRUE(other.contains(6));
+  EXPECT_FALSE(other.contains(7000));
+  EXPECT_TRUE(std::equal(std.begin(), std.end(), my.begin()));
+  my.clear();
+  EXPECT_FALSE(my.contains(6));
+  my.insert(4);
+  EXPECT_TRUE(my.contains(4));
+}
+
+TEST(Set, Bloom_Filter) {
+  s21::BloomFilter<int> filter(10000);
+  EXPECT_EQ(filter.bit_count() / 10000, 10U);
+  for (int i = 0; i < 20000; i += 2) filter.add(i);
+  int false_positives = 0;
+  for (int i = 0; i < 20000; i += 2) EXPECT_TRUE(filter.may_contain(i));
+  for (int i = 1; i < 200000; i += 2) false_positives += filter.may_contain(i);
+  double measured = false_positives / 100000.0;
+  EXPECT_NEAR(measured, filter.false_positive_rate(), 0.005);
+  EXPECT_LT(measured, 0.02);
+  EXPECT_EQ(filter.size(), 10000U);
+  filter.clear();
+  EXPECT_EQ(filter.false_positive_rate(), 0.0);
+  EXPECT_TRUE(s21::BloomFilter<int>().may_contain(1));
+}
+
+//**********************COMPARATORS**********************
+TEST(Set, Custom_Compare) {
+  s21::set<int, std::greater<int>> my{5, 1, 9, 3, 7, 3};
+  std::set<int, std::greater<int>> std{5, 1, 9, 3, 7, 3};
+  EXPECT_EQ(my.size(), std.size());
+  EXPECT_TRUE(std::equal(std.begin(), std.end(), my.begin()));
+  EXPECT_FALSE(my.insert(7).second);
+  EXPECT_TRUE(my.key_comp()(2, 1));
+
+  s21::set<int, std::greater<int>, s21::BPlusTree> tree(std.begin(),
+                                                        std.end());
+  EXPECT_TRUE(std::equal(std.begin(), std.end(), tree.begin()));
+  EXPECT_EQ(*tree.find(3), 3);
+}
+
+struct CaseInsensitiveLess {
+  bool operator()(const std::string &a, const std::string &b) const {
+    return std::lexicographical_compare(
+        a.begin(), a.end(), b.begin(), b.end(), [](char x, char y) {
+          return std::tolower(static_cast<unsigned char>(x)) <
+                 std::tolower(static_cast<unsigned char>(y));
+        });
+  }
+};
+
+// agrees with CaseInsensitiveLess: equivalent keys fold to the same string
+struct CaseFoldHash {
+  size_t operator()(const std::string &key) const {
+    std::string folded(key);
+    for (char &c : folded) {
+      c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    return std::hash<std::string>()(folded);
+  }
+};
+
+template <typename K, typename V, typename C>
+using CaseBloomTree = s21::BloomTree<K, V, C, s21::AVLTree, CaseFoldHash>;
+
+TEST(Set, BloomTree_Custom_Compare) {
+  s21::set<std::string, CaseInsensitiveLess, CaseBloomTree> my;
+  s21::set<std::string, CaseInsensitiveLess> plain;
+  for (int i = 0; i < 200; ++i) {
+    std::string key = "key" + std::to_string(i);
+    my.insert(key);
+    plain.insert(key);
+  }
+  my.insert("alpha");
+  plain.insert("alpha");
+  EXPECT_FALSE(my.insert("ALPHA").second);
+  for (const char *key : {"ALPHA", "Alpha", "KEY7", "kEy199", "beta"}) {
+    EXPECT_EQ(my.contains(key), plain.contains(key));
+    EXPECT_EQ(my.find(key) == my.end(), plain.find(key) == plain.end());
+  }
+  EXPECT_TRUE(my.contains("ALPHA"));
+}
+
+TEST(Set, Transparent_Lookup) {
+  s21::set<std::string, std::less<>> my{"apple", "cherry", "banana"};
+  std::string_view key = "banana";
+  EXPECT_EQ(*my.find(key), "banana");
+  EXPECT_TRUE(my.contains("cherry"));
+  EXPECT_FALSE(my.contains(std::string_view("plum")));
+  EXPECT_TRUE(my.find("plum") == my.end());
+}
+
+TEST(Set, Erase_Keeps_Order) {
+  s21::set<int> my;
+  std::set<int> std;
+  for (int i = 0; i < 2000; ++i) {
+    int key = i * 7919 % 1009;
+    my.insert(key);
+    std.insert(key);
+  }
+  for (int i = 0; i < 1009; i += 2) {
+    auto it = my.find(i * 31 % 1009);
+    auto next = it;
+    ++next;
+    int next_key = next == my.end() ? -1 : *next;
+    my.erase(it);
+    std.erase(i * 31 % 1009);
+    // the neighbour is relinked, not copied, so its iterator stays valid
+    if (next_key != -1) {
+      EXPECT_EQ(*next, next_key);
+    }
+  }
+  EXPECT_EQ(my.size(), std.size());
+  EXPECT_TRUE(std::equal(std.begin(), std.end(), my.begin()));
+}
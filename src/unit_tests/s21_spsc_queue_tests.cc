@@ -0,0 +1,109 @@
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "s21_gtests.h"
+
+TEST(spsc_queue, Single_Thread) {
+  s21::spsc_queue<std::string> q(3);
+  EXPECT_EQ(q.capacity(), size_t(4));
+  EXPECT_TRUE(q.empty());
+  EXPECT_THROW(q.front(), std::out_of_range);
+  EXPECT_THROW(q.pop(), std::out_of_range);
+
+  EXPECT_TRUE(q.push("a"));
+  std::string b = "b";
+  EXPECT_TRUE(q.push(b));
+  EXPECT_TRUE(q.emplace(2, 'c'));
+  EXPECT_TRUE(q.push(std::string("d")));
+  std::string e = "e";
+  EXPECT_FALSE(q.push(std::move(e)));
+  EXPECT_EQ(e, "e");
+
+  EXPECT_EQ(q.front(), "a");
+  q.pop();
+  std::string value;
+  ASSERT_TRUE(q.try_pop(value));
+  EXPECT_EQ(value, "b");
+  EXPECT_TRUE(q.push(e));
+  EXPECT_EQ(q.front(), "cc");
+  // the destructor frees the three that are left
+}
+
+TEST(spsc_queue, Batches) {
+  s21::spsc_queue<int> q(4);
+  std::vector<int> in = {1, 2, 3, 4, 5, 6};
+  auto rest = q.push_many(in.begin(), in.end());
+  EXPECT_EQ(rest, in.begin() + 4);
+
+  std::vector<int> out;
+  q.pop_many(std::back_inserter(out), 3);
+  EXPECT_EQ(out, (std::vector<int>{1, 2, 3}));
+  // wraps around the end of the block
+  rest = q.push_many(rest, in.end());
+  EXPECT_EQ(rest, in.end());
+  q.pop_many(std::back_inserter(out), 10);
+  EXPECT_EQ(out, in);
+  EXPECT_TRUE(q.empty());
+  q.pop_many(std::back_inserter(out), 10);
+  EXPECT_EQ(out.size(), in.size());
+}
+
+TEST(spsc_queue, Move_Only) {
+  s21::spsc_queue<std::unique_ptr<int>> q(2);
+  EXPECT_TRUE(q.push(std::make_unique<int>(1)));
+  EXPECT_TRUE(q.emplace(new int(2)));
+  std::unique_ptr<int> first;
+  ASSERT_TRUE(q.try_pop(first));
+  EXPECT_EQ(*first, 1);
+  EXPECT_EQ(*q.front(), 2);
+}
+
+TEST(spsc_queue, Threads) {
+  const int kItems = 200000;
+  s21::spsc_queue<int> q(64);
+  std::thread producer([&q] {
+    int next = 0;
+    std::vector<int> batch(7);
+    while (next < kItems) {
+      if (next % 2) {
+        if (!q.push(next)) {
+          std::this_thread::yield();
+          continue;
+        }
+        ++next;
+      } else {
+        int n = std::min<int>(batch.size(), kItems - next);
+        for (int i = 0; i < n; ++i) batch[i] = next + i;
+        auto rest = q.push_many(batch.begin(), batch.begin() + n);
+        next += rest - batch.begin();
+        if (rest == batch.begin()) std::this_thread::yield();
+      }
+    }
+  });
+
+  std::vector<int> got;
+  got.reserve(kItems);
+  int value;
+  while (int(got.size()) < kItems) {
+    if (got.size() % 3 == 0) {
+      if (q.try_pop(value)) {
+        got.push_back(value);
+      } else {
+        std::this_thread::yield();
+      }
+    } else {
+      size_t before = got.size();
+      q.pop_many(std::back_inserter(got), 5);
+      if (got.size() == before) std::this_thread::yield();
+    }
+  }
+  producer.join();
+  EXPECT_TRUE(q.empty());
+  for (int i = 0; i < kItems; ++i) {
+    ASSERT_EQ(got[i], i);
+  }
+}
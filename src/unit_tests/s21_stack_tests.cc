@@ -1,4 +1,6 @@
+#include <memory>
 #include <stack>
+#include <string>
 
 #include "s21_gtests.h"
 
@@ -127,6 +129,15 @@ TEST(Stack, Size) {
   EXPECT_EQ(our_stack_empty.size(), std_stack_empty.size());
 }
 
+TEST(Stack, Memory_Stats) {
+  s21::stack<int> our_stack_int = {1, 2, 3};
+  s21::vector<int> our_vector_int = {1, 2, 3};
+  EXPECT_EQ(our_stack_int.memory_usage(), our_vector_int.memory_usage());
+  EXPECT_EQ(our_stack_int.memory_stats().payload, 3 * sizeof(int));
+  our_stack_int.pop();
+  EXPECT_EQ(our_stack_int.memory_stats().payload, 2 * sizeof(int));
+}
+
 TEST(Stack, Push) {
   s21::stack<int> our_stack_int;
   our_stack_int.push(1);
@@ -184,4 +195,75 @@ TEST(Stack, Insert_many) {
   EXPECT_EQ(st.top(), 1);
   st.pop();
   EXPECT_EQ(st.top(), 4);
-}
\ No newline at end of file
+}
+
+// unique_ptr cannot be copied, so these only compile if nothing copies
+template <typename Container>
+void expect_stack_moves_only() {
+  s21::stack<std::unique_ptr<int>, Container> st;
+  st.push(std::make_unique<int>(1));
+  std::unique_ptr<int> two = std::make_unique<int>(2);
+  st.push(std::move(two));
+  st.emplace(new int(3));
+  EXPECT_EQ(st.size(), 3U);
+  EXPECT_EQ(*st.top(), 3);
+  for (int i = 3; i > 0; --i) {
+    std::unique_ptr<int> top = st.pop_value();
+    ASSERT_TRUE(top);
+    EXPECT_EQ(*top, i);
+  }
+  EXPECT_TRUE(st.empty());
+  EXPECT_THROW(st.pop_value(), std::out_of_range);
+}
+
+TEST(Stack, Move_Only) {
+  expect_stack_moves_only<s21::vector<std::unique_ptr<int>>>();
+  expect_stack_moves_only<s21::list<std::unique_ptr<int>>>();
+}
+
+TEST(Stack, List_Container) {
+  s21::stack<std::string, s21::list<std::string>> our_stack = {"a", "b"};
+  std::stack<std::string> std_stack;
+  std_stack.push("a");
+  std_stack.push("b");
+  our_stack.push("c");
+  std_stack.push("c");
+  our_stack.emplace(3, 'd');
+  std_stack.emplace(3, 'd');
+  our_stack.insert_many_front("y", "z");
+  EXPECT_EQ(our_stack.size(), std_stack.size() + 2);
+  while (!std_stack.empty()) {
+    EXPECT_EQ(our_stack.pop_value(), std_stack.top());
+    std_stack.pop();
+  }
+  EXPECT_EQ(our_stack.top(), "z");
+  our_stack.pop();
+  EXPECT_EQ(our_stack.top(), "y");
+
+  s21::list<std::string> items = {"p", "q"};
+  s21::stack<std::string, s21::list<std::string>> adopted(std::move(items));
+  EXPECT_EQ(adopted.top(), "q");
+  EXPECT_EQ(adopted.memory_stats().allocations, 3U);
+}
+
+TEST(Stack, Deque_Container) {
+  s21::stack<std::string, s21::deque<std::string>> our_stack = {"a", "b"};
+  std::stack<std::string> std_stack;
+  std_stack.push("a");
+  std_stack.push("b");
+  for (int i = 0; i < 2000; ++i) {
+    our_stack.push(std::to_string(i));
+    std_stack.push(std::to_string(i));
+  }
+  our_stack.emplace(3, 'd');
+  std_stack.emplace(3, 'd');
+  our_stack.insert_many_front("y", "z");
+  EXPECT_EQ(our_stack.size(), std_stack.size() + 2);
+  while (!std_stack.empty()) {
+    EXPECT_EQ(our_stack.pop_value(), std_stack.top());
+    std_stack.pop();
+  }
+  EXPECT_EQ(our_stack.top(), "z");
+  our_stack.pop();
+  EXPECT_EQ(our_stack.top(), "y");
+}
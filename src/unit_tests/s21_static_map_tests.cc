@@ -0,0 +1,118 @@
+#include <iterator>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "s21_gtests.h"
+
+template <typename Key, typename Val>
+bool is_equal_static(s21::static_map<Key, Val> &mymap,
+                     std::map<Key, Val> &stdmap) {
+  if (mymap.size() != stdmap.size()) return false;
+  auto it = mymap.begin();
+  for (const auto &kv : stdmap) {
+    if ((*it).first != kv.first || (*it).second != kv.second) return false;
+    ++it;
+  }
+  return it == mymap.end();
+}
+
+//**********************CONSTRUCTORS**********************
+TEST(static_map, Constructors) {
+  s21::static_map<int, std::string> my{{3, "c"}, {1, "a"}, {2, "b"}, {1, "x"}};
+  std::map<int, std::string> std{{3, "c"}, {1, "a"}, {2, "b"}, {1, "x"}};
+  EXPECT_TRUE(is_equal_static(my, std));
+  EXPECT_EQ(my.front().second, "a");
+
+  s21::static_map<int, std::string> copy(my);
+  EXPECT_TRUE(is_equal_static(copy, std));
+  s21::static_map<int, std::string> moved(std::move(copy));
+  EXPECT_TRUE(is_equal_static(moved, std));
+  EXPECT_TRUE(copy.empty());
+
+  std::vector<std::pair<int, std::string>> items;
+  for (int i = 0; i < 1000; ++i) {
+    items.emplace_back(i * 7 % 101, std::to_string(i));
+  }
+  s21::static_map<int, std::string> ranged(items.begin(), items.end());
+  std::map<int, std::string> std_ranged(items.begin(), items.end());
+  EXPECT_TRUE(is_equal_static(ranged, std_ranged));
+}
+
+TEST(static_map, From_Map) {
+  s21::map<int, int> source;
+  std::map<int, int> std;
+  for (int i = 0; i < 4000; ++i) {
+    source.insert(i * 31 % 4093, i);
+    std.insert({i * 31 % 4093, i});
+  }
+  s21::static_map<int, int> my(source);
+  EXPECT_TRUE(is_equal_static(my, std));
+  auto it = my.end();
+  for (auto std_it = std.rbegin(); std_it != std.rend(); ++std_it) {
+    --it;
+    EXPECT_EQ((*it).first, std_it->first);
+  }
+  EXPECT_TRUE(it == my.begin());
+}
+
+TEST(static_map, Memory_Stats) {
+  std::vector<std::pair<int, int>> items;
+  for (int i = 0; i < 1000; ++i) items.emplace_back(i, -i);
+  s21::static_map<int, int> my(items.begin(), items.end());
+  s21::MemoryStats stats = my.memory_stats();
+  EXPECT_EQ(stats.payload, 1000 * 2 * sizeof(int));
+  EXPECT_EQ(stats.allocations, 2U);
+  EXPECT_EQ(my.memory_usage(), stats.total());
+}
+
+//**********************ELEMENT ACCESS**********************
+TEST(static_map, At) {
+  s21::static_map<std::string, int> my{{"b", 2}, {"a", 1}};
+  ++my.at("a");
+  EXPECT_EQ(my.at("a"), 2);
+  EXPECT_EQ(my.at("b"), 2);
+  EXPECT_THROW(my.at("c"), std::out_of_range);
+  (*my.find("b")).second = 7;
+  EXPECT_EQ(my.at("b"), 7);
+}
+
+//**********************LOOKUP**********************
+TEST(static_map, Lookup) {
+  std::map<int, int> std;
+  for (int i = 0; i < 3000; ++i) std[i * 5] = -i;
+  s21::static_map<int, int> my(std.begin(), std.end());
+  for (int key = -3; key < 15010; key += 2) {
+    EXPECT_EQ(my.contains(key), std.count(key) == 1);
+    EXPECT_EQ(my.count(key), std.count(key));
+    auto lower = my.lower_bound(key);
+    auto std_lower = std.lower_bound(key);
+    EXPECT_EQ(lower == my.end(), std_lower == std.end());
+    if (std_lower != std.end()) {
+      EXPECT_EQ((*lower).first, std_lower->first);
+    }
+    auto range = my.equal_range(key);
+    EXPECT_EQ(std::distance(range.first, range.second),
+              static_cast<long>(std.count(key)));
+  }
+
+  std::vector<int> queries;
+  for (int i = 0; i < 500; ++i) queries.push_back(i * 37 % 16000 - 100);
+  std::vector<s21::static_map<int, int>::iterator> found;
+  std::vector<bool> present;
+  my.find_many(queries.begin(), queries.end(), std::back_inserter(found));
+  my.contains_many(queries.begin(), queries.end(),
+                   std::back_inserter(present));
+  for (size_t i = 0; i < queries.size(); ++i) {
+    EXPECT_TRUE(found[i] == my.find(queries[i]));
+    EXPECT_EQ(present[i], std.count(queries[i]) == 1);
+  }
+}
+
+TEST(static_map, Transparent_Lookup) {
+  s21::static_map<std::string, int, std::less<>> my{{"one", 1}, {"two", 2}};
+  EXPECT_TRUE(my.contains("two"));
+  EXPECT_EQ((*my.find("one")).second, 1);
+  EXPECT_FALSE(my.contains("three"));
+}
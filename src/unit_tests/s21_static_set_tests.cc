@@ -0,0 +1,157 @@
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "s21_gtests.h"
+
+template <typename Key, typename Compare>
+bool is_equal_static(s21::static_set<Key, Compare> &myset,
+                     std::set<Key, Compare> &stdset) {
+  return myset.size() == stdset.size() &&
+         std::equal(stdset.begin(), stdset.end(), myset.begin()) &&
+         std::equal(stdset.rbegin(), stdset.rend(), myset.rbegin());
+}
+
+//**********************CONSTRUCTORS**********************
+TEST(static_set, Constructors) {
+  s21::static_set<int> empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_TRUE(empty.begin() == empty.end());
+  EXPECT_FALSE(empty.contains(0));
+  EXPECT_TRUE(empty.find(0) == empty.end());
+
+  s21::static_set<int> my = {5, 1, 4, 1, 3, 5, 2};
+  std::set<int> std = {5, 1, 4, 1, 3, 5, 2};
+  EXPECT_TRUE(is_equal_static(my, std));
+  EXPECT_EQ(my.front(), 1);
+  EXPECT_EQ(my.back(), 5);
+
+  s21::static_set<int> copy(my);
+  EXPECT_TRUE(is_equal_static(copy, std));
+  s21::static_set<int> moved(std::move(copy));
+  EXPECT_TRUE(is_equal_static(moved, std));
+  EXPECT_TRUE(copy.empty());
+  copy = std::move(moved);
+  EXPECT_TRUE(is_equal_static(copy, std));
+}
+
+TEST(static_set, Every_Size) {
+  for (int n = 0; n < 70; ++n) {
+    std::vector<int> keys;
+    for (int i = 0; i < n; ++i) keys.push_back(i * 2);
+    s21::static_set<int> my(keys.begin(), keys.end());
+    std::set<int> std(keys.begin(), keys.end());
+    EXPECT_TRUE(is_equal_static(my, std));
+    for (int key = -1; key <= 2 * n; ++key) {
+      EXPECT_EQ(my.contains(key), std.count(key) == 1);
+      auto lower = my.lower_bound(key);
+      auto std_lower = std.lower_bound(key);
+      EXPECT_EQ(lower == my.end(), std_lower == std.end());
+      if (std_lower != std.end()) {
+        EXPECT_EQ(*lower, *std_lower);
+      }
+      auto upper = my.upper_bound(key);
+      auto std_upper = std.upper_bound(key);
+      EXPECT_EQ(upper == my.end(), std_upper == std.end());
+      if (std_upper != std.end()) {
+        EXPECT_EQ(*upper, *std_upper);
+      }
+    }
+  }
+}
+
+TEST(static_set, Memory_Stats) {
+  s21::static_set<int> empty;
+  EXPECT_EQ(empty.memory_stats().payload, 0U);
+  std::vector<int> keys;
+  for (int i = 0; i < 1000; ++i) keys.push_back(i);
+  s21::static_set<int> my(keys.begin(), keys.end());
+  s21::MemoryStats stats = my.memory_stats();
+  EXPECT_EQ(stats.payload, 1000 * sizeof(int));
+  EXPECT_EQ(stats.allocations, 1U);
+  EXPECT_EQ(my.memory_usage(), stats.total());
+  s21::set<int> tree(keys.begin(), keys.end());
+  EXPECT_LT(my.memory_usage(), tree.memory_usage());
+}
+
+TEST(static_set, From_Set) {
+  s21::set<int, std::less<int>, s21::BPlusTree> source;
+  std::set<int> std;
+  for (int i = 0; i < 5000; ++i) {
+    source.insert(i * 7919 % 10007);
+    std.insert(i * 7919 % 10007);
+  }
+  s21::static_set<int> my(source);
+  EXPECT_TRUE(is_equal_static(my, std));
+
+  s21::set<int, std::greater<int>> reversed = {1, 5, 3};
+  s21::static_set<int, std::greater<int>> down(reversed);
+  std::set<int, std::greater<int>> std_down = {1, 5, 3};
+  EXPECT_TRUE(is_equal_static(down, std_down));
+  EXPECT_EQ(*down.lower_bound(4), 3);
+}
+
+//**********************LOOKUP**********************
+TEST(static_set, Lookup) {
+  std::vector<int> keys;
+  for (int i = 0; i < 3000; ++i) keys.push_back(i * 7919 % 6007);
+  s21::static_set<int> my(keys.begin(), keys.end());
+  std::set<int> std(keys.begin(), keys.end());
+  for (int key = -5; key < 6100; key += 3) {
+    EXPECT_EQ(my.contains(key), std.count(key) == 1);
+    EXPECT_EQ(my.count(key), std.count(key));
+    auto it = my.find(key);
+    if (std.count(key)) {
+      EXPECT_EQ(*it, key);
+    } else {
+      EXPECT_TRUE(it == my.end());
+    }
+    auto range = my.equal_range(key);
+    EXPECT_EQ(std::distance(range.first, range.second),
+              static_cast<long>(std.count(key)));
+  }
+  auto it = my.find(100);
+  EXPECT_EQ(*--it, *--std.find(100));
+  EXPECT_THROW(*my.end(), std::out_of_range);
+}
+
+TEST(static_set, Find_Many) {
+  std::vector<int> keys;
+  for (int i = 0; i < 2000; ++i) keys.push_back(i * 3);
+  s21::static_set<int> my(keys.begin(), keys.end());
+  std::vector<int> queries;
+  for (int i = 6100; i >= -20; i -= 5) queries.push_back(i);
+  std::vector<s21::static_set<int>::iterator> found;
+  std::vector<bool> present;
+  my.find_many(queries.begin(), queries.end(), std::back_inserter(found));
+  my.contains_many(queries.begin(), queries.end(),
+                   std::back_inserter(present));
+  ASSERT_EQ(found.size(), queries.size());
+  ASSERT_EQ(present.size(), queries.size());
+  for (size_t i = 0; i < queries.size(); ++i) {
+    EXPECT_TRUE(found[i] == my.find(queries[i]));
+    EXPECT_EQ(present[i], my.contains(queries[i]));
+  }
+}
+
+TEST(static_set, Transparent_Lookup) {
+  s21::static_set<std::string, std::less<>> my = {"pear", "fig", "apple"};
+  std::string_view key = "fig";
+  EXPECT_TRUE(my.contains(key));
+  EXPECT_EQ(*my.find(key), "fig");
+  EXPECT_FALSE(my.contains(std::string_view("kiwi")));
+}
+
+TEST(static_set, Swap) {
+  s21::static_set<int> a = {1, 2, 3};
+  s21::static_set<int> b = {9};
+  a.swap(b);
+  EXPECT_EQ(a.size(), 1U);
+  EXPECT_EQ(b.size(), 3U);
+  EXPECT_TRUE(a.contains(9));
+  EXPECT_TRUE(b.contains(2));
+}
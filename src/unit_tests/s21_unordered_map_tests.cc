@@ -0,0 +1,216 @@
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "s21_gtests.h"
+
+template <typename Key, typename Val>
+bool is_equal_hashed(s21::unordered_map<Key, Val> &mymap,
+                     std::unordered_map<Key, Val> &stdmap) {
+  size_t seen = 0;
+  for (auto it = mymap.begin(); it != mymap.end(); ++it, ++seen) {
+    auto found = stdmap.find((*it).first);
+    if (found == stdmap.end() || found->second != (*it).second) return false;
+  }
+  return seen == stdmap.size() && mymap.size() == stdmap.size();
+}
+
+//**********************CONSTRUCTORS**********************
+TEST(unordered_map, Constructors) {
+  s21::unordered_map<int, std::string> empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_TRUE(empty.begin() == empty.end());
+  EXPECT_FALSE(empty.contains(1));
+  EXPECT_EQ(empty.bucket_count(), 0U);
+
+  s21::unordered_map<int, std::string> my{{3, "c"}, {1, "a"}, {1, "x"}};
+  std::unordered_map<int, std::string> std{{3, "c"}, {1, "a"}, {1, "x"}};
+  EXPECT_TRUE(is_equal_hashed(my, std));
+
+  s21::unordered_map<int, std::string> copy(my);
+  EXPECT_TRUE(is_equal_hashed(copy, std));
+  s21::unordered_map<int, std::string> moved(std::move(copy));
+  EXPECT_TRUE(is_equal_hashed(moved, std));
+  EXPECT_TRUE(copy.empty());
+  copy = std::move(moved);
+  EXPECT_TRUE(is_equal_hashed(copy, std));
+
+  std::vector<std::pair<int, std::string>> items;
+  for (int i = 0; i < 500; ++i) items.emplace_back(i % 97, std::to_string(i));
+  s21::unordered_map<int, std::string> ranged(items.begin(), items.end());
+  std::unordered_map<int, std::string> std_ranged(items.begin(), items.end());
+  EXPECT_TRUE(is_equal_hashed(ranged, std_ranged));
+
+  s21::unordered_map<int, int> sized(1000);
+  EXPECT_GE(sized.bucket_count(), 1000U);
+  EXPECT_TRUE(sized.empty());
+}
+
+//**********************ELEMENT ACCESS**********************
+TEST(unordered_map, Accessors) {
+  s21::unordered_map<std::string, int> my;
+  my["b"] = 2;
+  my["a"] = 1;
+  ++my["a"];
+  EXPECT_EQ(my.at("a"), 2);
+  EXPECT_EQ(my.at("b"), 2);
+  EXPECT_THROW(my.at("c"), std::out_of_range);
+  (*my.find("b")).second = 5;
+  EXPECT_EQ(my["b"], 5);
+  EXPECT_EQ(my.size(), 2U);
+  EXPECT_THROW(*my.end(), std::out_of_range);
+}
+
+//**********************MODIFIERS**********************
+TEST(unordered_map, Insert) {
+  s21::unordered_map<int, std::string> my;
+  std::unordered_map<int, std::string> std;
+  for (int i = 0; i < 20000; ++i) {
+    int key = i * 7919 % 10007;
+    auto res = my.insert({key, std::to_string(i)});
+    EXPECT_EQ(res.second, std.insert({key, std::to_string(i)}).second);
+    EXPECT_EQ((*res.first).first, key);
+  }
+  EXPECT_TRUE(is_equal_hashed(my, std));
+  EXPECT_LE(my.load_factor(), my.max_load_factor());
+  EXPECT_FALSE(my.insert(5, "five").second);
+  EXPECT_TRUE(my.try_emplace(-1, 3, 'z').second);
+  EXPECT_EQ(my.at(-1), "zzz");
+  EXPECT_FALSE(my.try_emplace(-1, "other").second);
+  EXPECT_FALSE(my.insert_or_assign(-1, "new").second);
+  EXPECT_EQ(my.at(-1), "new");
+  EXPECT_TRUE(my.insert_or_assign(-2, "two").second);
+  EXPECT_TRUE(my.emplace(-3, "three").second);
+  EXPECT_FALSE(my.emplace(-3, "again").second);
+  EXPECT_EQ(my.at(-3), "three");
+}
+
+// Many erases leave no tombstones behind: every key is still found, and
+// the table does not grow while the element count stays flat.
+TEST(unordered_map, Erase) {
+  s21::unordered_map<int, int> my;
+  std::unordered_map<int, int> std;
+  my.reserve(1000);
+  size_t buckets = my.bucket_count();
+  for (int round = 0; round < 50; ++round) {
+    for (int i = 0; i < 1000; ++i) {
+      my[round * 1000 + i] = i;
+      std[round * 1000 + i] = i;
+    }
+    for (int i = 0; i < 1000; ++i) {
+      if (i % 5) {
+        EXPECT_EQ(my.erase(round * 1000 + i), 1U);
+        std.erase(round * 1000 + i);
+      }
+    }
+    for (int i = 0; i < 1000; i += 5) {
+      my.erase(my.find(round * 1000 + i));
+      std.erase(round * 1000 + i);
+    }
+    EXPECT_TRUE(my.empty());
+  }
+  EXPECT_EQ(my.bucket_count(), buckets);
+  EXPECT_EQ(my.erase(7), 0U);
+
+  for (int i = 0; i < 3000; ++i) {
+    my[i] = i;
+    std[i] = i;
+  }
+  for (int i = 0; i < 3000; i += 3) {
+    my.erase(i);
+    std.erase(i);
+  }
+  EXPECT_TRUE(is_equal_hashed(my, std));
+  for (int i = 0; i < 3000; ++i) {
+    EXPECT_EQ(my.contains(i), i % 3 != 0);
+  }
+  my.clear();
+  EXPECT_TRUE(my.empty());
+  EXPECT_TRUE(my.begin() == my.end());
+}
+
+TEST(unordered_map, Max_Load_Factor) {
+  s21::unordered_map<int, int> my;
+  EXPECT_THROW(my.max_load_factor(0.0f), std::invalid_argument);
+  EXPECT_THROW(my.max_load_factor(1.0f), std::invalid_argument);
+  for (int i = 0; i < 1000; ++i) my[i] = i;
+  my.max_load_factor(0.25f);
+  EXPECT_LE(my.load_factor(), 0.25f);
+  for (int i = 0; i < 1000; ++i) EXPECT_EQ(my.at(i), i);
+  my.max_load_factor(0.95f);
+  my.rehash(0);
+  EXPECT_GT(my.load_factor(), 0.25f);
+  for (int i = 0; i < 1000; ++i) EXPECT_EQ(my.at(i), i);
+}
+
+TEST(unordered_map, Memory_Stats) {
+  s21::unordered_map<int, std::string> my;
+  for (int i = 0; i < 500; ++i) my.insert(i, std::to_string(i));
+  s21::MemoryStats stats = my.memory_stats();
+  EXPECT_EQ(stats.payload, 500 * (sizeof(int) + sizeof(std::string)));
+  EXPECT_EQ(stats.allocations, 2U);
+  EXPECT_EQ(my.memory_usage(), stats.total());
+  my.erase(7);
+  EXPECT_EQ(my.memory_stats().payload,
+            499 * (sizeof(int) + sizeof(std::string)));
+}
+
+TEST(unordered_map, Swap_Merge) {
+  s21::unordered_map<int, char> my1{{1, 'a'}, {4, 'd'}};
+  s21::unordered_map<int, char> my2{{2, 'b'}, {4, 'x'}, {9, 'i'}};
+  std::unordered_map<int, char> std1{{1, 'a'}, {4, 'd'}};
+  std::unordered_map<int, char> std2{{2, 'b'}, {4, 'x'}, {9, 'i'}};
+  my1.merge(my2);
+  std1.merge(std2);
+  EXPECT_TRUE(is_equal_hashed(my1, std1));
+  EXPECT_TRUE(is_equal_hashed(my2, std2));
+  my1.swap(my2);
+  EXPECT_TRUE(is_equal_hashed(my1, std2));
+  EXPECT_TRUE(is_equal_hashed(my2, std1));
+}
+
+TEST(unordered_map, Insert_Many) {
+  s21::unordered_map<int, std::string> my{{1, "one"}};
+  auto res = my.insert_many(std::make_pair(2, "two"),
+                            std::make_pair(1, "uno"),
+                            std::make_pair(3, "three"));
+  EXPECT_EQ(res.size(), 3U);
+  EXPECT_TRUE(res[0].second);
+  EXPECT_FALSE(res[1].second);
+  EXPECT_EQ((*res[1].first).second, "one");
+  EXPECT_EQ((*res[2].first).second, "three");
+  EXPECT_EQ((*res[0].first).second, "two");
+  EXPECT_EQ(my.size(), 3U);
+}
+
+// try_emplace builds the value before claiming a slot, so an argument that
+// refers into the table survives the rehash the claim triggers.
+TEST(unordered_map, Try_Emplace_Self_Reference) {
+  const std::string value(40, 'v');
+  s21::unordered_map<int, std::string> my{{0, value}};
+  size_t buckets = my.bucket_count();
+  for (int i = 1; i < 200; ++i) {
+    EXPECT_TRUE(my.try_emplace(i, my.at(i - 1)).second);
+  }
+  EXPECT_GT(my.bucket_count(), buckets);
+  for (int i = 0; i < 200; ++i) EXPECT_EQ(my.at(i), value);
+}
+
+struct ThrowingMapped {
+  ThrowingMapped() = default;
+  explicit ThrowingMapped(bool fail) {
+    if (fail) throw std::runtime_error("mapped");
+  }
+};
+
+TEST(unordered_map, Try_Emplace_Throwing_Value) {
+  s21::unordered_map<int, ThrowingMapped> my;
+  EXPECT_TRUE(my.try_emplace(1, false).second);
+  EXPECT_THROW(my.try_emplace(2, true), std::runtime_error);
+  EXPECT_EQ(my.size(), 1U);
+  EXPECT_FALSE(my.contains(2));
+  EXPECT_TRUE(my.try_emplace(2, false).second);
+  EXPECT_EQ(my.size(), 2U);
+}
@@ -0,0 +1,104 @@
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "s21_gtests.h"
+
+template <typename Key>
+bool is_equal_hashed(s21::unordered_set<Key> &myset,
+                     std::unordered_set<Key> &stdset) {
+  size_t seen = 0;
+  for (auto it = myset.begin(); it != myset.end(); ++it, ++seen) {
+    if (!stdset.count(*it)) return false;
+  }
+  return seen == stdset.size() && myset.size() == stdset.size();
+}
+
+//**********************CONSTRUCTORS**********************
+TEST(unordered_set, Constructors) {
+  s21::unordered_set<int> empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_TRUE(empty.cbegin() == empty.cend());
+
+  s21::unordered_set<int> my = {5, 1, 4, 1, 3, 5, 2};
+  std::unordered_set<int> std = {5, 1, 4, 1, 3, 5, 2};
+  EXPECT_TRUE(is_equal_hashed(my, std));
+
+  s21::unordered_set<int> copy(my);
+  EXPECT_TRUE(is_equal_hashed(copy, std));
+  s21::unordered_set<int> moved(std::move(copy));
+  EXPECT_TRUE(is_equal_hashed(moved, std));
+  EXPECT_TRUE(copy.empty());
+
+  std::vector<std::string> words = {"pear", "fig", "pear", "plum"};
+  s21::unordered_set<std::string> ranged(words.begin(), words.end());
+  std::unordered_set<std::string> std_ranged(words.begin(), words.end());
+  EXPECT_TRUE(is_equal_hashed(ranged, std_ranged));
+}
+
+//**********************MODIFIERS**********************
+TEST(unordered_set, Insert_Erase) {
+  s21::unordered_set<int> my;
+  std::unordered_set<int> std;
+  for (int i = 0; i < 20000; ++i) {
+    int key = i * 7919 % 5003;
+    auto res = my.insert(key);
+    EXPECT_EQ(res.second, std.insert(key).second);
+    EXPECT_EQ(*res.first, key);
+  }
+  EXPECT_TRUE(is_equal_hashed(my, std));
+  for (int key = 0; key < 5003; key += 2) {
+    my.erase(key);
+    std.erase(key);
+  }
+  EXPECT_TRUE(is_equal_hashed(my, std));
+  for (int key = -5; key < 5010; ++key) {
+    EXPECT_EQ(my.contains(key), std.count(key) == 1);
+    EXPECT_EQ(my.find(key) != my.end(), std.count(key) == 1);
+  }
+  EXPECT_TRUE(my.emplace(-7).second);
+  EXPECT_FALSE(my.emplace(-7).second);
+  EXPECT_THROW(my.erase(my.end()), std::out_of_range);
+}
+
+TEST(unordered_set, Hash_Policy) {
+  s21::unordered_set<int> my;
+  my.reserve(100);
+  size_t buckets = my.bucket_count();
+  EXPECT_GE(buckets, 100U);
+  for (int i = 0; i < 100; ++i) my.insert(i);
+  EXPECT_EQ(my.bucket_count(), buckets);
+  my.max_load_factor(0.5f);
+  EXPECT_LE(my.load_factor(), 0.5f);
+  my.rehash(4096);
+  EXPECT_EQ(my.bucket_count(), 4096U);
+  EXPECT_EQ(my.size(), 100U);
+  for (int i = 0; i < 100; ++i) EXPECT_TRUE(my.contains(i));
+}
+
+TEST(unordered_set, Memory_Stats) {
+  s21::unordered_set<int> my;
+  EXPECT_EQ(my.memory_stats().payload, 0U);
+  for (int i = 0; i < 1000; ++i) my.insert(i * 3);
+  s21::MemoryStats stats = my.memory_stats();
+  EXPECT_EQ(stats.payload, 1000 * sizeof(int));
+  EXPECT_EQ(stats.allocations, 2U);
+  EXPECT_GE(stats.total(), my.bucket_count() * (sizeof(int) + 1));
+  EXPECT_EQ(my.memory_usage(), stats.total());
+}
+
+TEST(unordered_set, Merge_Insert_Many) {
+  s21::unordered_set<int> my1 = {1, 2, 3};
+  s21::unordered_set<int> my2 = {3, 4};
+  my1.merge(my2);
+  EXPECT_EQ(my1.size(), 4U);
+  EXPECT_EQ(my2.size(), 1U);
+  EXPECT_TRUE(my2.contains(3));
+
+  auto res = my1.insert_many(5, 1, 6);
+  EXPECT_TRUE(res[0].second);
+  EXPECT_FALSE(res[1].second);
+  EXPECT_EQ(*res[1].first, 1);
+  EXPECT_EQ(*res[2].first, 6);
+  EXPECT_EQ(my1.size(), 6U);
+}
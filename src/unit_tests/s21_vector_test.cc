@@ -1,3 +1,4 @@
+#include <string>
 #include <vector>
 
 #include "s21_gtests.h"
@@ -157,6 +158,28 @@ TEST(Vector, Shrink_to_fit) {
   EXPECT_EQ(v1.size(), v2.size());
 }
 
+TEST(Vector, Memory_Stats) {
+  s21::vector<int> v;
+  EXPECT_EQ(v.memory_stats().payload, 0U);
+  EXPECT_EQ(v.memory_stats().allocations, 0U);
+  EXPECT_EQ(v.memory_usage(), sizeof(v));
+  v.reserve(100);
+  v.push_back(1);
+  v.push_back(2);
+  s21::MemoryStats stats = v.memory_stats();
+  EXPECT_EQ(stats.payload, 2 * sizeof(int));
+  EXPECT_EQ(stats.overhead, sizeof(v) + 98 * sizeof(int));
+  EXPECT_EQ(stats.allocations, 1U);
+  EXPECT_EQ(v.memory_usage(), stats.total());
+
+  s21::vector<int> moved(std::move(v));
+  EXPECT_EQ(moved.memory_stats().payload, 2 * sizeof(int));
+  EXPECT_EQ(v.memory_usage(), sizeof(v));
+  v.push_back(3);
+  EXPECT_EQ(v.size(), 1U);
+  EXPECT_EQ(v.at(0), 3);
+}
+
 TEST(Vector, Clear) {
   s21::vector<int> v1{1, 2, 3, 4, 5};
   std::vector<int> v2{1, 2, 3, 4, 5};
@@ -260,6 +283,20 @@ TEST(Vector, Insert_Throw) {
   EXPECT_THROW(v.insert(v.begin() + 5, 42), std::out_of_range);
 }
 
+TEST(Vector, Move_Insert) {
+  s21::vector<std::string> v;
+  std::string long_text(100, 'x');
+  std::string moved = long_text;
+  v.push_back(std::move(moved));
+  EXPECT_TRUE(moved.empty());
+  moved = "front";
+  auto it = v.insert(v.begin(), std::move(moved));
+  EXPECT_EQ(*it, "front");
+  EXPECT_EQ(v.size(), 2U);
+  EXPECT_EQ(v[1], long_text);
+  EXPECT_THROW(v.insert(v.begin() + 5, std::string()), std::out_of_range);
+}
+
 TEST(Vector, Erase_Throw) {
   s21::vector<int> v;
   v.push_back(1);